@@ -621,6 +621,23 @@ rssringoccs_CDouble_Exp(rssringoccs_ComplexDouble z);
 RSS_RINGOCCS_EXPORT extern rssringoccs_ComplexLongDouble
 rssringoccs_CLDouble_Exp(rssringoccs_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_CDouble_Expi                                              *
+ *  Purpose:                                                                  *
+ *      Compute exp(i theta) for a real number theta. This is the same as     *
+ *      rssringoccs_CDouble_Exp with z = i theta, but the sine and cosine of  *
+ *      theta share one argument reduction.                                   *
+ *  Arguments:                                                                *
+ *      double theta:                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      rssringoccs_ComplexDouble exp_i_theta:                                *
+ *          The complex number cos(theta) + i sin(theta).                     *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT extern rssringoccs_ComplexDouble
+rssringoccs_CDouble_Expi(double theta);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      rssringoccs_Complex_Sqrt                                              *
@@ -79,5 +79,24 @@
  *  few terms. Cosine is defined similarly.                                   */
 #define __RSS_RINGOCCS_USE_TRIG_ALGORITHMS__ 0
 
+/*  The inner loops of the Fresnel transforms are written so that the         *
+ *  compiler can vectorize them. With GCC on x86_64 GNU/Linux, the compiler   *
+ *  can also build AVX2 and AVX-512 copies of these loops and pick the best   *
+ *  one for the CPU when the library is loaded. Set this to 0 to only build   *
+ *  the baseline version (SSE2 on x86_64). This is ignored elsewhere.         */
+#define __RSS_RINGOCCS_USE_TARGET_CLONES__ 1
+
+/*  Attribute for functions that should be built for several instruction     *
+ *  sets, with the right one selected at runtime. target_clones needs GCC 6  *
+ *  or higher and the ifunc support in glibc.                                */
+#if __RSS_RINGOCCS_USE_TARGET_CLONES__ == 1                                   \
+    && defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6)            \
+    && defined(__x86_64__) && defined(__linux__)
+#define RSSRINGOCCS_TARGET_CLONES                                             \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define RSSRINGOCCS_TARGET_CLONES
+#endif
+
 #endif
 /*  End of include guard.                                                     */
@@ -40,6 +40,29 @@
 /*  Boolean data types defined here.                                          */
 #include <rss_ringoccs/include/rss_ringoccs_bool.h>
 
+/*  A CSV file, or a binary cache of one, mapped into memory, or read into    *
+ *  memory where mapping is not available. The mapping is private: writes to  *
+ *  data are not seen in the file. data is not NUL terminated. For CSV files, *
+ *  n_rows counts the lines that are not blank, and n_columns is the number   *
+ *  of comma separated fields in the first of these.                          */
+typedef struct rssringoccs_CSVFile {
+    char *data;
+    unsigned long size;
+    unsigned long n_rows;
+    unsigned long n_columns;
+    /*  rssringoccs_Open_CSV splits large files into chunks that begin at the *
+     *  start of a line, so that they may be parsed in parallel. Chunk k is   *
+     *  bytes chunk_start[k] up to chunk_start[k+1] of data, and chunk_start  *
+     *  has n_chunks + 1 entries. chunk_rows[k] is the number of rows in      *
+     *  chunk k. Both are NULL, and n_chunks is zero, for small files.        */
+    unsigned long n_chunks;
+    unsigned long *chunk_start;
+    unsigned long *chunk_rows;
+    rssringoccs_Bool is_mapped;
+    rssringoccs_Bool error_occurred;
+    char *error_message;
+} rssringoccs_CSVFile;
+
 /*  Data structure for the GEO.TAB files on the PDS.                          */
 typedef struct rssringoccs_GeoCSV {
     double *t_oet_spm_vals;
@@ -64,6 +87,9 @@ typedef struct rssringoccs_GeoCSV {
     unsigned long n_elements;
     rssringoccs_Bool error_occurred;
     char *error_message;
+    /*  If the arrays were read from a binary cache, they point into this     *
+     *  mapping, and are not freed individually. NULL otherwise.              */
+    rssringoccs_CSVFile *cache;
 } rssringoccs_GeoCSV;
 
 /*  Data structure for the DLP.TAB files on the PDS.                          */
@@ -84,6 +110,9 @@ typedef struct rssringoccs_DLPCSV {
     unsigned long n_elements;
     rssringoccs_Bool error_occurred;
     char *error_message;
+    /*  If the arrays were read from a binary cache, they point into this     *
+     *  mapping, and are not freed individually. NULL otherwise.              */
+    rssringoccs_CSVFile *cache;
 } rssringoccs_DLPCSV;
 
 /*  Data structure for the CAL.TAB files on the PDS.                          */
@@ -95,6 +124,9 @@ typedef struct rssringoccs_CalCSV {
     unsigned long n_elements;
     rssringoccs_Bool error_occurred;
     char *error_message;
+    /*  If the arrays were read from a binary cache, they point into this     *
+     *  mapping, and are not freed individually. NULL otherwise.              */
+    rssringoccs_CSVFile *cache;
 } rssringoccs_CalCSV;
 
 /*  Data structure for the TAU.TAB files on the PDS.                          */
@@ -115,6 +147,9 @@ typedef struct rssringoccs_TauCSV {
     unsigned long n_elements;
     rssringoccs_Bool error_occurred;
     char *error_message;
+    /*  If the arrays were read from a binary cache, they point into this     *
+     *  mapping, and are not freed individually. NULL otherwise.              */
+    rssringoccs_CSVFile *cache;
 } rssringoccs_TauCSV;
 
 /*  Data structure that contains all of the data from all four CSV formats    *
@@ -145,28 +180,159 @@ typedef struct rssringoccs_CSVData {
     double *tau_power;
     double *tau_vals;
     unsigned long n_elements;
+    /*  tau_rho, tau_vals, phase_vals, and power_vals are on the part of      *
+     *  rho_km_vals that the TAU file covers, which has this many points.     */
+    unsigned long n_tau_elements;
     rssringoccs_Bool error_occurred;
     char *error_message;
 } rssringoccs_CSVData;
 
+/*  Flags for the members of rssringoccs_CSVData that                         *
+ *  rssringoccs_Extract_CSV_Data_Window should extract. rho_km_vals is always *
+ *  extracted. RSSRINGOCCS_CSV_DATA_TAU selects tau_rho, tau_vals,            *
+ *  phase_vals, and power_vals.                                               */
+#define RSSRINGOCCS_CSV_DATA_B_RAD               0x00001UL
+#define RSSRINGOCCS_CSV_DATA_D_KM                0x00002UL
+#define RSSRINGOCCS_CSV_DATA_F_SKY_HZ            0x00004UL
+#define RSSRINGOCCS_CSV_DATA_P_NORM              0x00008UL
+#define RSSRINGOCCS_CSV_DATA_RAW_TAU             0x00010UL
+#define RSSRINGOCCS_CSV_DATA_PHASE_RAD           0x00020UL
+#define RSSRINGOCCS_CSV_DATA_PHI_RAD             0x00040UL
+#define RSSRINGOCCS_CSV_DATA_PHI_RL_RAD          0x00080UL
+#define RSSRINGOCCS_CSV_DATA_RAW_TAU_THRESHOLD   0x00100UL
+#define RSSRINGOCCS_CSV_DATA_RHO_CORR_POLE_KM    0x00200UL
+#define RSSRINGOCCS_CSV_DATA_RHO_CORR_TIMING_KM  0x00400UL
+#define RSSRINGOCCS_CSV_DATA_RHO_DOT_KMS         0x00800UL
+#define RSSRINGOCCS_CSV_DATA_RX_KM               0x01000UL
+#define RSSRINGOCCS_CSV_DATA_RY_KM               0x02000UL
+#define RSSRINGOCCS_CSV_DATA_RZ_KM               0x04000UL
+#define RSSRINGOCCS_CSV_DATA_T_OET_SPM           0x08000UL
+#define RSSRINGOCCS_CSV_DATA_T_RET_SPM           0x10000UL
+#define RSSRINGOCCS_CSV_DATA_T_SET_SPM           0x20000UL
+#define RSSRINGOCCS_CSV_DATA_TAU                 0x40000UL
+#define RSSRINGOCCS_CSV_DATA_ALL                 0x7FFFFUL
+
+/*  The members that are interpolated from the GEO file.                      */
+#define RSSRINGOCCS_CSV_DATA_GEO                                               \
+    (RSSRINGOCCS_CSV_DATA_D_KM  | RSSRINGOCCS_CSV_DATA_RHO_DOT_KMS |           \
+     RSSRINGOCCS_CSV_DATA_RX_KM | RSSRINGOCCS_CSV_DATA_RY_KM       |           \
+     RSSRINGOCCS_CSV_DATA_RZ_KM)
+
+/*  What the bounds of the window of rssringoccs_Extract_CSV_Data_Window are. */
+typedef enum {
+    rssringoccs_CSV_No_Window,
+    rssringoccs_CSV_Radius_Window,
+    rssringoccs_CSV_SPM_Window
+} rssringoccs_CSV_Window_Type;
+
+RSS_RINGOCCS_EXPORT extern rssringoccs_CSVFile *
+rssringoccs_Open_CSV(const char *filename);
+
+/*  Parses every row of csv into columns, an array of csv->n_columns pointers *
+ *  to arrays of csv->n_rows doubles. Columns whose pointer is NULL are       *
+ *  skipped. Errors are set in csv.                                           */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Read_CSV_Columns(rssringoccs_CSVFile *csv, double **columns);
+
+/*  As rssringoccs_Read_CSV_Columns, but parses only the n_rows rows starting *
+ *  at first_row, into arrays of n_rows doubles.                              */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Read_CSV_Rows(rssringoccs_CSVFile *csv, double **columns,
+                          unsigned long first_row, unsigned long n_rows);
+
+/*  Finds the rows of csv whose value in column key, which must be sorted,    *
+ *  lies in [start, end], and the rows just before and after them. Only the   *
+ *  key is parsed, and the search stops at the end of the window.             */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Find_CSV_Window(rssringoccs_CSVFile *csv, unsigned long key,
+                            double start, double end,
+                            unsigned long *first_row, unsigned long *n_rows);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Destroy_CSVFile(rssringoccs_CSVFile **csv);
+
+/*  Parses the number at the start of str, which ends before end, like        *
+ *  strtod but without reading past end. *stop is set to the first character  *
+ *  that was not used. The result is correctly rounded.                       */
+RSS_RINGOCCS_EXPORT extern double
+rssringoccs_CSV_Parse_Double(const char *str, const char *end,
+                             const char **stop);
+
+/*  Maps a file into memory, see rssringoccs_CSVFile. n_rows and n_columns    *
+ *  are left at zero. Errors are set in the returned struct.                  */
+RSS_RINGOCCS_EXPORT extern rssringoccs_CSVFile *
+rssringoccs_Map_CSVFile(const char *filename);
+
+/*  The binary cache of X.TAB is the file X.TAB followed by this suffix.      */
+#define RSSRINGOCCS_CSV_CACHE_SUFFIX ".cache"
+
+/*  Writes columns, n_columns arrays of n_rows doubles, to a binary cache.    *
+ *  kind names the type of .TAB file, such as "GEO". Columns whose pointer is *
+ *  NULL are left out. names and units may not be NULL. Returns true on       *
+ *  success.                                                                  */
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Write_CSV_Cache(const char *filename, const char *kind,
+                            const char * const *names,
+                            const char * const *units,
+                            double * const *columns,
+                            unsigned long n_columns, unsigned long n_rows);
+
+/*  Maps a binary cache of the given kind, and checks its header.             */
+RSS_RINGOCCS_EXPORT extern rssringoccs_CSVFile *
+rssringoccs_Open_CSV_Cache(const char *filename, const char *kind);
+
+/*  Returns a pointer to the column of a cache with the given name, or NULL   *
+ *  if the cache does not have it. No data is copied.                         */
+RSS_RINGOCCS_EXPORT extern double *
+rssringoccs_CSV_Cache_Column(const rssringoccs_CSVFile *cache,
+                             const char *name);
+
+/*  Returns the name of the binary cache of filename, which the caller must   *
+ *  free, if it exists and is not older than filename. NULL otherwise.        */
+RSS_RINGOCCS_EXPORT extern char *
+rssringoccs_Find_CSV_Cache(const char *filename);
+
 RSS_RINGOCCS_EXPORT extern rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename, rssringoccs_Bool use_deprecated);
 
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_GeoCSV_Members(rssringoccs_GeoCSV *geo);
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_GeoCSV(rssringoccs_GeoCSV **geo);
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Write_GeoCSV_Cache(const rssringoccs_GeoCSV *geo,
+                               const char *filename);
+RSS_RINGOCCS_EXPORT extern rssringoccs_GeoCSV *
+rssringoccs_Get_Geo_Cache(const char *filename,
+                          rssringoccs_Bool use_deprecated);
 
 RSS_RINGOCCS_EXPORT extern rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename, rssringoccs_Bool use_deprecated);
 
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_DLPCSV_Members(rssringoccs_DLPCSV *dlp);
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_DLPCSV(rssringoccs_DLPCSV **dlp);
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Write_DLPCSV_Cache(const rssringoccs_DLPCSV *dlp,
+                               const char *filename);
+RSS_RINGOCCS_EXPORT extern rssringoccs_DLPCSV *
+rssringoccs_Get_DLP_Cache(const char *filename,
+                          rssringoccs_Bool use_deprecated);
 
 RSS_RINGOCCS_EXPORT extern rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename);
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_CalCSV_Members(rssringoccs_CalCSV *cal);
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_CalCSV(rssringoccs_CalCSV **cal);
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Write_CalCSV_Cache(const rssringoccs_CalCSV *cal,
+                               const char *filename);
+RSS_RINGOCCS_EXPORT extern rssringoccs_CalCSV *
+rssringoccs_Get_Cal_Cache(const char *filename);
 
 RSS_RINGOCCS_EXPORT extern rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename, rssringoccs_Bool use_deprecated);
 
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_TauCSV_Members(rssringoccs_TauCSV *dlp);
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_TauCSV(rssringoccs_TauCSV **dlp);
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Write_TauCSV_Cache(const rssringoccs_TauCSV *tau,
+                               const char *filename);
+RSS_RINGOCCS_EXPORT extern rssringoccs_TauCSV *
+rssringoccs_Get_Tau_Cache(const char *filename,
+                          rssringoccs_Bool use_deprecated);
 
 RSS_RINGOCCS_EXPORT extern rssringoccs_CSVData* rssringoccs_Extract_CSV_Data(const char *geo,
                              const char *cal,
@@ -174,6 +340,17 @@ RSS_RINGOCCS_EXPORT extern rssringoccs_CSVData* rssringoccs_Extract_CSV_Data(con
                              const char *tau,
                              rssringoccs_Bool use_deprecated);
 
+/*  Extracts the members selected by columns, a bitwise or of the             *
+ *  RSSRINGOCCS_CSV_DATA_* flags, for the DLP points in [start, end]. Only    *
+ *  the columns and rows needed are read from each file.                      */
+RSS_RINGOCCS_EXPORT extern rssringoccs_CSVData *
+rssringoccs_Extract_CSV_Data_Window(const char *geo, const char *cal,
+                                    const char *dlp, const char *tau,
+                                    rssringoccs_Bool use_deprecated,
+                                    unsigned long columns,
+                                    rssringoccs_CSV_Window_Type window,
+                                    double start, double end);
+
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Destroy_CSV_Members(rssringoccs_CSVData *csv);
 
 #endif
@@ -7,6 +7,88 @@
 #include <rss_ringoccs/include/rss_ringoccs_bool.h>
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 
+/*  Flags for rssringoccs_FFT_Plan_Create. By default the inverse transform   *
+ *  is scaled by 1/N. RSSRINGOCCS_FFT_UNNORMALIZED skips this. For powers of  *
+ *  two the default is radix-4, and RSSRINGOCCS_FFT_RADIX_2 and               *
+ *  RSSRINGOCCS_FFT_SPLIT_RADIX select the other two algorithms. Plans made   *
+ *  with RSSRINGOCCS_FFT_REAL_INPUT transform N real numbers and are run with *
+ *  rssringoccs_FFT_Plan_Execute_Real.                                        */
+#define RSSRINGOCCS_FFT_DEFAULT      0x0U
+#define RSSRINGOCCS_FFT_UNNORMALIZED 0x1U
+#define RSSRINGOCCS_FFT_RADIX_2      0x2U
+#define RSSRINGOCCS_FFT_SPLIT_RADIX  0x4U
+#define RSSRINGOCCS_FFT_REAL_INPUT   0x8U
+
+/*  Largest number of factors of N used by a mixed-radix plan. N has at most  *
+ *  one factor for every bit, so 64 is enough for any unsigned long.          */
+#define RSSRINGOCCS_FFT_MAX_FACTORS 64
+
+/*  The algorithm a plan uses. This is chosen from N when the plan is made.   */
+typedef enum {
+    rssringoccs_FFT_Radix_2,
+    rssringoccs_FFT_Radix_4,
+    rssringoccs_FFT_Split_Radix,
+    rssringoccs_FFT_Mixed_Radix,
+    rssringoccs_FFT_Bluestein,
+    rssringoccs_FFT_Real
+} rssringoccs_FFT_Algorithm;
+
+/*  A plan holds everything about a transform of size N that does not depend  *
+ *  on the data, so that repeated transforms only pay for the butterflies.    *
+ *  A plan uses work space while it executes, so a plan must not be executed  *
+ *  by two threads at the same time. Make one plan per thread instead.        */
+typedef struct rssringoccs_FFT_Plan {
+    unsigned long N;
+    rssringoccs_Bool inverse;
+    unsigned int flags;
+    rssringoccs_FFT_Algorithm algorithm;
+
+    /*  Radix-2, radix-4, split-radix, and mixed-radix: the twiddle factors   *
+     *  exp(-/+ 2 pi i k / N) for k < N. Real plans only store k <= N/2.      *
+     *  Radix-2 and radix-4 also use the bit reversal permutation of N.       */
+    rssringoccs_ComplexDouble *twiddles;
+    unsigned long *bit_reverse;
+
+    /*  Mixed-radix: the factors of N, each 2, 3, 4, or 5, largest first.     */
+    unsigned long factors[RSSRINGOCCS_FFT_MAX_FACTORS];
+    unsigned int n_factors;
+
+    /*  Bluestein: the chirp exp(-/+ pi i n^2 / N) for n < N, the transform   *
+     *  of the conjugate chirp (scaled by 1/M), and a plan and work array of  *
+     *  size M, the smallest M >= 2N-1 whose only prime factors are 2, 3, 5.  *
+     *  Real plans use work and sub_plan for the complex transform of size    *
+     *  N/2, or size N if N is odd. Split-radix and mixed-radix plans use     *
+     *  work for transforms done in place.                                    */
+    rssringoccs_ComplexDouble *chirp;
+    rssringoccs_ComplexDouble *chirp_fft;
+    rssringoccs_ComplexDouble *work;
+    struct rssringoccs_FFT_Plan *sub_plan;
+} rssringoccs_FFT_Plan;
+
+/*  Creates a plan for a transform of size N. Returns NULL on failure.        */
+RSS_RINGOCCS_EXPORT extern rssringoccs_FFT_Plan *
+rssringoccs_FFT_Plan_Create(unsigned long N, rssringoccs_Bool inverse,
+                            unsigned int flags);
+
+/*  Computes the transform of in and stores it in out. in and out may be the  *
+ *  same array, in which case the transform is done in place.                 */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_FFT_Plan_Execute(rssringoccs_FFT_Plan *plan,
+                             const rssringoccs_ComplexDouble *in,
+                             rssringoccs_ComplexDouble *out);
+
+/*  Computes the transform of the N real numbers in, for a plan made with     *
+ *  RSSRINGOCCS_FFT_REAL_INPUT. The transform of real data is symmetric,      *
+ *  X_{N-k} = conj(X_k), so only the N/2+1 values X_0, ..., X_{N/2} are       *
+ *  stored in out.                                                            */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_FFT_Plan_Execute_Real(rssringoccs_FFT_Plan *plan, const double *in,
+                                  rssringoccs_ComplexDouble *out);
+
+/*  Frees a plan and everything it owns.                                      */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_FFT_Plan_Destroy(rssringoccs_FFT_Plan *plan);
+
 RSS_RINGOCCS_EXPORT extern rssringoccs_ComplexDouble* rssringoccs_Complex_FFT_Cooley_Tukey(rssringoccs_ComplexDouble *in,
                                      unsigned long N, rssringoccs_Bool inverse);
 
@@ -17,4 +99,7 @@ RSS_RINGOCCS_EXPORT extern rssringoccs_ComplexDouble* rssringoccs_Complex_FFT_Bl
 RSS_RINGOCCS_EXPORT extern rssringoccs_ComplexDouble* rssringoccs_Complex_FFT(rssringoccs_ComplexDouble *in,
                         unsigned long N, rssringoccs_Bool inverse);
 
+RSS_RINGOCCS_EXPORT extern rssringoccs_ComplexDouble *
+rssringoccs_Real_FFT(double *in, unsigned long N, rssringoccs_Bool inverse);
+
 #endif
@@ -107,6 +107,45 @@ rssringoccs_Double_Newton_Raphson_Fresnel_Ellipse(double k, double r,
                                                   double rx, double ry,
                                                   double rz);
 
+/*  Number of points the batched Newton-Raphson routines do at a time.       */
+#define RSSRINGOCCS_NEWTON_LANES 8UL
+
+/*--------------Batched Newton-Raphson for a Window of Points-----------------*/
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Newton_Raphson_Fresnel_Psi_Array(double k, double r,
+                                                    const double *r0,
+                                                    const double *phi0,
+                                                    double B, double D,
+                                                    double EPS,
+                                                    unsigned char toler,
+                                                    double *phi, double *psi,
+                                                    unsigned long n_pts);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Newton_Raphson_Fresnel_Psi_D_Array(double k, double r,
+                                                      const double *r0,
+                                                      const double *phi0,
+                                                      double B, double EPS,
+                                                      unsigned char toler,
+                                                      double rx, double ry,
+                                                      double rz, double *phi,
+                                                      double *psi,
+                                                      unsigned long n_pts);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Newton_Raphson_Fresnel_Ellipse_Array(double k, double r,
+                                                        const double *r0,
+                                                        const double *phi0,
+                                                        double B, double ecc,
+                                                        double peri,
+                                                        double EPS,
+                                                        unsigned char toler,
+                                                        double rx, double ry,
+                                                        double rz,
+                                                        double *phi,
+                                                        double *psi,
+                                                        unsigned long n_pts);
+
 /*  Fresnel scale.  */
 RSS_RINGOCCS_EXPORT extern float
 rssringoccs_Float_Fresnel_Scale(float lambda, float d, float phi, float b);
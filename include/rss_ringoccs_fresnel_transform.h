@@ -7,156 +7,218 @@
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
+/*  The Riemann sums are computed in blocks of this many points. The Fresnel  *
+ *  kernel for a block is stored on the stack, then summed against T_in.      */
+#define RSSRINGOCCS_FRESNEL_BLOCK_SIZE 64
+
+/*  Computes ker = w_func exp(-i psi) for n_pts points, split into real and   *
+ *  imaginary parts, and adds the sum of ker to norm if norm is not NULL.     */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Fresnel_Kernel_Block(const double *psi, const double *w_func,
+                                 double *ker_re, double *ker_im,
+                                 unsigned long n_pts,
+                                 rssringoccs_ComplexDouble *norm);
+
+/*  Same as rssringoccs_Fresnel_Kernel_Block for psi[n] = a (j0 - n)^2, the   *
+ *  quadratic Fresnel kernel, using a recurrence in place of sin and cos.     */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Fresnel_Quadratic_Kernel_Block(double a, unsigned long j0,
+                                           const double *w_func,
+                                           double *ker_re, double *ker_im,
+                                           unsigned long n_pts,
+                                           rssringoccs_ComplexDouble *norm);
+
+/*  Adds the sum of ker[n] T_in[first + n*T_step] for 0 <= n < n_pts to      *
+ *  T_out[center], reading T_in_re and T_in_im instead of T_in if they exist. */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Fresnel_Riemann_Block(rssringoccs_TAUObj *tau,
+                                  const double *ker_re, const double *ker_im,
+                                  unsigned long first, long T_step,
+                                  unsigned long n_pts, unsigned long center);
+
+/*  Single precision versions of rssringoccs_Fresnel_Kernel_Block and         *
+ *  rssringoccs_Fresnel_Riemann_Block, used if tau->use_float is set.         */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Fresnel_Kernel_Block_Float(const double *psi, const double *w_func,
+                                       float *ker_re, float *ker_im,
+                                       unsigned long n_pts,
+                                       rssringoccs_ComplexDouble *norm);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Fresnel_Riemann_Block_Float(rssringoccs_TAUObj *tau,
+                                        const float *ker_re,
+                                        const float *ker_im,
+                                        unsigned long first, long T_step,
+                                        unsigned long n_pts,
+                                        unsigned long center);
+
 RSS_RINGOCCS_EXPORT extern void
-Fresnel_Transform_Double(rssringoccs_TAUObj *tau, double *x_arr, double *w_func,
-                         unsigned long n_pts, unsigned long center);
+Fresnel_Transform_Double(rssringoccs_TAUObj *tau, double *x_arr,
+                         const double *w_func, unsigned long n_pts,
+                         unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Norm_Double(rssringoccs_TAUObj *tau, double *x_arr,
-                              double *w_func, unsigned long n_pts,
+                              const double *w_func, unsigned long n_pts,
                               unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Legendre_Even_Double(rssringoccs_TAUObj *tau, double *x_arr,
-                                       double *w_func, double *coeffs,
+                                       const double *w_func, double *coeffs,
                                        unsigned long n_pts,
                                        unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Legendre_Norm_Even_Double(rssringoccs_TAUObj *tau,
-                                            double *x_arr, double *w_func,
+                                            double *x_arr, const double *w_func,
                                             double *coeffs, unsigned long n_pts,
                                             unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Legendre_Odd_Double(rssringoccs_TAUObj *tau, double *x_arr,
-                                      double *w_func, double *coeffs,
+                                      const double *w_func, double *coeffs,
                                       unsigned long n_pts,
                                       unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Legendre_Norm_Odd_Double(rssringoccs_TAUObj *tau,
-                                           double *x_arr, double *w_func,
+                                           double *x_arr, const double *w_func,
                                            double *coeffs, unsigned long n_pts,
                                            unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_Double(rssringoccs_TAUObj *tau,
-                                double *w_func,
+                                const double *w_func,
                                 unsigned long n_pts,
                                 unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_Norm_Double(rssringoccs_TAUObj *tau,
-                                     double *w_func,
+                                     const double *w_func,
                                      unsigned long n_pts,
                                      unsigned long center);
 
+/*  Newton-Raphson transforms that start each root search from the values in  *
+ *  phi_warm, and store the stationary values found there on output.          */
+RSS_RINGOCCS_EXPORT extern void
+Fresnel_Transform_Newton_Warm_Double(rssringoccs_TAUObj *tau,
+                                     const double *w_func,
+                                     unsigned long n_pts,
+                                     unsigned long center,
+                                     double *phi_warm);
+
+RSS_RINGOCCS_EXPORT extern void
+Fresnel_Transform_Newton_Warm_Norm_Double(rssringoccs_TAUObj *tau,
+                                          const double *w_func,
+                                          unsigned long n_pts,
+                                          unsigned long center,
+                                          double *phi_warm);
+
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_D_Double(rssringoccs_TAUObj *tau,
-                                  double *w_func,
+                                  const double *w_func,
                                   unsigned long n_pts,
                                   unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_D_Norm_Double(rssringoccs_TAUObj *tau,
-                                       double *w_func,
+                                       const double *w_func,
                                        unsigned long n_pts,
                                        unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_D_Old_Double(rssringoccs_TAUObj *tau,
-                                      double *w_func,
+                                      const double *w_func,
                                       unsigned long n_pts,
                                       unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_D_Old_Norm_Double(rssringoccs_TAUObj *tau,
-                                           double *w_func,
+                                           const double *w_func,
                                            unsigned long n_pts,
                                            unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_dD_dphi_Double(rssringoccs_TAUObj *tau,
-                                        double *w_func,
+                                        const double *w_func,
                                         unsigned long n_pts,
                                         unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Newton_dD_dphi_Norm_Double(rssringoccs_TAUObj *tau,
-                                             double *w_func,
+                                             const double *w_func,
                                              unsigned long n_pts,
                                              unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Perturbed_Newton_Double(rssringoccs_TAUObj *tau,
-                                          double *w_func,
+                                          const double *w_func,
                                           unsigned long n_pts,
                                           unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Perturbed_Newton_Norm_Double(rssringoccs_TAUObj *tau,
-                                               double *w_func,
+                                               const double *w_func,
                                                unsigned long n_pts,
                                                unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Quadratic_Double(rssringoccs_TAUObj *tau,
-                                   double *w_func,
+                                   const double *w_func,
                                    unsigned long n_pts,
                                    unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Quadratic_Norm_Double(rssringoccs_TAUObj *tau,
-                                        double *w_func,
+                                        const double *w_func,
                                         unsigned long n_pts,
                                         unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Cubic_Double(rssringoccs_TAUObj *tau,
-                               double *w_func,
+                               const double *w_func,
                                unsigned long n_pts,
                                unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Cubic_Norm_Double(rssringoccs_TAUObj *tau,
-                                    double *w_func,
+                                    const double *w_func,
                                     unsigned long n_pts,
                                     unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Quartic_Double(rssringoccs_TAUObj *tau,
-                                 double *w_func,
+                                 const double *w_func,
                                  unsigned long n_pts,
                                  unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Quartic_Norm_Double(rssringoccs_TAUObj *tau,
-                                      double *w_func,
+                                      const double *w_func,
                                       unsigned long n_pts,
                                       unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Quartic_D_Double(rssringoccs_TAUObj *tau,
-                                   double *w_func,
+                                   const double *w_func,
                                    unsigned long n_pts,
                                    unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Quartic_D_Norm_Double(rssringoccs_TAUObj *tau,
-                                        double *w_func,
+                                        const double *w_func,
                                         unsigned long n_pts,
                                         unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Ellipse_Double(rssringoccs_TAUObj *tau,
-                                 double *w_func,
+                                 const double *w_func,
                                  unsigned long n_pts,
                                  unsigned long center);
 
 RSS_RINGOCCS_EXPORT extern void
 Fresnel_Transform_Ellipse_Norm_Double(rssringoccs_TAUObj *tau,
-                                      double *w_func,
+                                      const double *w_func,
                                       unsigned long n_pts,
                                       unsigned long center);
 
@@ -355,6 +355,25 @@ RSS_RINGOCCS_EXPORT extern float rssringoccs_Float_Sin(float x);
 RSS_RINGOCCS_EXPORT extern double rssringoccs_Double_Sin(double x);
 RSS_RINGOCCS_EXPORT extern long double rssringoccs_LDouble_Sin(long double x);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_Double_SinCos                                             *
+ *  Purpose:                                                                  *
+ *      Computes the sine and cosine of a real number, reducing x modulo pi/2 *
+ *      only once.                                                            *
+ *  Arguments:                                                                *
+ *      double x:                                                             *
+ *          A real number.                                                    *
+ *      double *sin_x:                                                        *
+ *          Pointer to where sin(x) is stored.                                *
+ *      double *cos_x:                                                        *
+ *          Pointer to where cos(x) is stored.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_SinCos(double x, double *sin_x, double *cos_x);
+
 /*  Aliases for the cosine tan function found in math.h.                      */
 RSS_RINGOCCS_EXPORT extern float rssringoccs_Float_Tan(float x);
 RSS_RINGOCCS_EXPORT extern double rssringoccs_Double_Tan(double x);
@@ -375,6 +394,94 @@ RSS_RINGOCCS_EXPORT extern float rssringoccs_Float_Log(float x);
 RSS_RINGOCCS_EXPORT extern double rssringoccs_Double_Log(double x);
 RSS_RINGOCCS_EXPORT extern long double rssringoccs_LDouble_Log(long double x);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_Double_Sin_Array                                          *
+ *  Purpose:                                                                  *
+ *      Computes the sine of every element of an array. Cos, Exp, Log, and    *
+ *      Sqrt are similar. The loops are vectorized, with the instruction set  *
+ *      picked at runtime where RSSRINGOCCS_TARGET_CLONES is supported.       *
+ *  Arguments:                                                                *
+ *      const double *x:                                                      *
+ *          The input array.                                                  *
+ *      double *y:                                                            *
+ *          The output array, y[n] = sin(x[n]). This may be x itself.         *
+ *      unsigned long len:                                                    *
+ *          The number of elements of x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The _Strided versions take the step between the elements of x and of  *
+ *      y, which may be negative. y[n*y_step] = sin(x[n*x_step]).             *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Sin_Array(const double *x, double *y, unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Sin_Array_Strided(const double *x, long x_step,
+                                     double *y, long y_step,
+                                     unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Cos_Array(const double *x, double *y, unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Cos_Array_Strided(const double *x, long x_step,
+                                     double *y, long y_step,
+                                     unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Exp_Array(const double *x, double *y, unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Exp_Array_Strided(const double *x, long x_step,
+                                     double *y, long y_step,
+                                     unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Log_Array(const double *x, double *y, unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Log_Array_Strided(const double *x, long x_step,
+                                     double *y, long y_step,
+                                     unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Sqrt_Array(const double *x, double *y, unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_Sqrt_Array_Strided(const double *x, long x_step,
+                                      double *y, long y_step,
+                                      unsigned long len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_Double_SinCos_Array                                       *
+ *  Purpose:                                                                  *
+ *      Computes the sine and cosine of every element of an array, reducing   *
+ *      each element modulo pi/2 only once.                                   *
+ *  Arguments:                                                                *
+ *      const double *x:                                                      *
+ *          The input array.                                                  *
+ *      double *sin_x:                                                        *
+ *          The array for sin(x). This may be x itself.                       *
+ *      double *cos_x:                                                        *
+ *          The array for cos(x). This may be x itself, but not sin_x.        *
+ *      unsigned long len:                                                    *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_SinCos_Array(const double *x, double *sin_x, double *cos_x,
+                                unsigned long len);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Double_SinCos_Array_Strided(const double *x, long x_step,
+                                        double *sin_x, long sin_step,
+                                        double *cos_x, long cos_step,
+                                        unsigned long len);
+
 /*  Set INFINITY to the HUGE_VAL macro that is specified in math.h. Most      *
  *  implementations already have an INFINITY macro, but it is not required.   */
 #define rssringoccs_Infinity (HUGE_VAL)
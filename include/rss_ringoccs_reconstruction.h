@@ -23,14 +23,24 @@ typedef enum {
     rssringoccs_DR_QuarticD,
     rssringoccs_DR_SimpleFFT,
     rssringoccs_DR_Elliptical,
+    rssringoccs_DR_BlockFFT,
     rssringoccs_DR_None
 } rssringoccs_Psitype_Enum;
 
+/*  The number of members of a tau object that may point at arrays it does   *
+ *  not own, those of a DLP, see rssringoccs_Borrow_DLP_Data_To_Tau, or of    *
+ *  the input of rssringoccs_Reconstruction_Multi_Res, which lends T_in too.  */
+#define RSSRINGOCCS_TAU_BORROWED_ARRAYS 22
+
 /*  Structure that contains all of the necessary data.                        */
 typedef struct rssringoccs_TAUObj {
     rssringoccs_ComplexDouble *T_in;
     rssringoccs_ComplexDouble *T_out;
     rssringoccs_ComplexDouble *T_fwd;
+    double *T_in_re;
+    double *T_in_im;
+    float *T_in_re_f;
+    float *T_in_im_f;
     double *rho_km_vals;
     double *F_km_vals;
     double *phi_rad_vals;
@@ -70,13 +80,19 @@ typedef struct rssringoccs_TAUObj {
     double rng_req[2];
     double EPS;
     unsigned char toler;
+    double legendre_tol;
+    double legendre_err;
     unsigned long start;
     unsigned long n_used;
     unsigned long arr_size;
+    unsigned int num_threads;
     rssringoccs_window_func window_func;
     rssringoccs_Psitype_Enum psinum;
     rssringoccs_Bool use_norm;
     rssringoccs_Bool use_fwd;
+    rssringoccs_Bool use_view;
+    rssringoccs_Bool use_warm_start;
+    rssringoccs_Bool use_float;
     rssringoccs_Bool bfac;
     rssringoccs_Bool verbose;
     rssringoccs_Bool error_occurred;
@@ -84,13 +100,32 @@ typedef struct rssringoccs_TAUObj {
     char *wtype;
     char *psitype;
     unsigned char order;
+    char *arena;
+    unsigned long arena_size;
+    unsigned long arena_used;
+    double *borrowed[RSSRINGOCCS_TAU_BORROWED_ARRAYS];
+    unsigned int n_borrowed;
 } rssringoccs_TAUObj;
 
-typedef void (*rssringoccs_FresT)(rssringoccs_TAUObj *, double *,
+typedef void (*rssringoccs_FresT)(rssringoccs_TAUObj *, const double *,
                                   unsigned long, unsigned long);
 
+/*  Function pointer for reconstructing count points of a tau object starting *
+ *  at the index first. The window function in effect at first is the one     *
+ *  that was computed at the index w_center. Returns false on error.          */
+typedef rssringoccs_Bool
+(*rssringoccs_TauRangeFunc)(rssringoccs_TAUObj *tau, unsigned long first,
+                            unsigned long count, unsigned long w_center);
+
 RSS_RINGOCCS_EXPORT extern void rssringoccs_Reconstruction(rssringoccs_TAUObj *tau);
 
+/*  Reconstructs tau at each of the n_res resolutions in res, computing the   *
+ *  data that does not depend on the resolution once. Returns an array of     *
+ *  n_res new tau objects, which the caller destroys, and then frees.         */
+RSS_RINGOCCS_EXPORT extern rssringoccs_TAUObj **
+rssringoccs_Reconstruction_Multi_Res(rssringoccs_TAUObj *tau,
+                                     const double *res, unsigned long n_res);
+
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Tau_Set_WType(const char *wtype, rssringoccs_TAUObj *tau);
 
@@ -103,10 +138,22 @@ rssringoccs_Tau_Set_Range_From_String(const char *range,
 
 RSS_RINGOCCS_EXPORT extern rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DLPObj *dlp, double res);
 
+/*  Same as rssringoccs_Create_TAUObj, but the tau object points at the data  *
+ *  of the DLP instead of copying it. See rssringoccs_Borrow_DLP_Data_To_Tau. */
+RSS_RINGOCCS_EXPORT extern rssringoccs_TAUObj *
+rssringoccs_Create_TAUObj_Borrowed(rssringoccs_DLPObj *dlp, double res);
+
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Copy_DLP_Data_To_Tau(rssringoccs_DLPObj *dlp,
                                  rssringoccs_TAUObj *tau);
 
+/*  Points the members of tau at the arrays of dlp, copying only the phase.   *
+ *  The arrays of dlp are never written to, and must outlive tau, or at least *
+ *  the call to rssringoccs_Tau_Finish, which copies the part that is used.   */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Borrow_DLP_Data_To_Tau(rssringoccs_DLPObj *dlp,
+                                   rssringoccs_TAUObj *tau);
+
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Tau_Check_Data_Range(rssringoccs_TAUObj *dlp);
 
@@ -134,11 +181,91 @@ rssringoccs_Destroy_Tau_Members(rssringoccs_TAUObj *tau);
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Destroy_Tau(rssringoccs_TAUObj **tau);
 
+/*  The member arrays of a tau object are allocated from one slab, the        *
+ *  arena, and each starts on a RSSRINGOCCS_TAU_ARENA_ALIGN byte boundary.    *
+ *  A reconstruction allocates at most RSSRINGOCCS_TAU_ARENA_ARRAYS arrays of *
+ *  arr_size doubles, counting complex arrays twice.                          */
+#define RSSRINGOCCS_TAU_ARENA_ALIGN 64UL
+#define RSSRINGOCCS_TAU_ARENA_ARRAYS 34UL
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Arena_Init(rssringoccs_TAUObj *tau, unsigned long n_bytes);
+
+RSS_RINGOCCS_EXPORT extern void *
+rssringoccs_Tau_Arena_Alloc(rssringoccs_TAUObj *tau, unsigned long n_bytes);
+
+RSS_RINGOCCS_EXPORT extern void *
+rssringoccs_Tau_Arena_Calloc(rssringoccs_TAUObj *tau, unsigned long n_elements,
+                             unsigned long size);
+
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Tau_Arena_Owns(const rssringoccs_TAUObj *tau, const void *ptr);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Arena_Free(rssringoccs_TAUObj *tau, void *ptr);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Arena_Reset(rssringoccs_TAUObj *tau);
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Arena_Destroy(rssringoccs_TAUObj *tau);
+
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Tau_Is_Borrowed(const rssringoccs_TAUObj *tau, const void *ptr);
+
+/*  Replaces the borrowed array *ptr with a copy of its len elements starting *
+ *  at start, which tau owns and may write to. Does nothing if tau owns *ptr. */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Own_Array(rssringoccs_TAUObj *tau, double **ptr,
+                          unsigned long start, unsigned long len);
+
+/*  Same as rssringoccs_Tau_Own_Array, for a complex array, such as T_in.     */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Own_CArray(rssringoccs_TAUObj *tau,
+                           rssringoccs_ComplexDouble **ptr,
+                           unsigned long start, unsigned long len);
+
+/*  rssringoccs_Tau_Run_Range only starts a chunk at multiples of this many   *
+ *  points from tau->start. Any state a range function carries from point to  *
+ *  point must be reset at these points, for the output to be the same for    *
+ *  any number of threads.                                                    */
+#define RSSRINGOCCS_TAU_BLOCK_LENGTH 64UL
+
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Run_Range(rssringoccs_TAUObj *tau,
+                          rssringoccs_TauRangeFunc range_func,
+                          unsigned long n_samples, double two_dx);
+
+/*  Copies T_in into the split arrays T_in_re and T_in_im, if use_view is     *
+ *  true, and into the single precision T_in_re_f and T_in_im_f, if use_float *
+ *  is true.                                                                  */
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Tau_Build_View(rssringoccs_TAUObj *tau);
+
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Tau_Reset_Window(double *x_arr, double *w_func, double dx,
                              double width, long nw_pts,
                              rssringoccs_window_func fw);
 
+/*  Returns the window function fw sampled at nw_pts + 1 points, nw_pts odd,  *
+ *  in units of the sample spacing. Entries 1 to nw_pts are the window about  *
+ *  the center, and entries 0 to (nw_pts-1)/2 are the left half used by the   *
+ *  Fresnel and Legendre transforms. The arrays are shared and read-only.     *
+ *  If the cache is full the window is computed in *buffer instead, which     *
+ *  the caller frees. Returns NULL if malloc fails.                           */
+RSS_RINGOCCS_EXPORT extern const double *
+rssringoccs_Window_Cache_Get(rssringoccs_window_func fw, unsigned long nw_pts,
+                             double **buffer);
+
+/*  Frees every cached window. No window from the cache may be in use.        */
+RSS_RINGOCCS_EXPORT extern void rssringoccs_Window_Cache_Clear(void);
+
+/*  Returns true if the cache is locked, so that reconstructions may be run   *
+ *  on several threads at once. The lock is an OpenMP critical section, so    *
+ *  this is false if librssringoccs was built without OpenMP.                 */
+RSS_RINGOCCS_EXPORT extern rssringoccs_Bool
+rssringoccs_Window_Cache_Is_Thread_Safe(void);
+
 /*  Functions that compute the Fresnel Transform on a TAUObj instance.        */
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Diffraction_Correction_Fresnel(rssringoccs_TAUObj *tau);
@@ -152,4 +279,7 @@ rssringoccs_Diffraction_Correction_Newton(rssringoccs_TAUObj *tau);
 RSS_RINGOCCS_EXPORT extern void
 rssringoccs_Diffraction_Correction_SimpleFFT(rssringoccs_TAUObj *tau);
 
+RSS_RINGOCCS_EXPORT extern void
+rssringoccs_Diffraction_Correction_BlockFFT(rssringoccs_TAUObj *tau);
+
 #endif
@@ -133,7 +133,7 @@ rssringoccs_CDouble_Exp(rssringoccs_ComplexDouble z)
     /*  Declare necessary variables. C89 requires declarations at the top.    */
     rssringoccs_ComplexDouble exp_z;
     double real, imag;
-    double exp_real, exp_z_real, exp_z_imag;
+    double exp_real, exp_z_real, exp_z_imag, sin_imag, cos_imag;
 
     /*  Extract the real and imaginary part from z.                           */
     real = rssringoccs_CDouble_Real_Part(z);
@@ -157,8 +157,9 @@ rssringoccs_CDouble_Exp(rssringoccs_ComplexDouble z)
     /*  When we have non-zero imaginary part, resort to Euler's formula.      */
     else
     {
-        exp_z_real = exp_real * rssringoccs_Double_Cos(imag);
-        exp_z_imag = exp_real * rssringoccs_Double_Sin(imag);
+        rssringoccs_Double_SinCos(imag, &sin_imag, &cos_imag);
+        exp_z_real = exp_real * cos_imag;
+        exp_z_imag = exp_real * sin_imag;
     }
 
     /*  Use rssringoccs_CDouble_Rect to create the output and return.         */
@@ -0,0 +1,65 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                        rss_ringoccs_complex_expi                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Contains the source code for the complex exponential of a purely      *
+ *      imaginary number.                                                     *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_CDouble_Expi:                                             *
+ *  Purpose:                                                                  *
+ *      Computes exp(i theta) for a real number theta.                        *
+ *  Arguments:                                                                *
+ *      theta (double):                                                       *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      exp_i_theta (rssringoccs_ComplexDouble):                              *
+ *          The complex number cos(theta) + i sin(theta).                     *
+ *  Method:                                                                   *
+ *      Use Euler's formula with rssringoccs_Double_SinCos, which reduces     *
+ *      theta modulo pi/2 once for both the sine and the cosine. This is the  *
+ *      factor exp(-i psi) of the Fresnel kernel, with theta = -psi.          *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing rssringoccs_Double_SinCos.                 *
+ *  2.) rss_ringoccs_complex.h:                                               *
+ *          Header where complex types and function prototypes are defined.   *
+ ******************************************************************************/
+
+/*  Header file which contains rssringoccs_Double_SinCos.                     */
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+
+/*  Where the prototypes are declared and where complex types are defined.    */
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+
+/*  Compute exp(i theta) for real theta.                                      */
+RSS_RINGOCCS_EXPORT rssringoccs_ComplexDouble
+rssringoccs_CDouble_Expi(double theta)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    double sin_theta, cos_theta;
+
+    /*  Use Euler's formula, exp(i theta) = cos(theta) + i sin(theta).        */
+    rssringoccs_Double_SinCos(theta, &sin_theta, &cos_theta);
+    return rssringoccs_CDouble_Rect(cos_theta, sin_theta);
+}
+/*  End of rssringoccs_CDouble_Expi.                                          */
@@ -44,11 +44,12 @@ rssringoccs_CDouble_Polar(double r, double theta)
 {
     /*  Declare necessary variables. C89 requires declarations at the top.    */
     rssringoccs_ComplexDouble z;
-    double real, imag;
+    double real, imag, sin_theta, cos_theta;
 
     /*  Use Euler's formula for the polar representation of a complex number. */
-    real = r * rssringoccs_Double_Cos(theta);
-    imag = r * rssringoccs_Double_Sin(theta);
+    rssringoccs_Double_SinCos(theta, &sin_theta, &cos_theta);
+    real = r * cos_theta;
+    imag = r * sin_theta;
 
     /*  Use rssringoccs_CDouble_Rect to compute and return.             */
     z = rssringoccs_CDouble_Rect(real, imag);
@@ -25,6 +25,11 @@
 #   compiler "should" work, though it hasn't been tested.
 CC=gcc
 
+#   The reconstruction routines can split the work across several threads if
+#   rss_ringoccs is compiled with OpenMP. This is optional, set this to an
+#   empty string to build the single threaded version.
+OpenMPArgs="-fopenmp"
+
 echo -e "\nClearing older files..."
 rm -f *.so
 rm -f *.o
@@ -36,7 +41,7 @@ CompilerArgs3="-Wmissing-prototypes -Wold-style-definition -Winit-self"
 CompilerArgs4="-Wmissing-declarations -Wnull-dereference -Wwrite-strings" # -Wconversion -Wdouble-promotion"
 CompilerArgs5="-Wstrict-prototypes -I../../ -I./ -DNDEBUG -g -fPIC -O3 -flto -c"
 CompilerArgs="$CompilerArgs1 $CompilerArgs2 $CompilerArgs3"
-CompilerArgs="$CompilerArgs $CompilerArgs4 $CompilerArgs5"
+CompilerArgs="$CompilerArgs $CompilerArgs4 $CompilerArgs5 $OpenMPArgs"
 
 echo -e "\n\tCompiler Options:"
 echo -e "\t\t$CompilerArgs1"
@@ -44,6 +49,7 @@ echo -e "\t\t$CompilerArgs2"
 echo -e "\t\t$CompilerArgs3"
 echo -e "\t\t$CompilerArgs4"
 echo -e "\t\t$CompilerArgs5"
+echo -e "\t\t$OpenMPArgs"
 
 for dir in */; do
     echo -e "\n\tCompiling $dir"
@@ -60,7 +66,7 @@ for filename in ./*.o; do
     sharedobjectlist="$sharedobjectlist $filename"
 done
 
-$CC $sharedobjectlist -O3 -flto -shared -o librssringoccs.so -lm
+$CC $sharedobjectlist -O3 -flto -shared -o librssringoccs.so -lm $OpenMPArgs
 
 echo "Moving to /usr/local/lib/librssringoccs.so"
 sudo mv librssringoccs.so /usr/local/lib/librssringoccs.so
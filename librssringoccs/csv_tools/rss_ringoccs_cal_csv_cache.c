@@ -0,0 +1,209 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_cal_csv_cache                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Write and read binary caches of the CAL.TAB files on the PDS.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Write_CalCSV_Cache:                                       *
+ *  Purpose:                                                                  *
+ *      Writes the data in cal to a binary cache, see                         *
+ *      rss_ringoccs_csv_cache.c for the file format. The columns are named   *
+ *      after the members of rssringoccs_CalCSV, without the _vals suffix.    *
+ *  Arguments:                                                                *
+ *      cal (const rssringoccs_CalCSV *):                                     *
+ *          The data, usually from rssringoccs_Get_Cal.                       *
+ *      filename (const char *):                                              *
+ *          The path of the cache. For rssringoccs_Get_Cal to find it, this   *
+ *          is the path of the .TAB file followed by                          *
+ *          RSSRINGOCCS_CSV_CACHE_SUFFIX.                                     *
+ *  Output:                                                                   *
+ *      success (rssringoccs_Bool):                                           *
+ *          True if the cache was written.                                    *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Get_Cal_Cache:                                            *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Get_Cal, but reads a binary cache instead of a    *
+ *      .TAB file.                                                            *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path of the cache.                                            *
+ *  Output:                                                                   *
+ *      cal (rssringoccs_CalCSV *):                                           *
+ *          The data. Errors are set in error_occurred and error_message.     *
+ *  Method:                                                                   *
+ *      The cache is mapped with rssringoccs_Open_CSV_Cache, and the members  *
+ *      of cal point into the mapping, so nothing is copied or parsed.        *
+ *      rssringoccs_Destroy_CalCSV_Members unmaps it.                         *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc.                       *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for puts.                         *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  The number of columns in the CAL.TAB files.                               */
+#define RSSRINGOCCS_CAL_CACHE_COLUMNS 4
+
+/*  The name and units of each column, in the order of the .TAB file.         */
+static const char * const __cal_names[RSSRINGOCCS_CAL_CACHE_COLUMNS] = {
+    "t_oet_spm",
+    "f_sky_pred",
+    "f_sky_resid_fit",
+    "p_free"
+};
+
+static const char * const __cal_units[RSSRINGOCCS_CAL_CACHE_COLUMNS] = {
+    "s",
+    "Hz",
+    "Hz",
+    ""
+};
+
+/*  Points members[n] to the member of cal for column n.                      */
+static void __cal_members(rssringoccs_CalCSV *cal, double **members[])
+{
+    members[0] = &cal->t_oet_spm_vals;
+    members[1] = &cal->f_sky_pred_vals;
+    members[2] = &cal->f_sky_resid_fit_vals;
+    members[3] = &cal->p_free_vals;
+}
+
+/*  Function for writing the data from a CAL.TAB file to a binary cache.      */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Write_CalCSV_Cache(const rssringoccs_CalCSV *cal,
+                               const char *filename)
+{
+    double **members[RSSRINGOCCS_CAL_CACHE_COLUMNS];
+    double *columns[RSSRINGOCCS_CAL_CACHE_COLUMNS];
+    unsigned long n;
+
+    if (cal == NULL)
+        return rssringoccs_False;
+
+    if (cal->error_occurred)
+        return rssringoccs_False;
+
+    /*  The members are only read, so casting away const is safe.             */
+    __cal_members((rssringoccs_CalCSV *)cal, members);
+    for (n = 0; n < RSSRINGOCCS_CAL_CACHE_COLUMNS; ++n)
+        columns[n] = *members[n];
+
+    return rssringoccs_Write_CSV_Cache(filename, "CAL", __cal_names,
+                                       __cal_units, columns,
+                                       RSSRINGOCCS_CAL_CACHE_COLUMNS,
+                                       cal->n_elements);
+}
+/*  End of rssringoccs_Write_CalCSV_Cache.                                    */
+
+/*  Function for reading the data from a binary cache of a CAL.TAB file.      */
+RSS_RINGOCCS_EXPORT rssringoccs_CalCSV *
+rssringoccs_Get_Cal_Cache(const char *filename)
+{
+    rssringoccs_CalCSV *cal;
+    double **members[RSSRINGOCCS_CAL_CACHE_COLUMNS];
+    unsigned long n;
+    rssringoccs_Bool has_columns;
+
+    cal = (rssringoccs_CalCSV *)malloc(sizeof(*cal));
+
+    /*  Check if malloc failed.                                               */
+    if (cal == NULL)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\trssringoccs_Get_Cal_Cache\n\n"
+             "Malloc failed and returned NULL for cal. Returning.\n");
+        return NULL;
+    }
+
+    __cal_members(cal, members);
+    for (n = 0; n < RSSRINGOCCS_CAL_CACHE_COLUMNS; ++n)
+        *members[n] = NULL;
+
+    cal->n_elements = 0;
+    cal->error_occurred = rssringoccs_False;
+    cal->error_message = NULL;
+    cal->cache = rssringoccs_Open_CSV_Cache(filename, "CAL");
+
+    if (cal->cache == NULL)
+    {
+        cal->error_occurred = rssringoccs_True;
+        cal->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Cal_Cache\n\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "cache. Aborting computation and returning.\n"
+        );
+        return cal;
+    }
+
+    /*  Pass on the error from reading the cache.                             */
+    if (cal->cache->error_occurred)
+    {
+        cal->error_occurred = rssringoccs_True;
+        cal->error_message = cal->cache->error_message;
+        cal->cache->error_message = NULL;
+        rssringoccs_Destroy_CSVFile(&cal->cache);
+        return cal;
+    }
+
+    /*  The members point into the mapping.                                   */
+    for (n = 0; n < RSSRINGOCCS_CAL_CACHE_COLUMNS; ++n)
+        *members[n] = rssringoccs_CSV_Cache_Column(cal->cache,
+                                                   __cal_names[n]);
+
+    /*  Every column is needed.                                               */
+    has_columns = rssringoccs_True;
+    for (n = 0; n < RSSRINGOCCS_CAL_CACHE_COLUMNS; ++n)
+        if (*members[n] == NULL)
+            has_columns = rssringoccs_False;
+
+    if (!has_columns)
+    {
+        cal->error_occurred = rssringoccs_True;
+        cal->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Cal_Cache\n\n"
+            "Binary cache does not have the columns of a CAL.TAB file.\n"
+        );
+        rssringoccs_Destroy_CalCSV_Members(cal);
+        return cal;
+    }
+
+    cal->n_elements = cal->cache->n_rows;
+    return cal;
+}
+/*  End of rssringoccs_Get_Cal_Cache.                                         */
@@ -0,0 +1,501 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                           rss_ringoccs_csv_cache                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Write and read binary columnar caches of the .TAB files on the PDS,   *
+ *      so that they do not need to be parsed every time they are used.       *
+ ******************************************************************************
+ *                                FILE FORMAT                                 *
+ ******************************************************************************
+ *  Every integer is an unsigned little-endian integer, and every double is   *
+ *  a little-endian IEEE-754 double. Offsets are from the start of the file.  *
+ *                                                                            *
+ *      Offset  Size   Contents                                               *
+ *      0       8      The magic string "RSSCACHE".                           *
+ *      8       4      The version of the format, 1.                          *
+ *      12      4      The number of columns, n_columns.                      *
+ *      16      8      The number of rows, n_rows.                            *
+ *      24      8      The kind of file, such as "GEO", padded with zeros.    *
+ *      32      64     The first entry of the column table.                   *
+ *      ...                                                                   *
+ *                                                                            *
+ *  There are n_columns entries in the column table, each of which is         *
+ *                                                                            *
+ *      Offset  Size   Contents                                               *
+ *      0       40     The name of the column, padded with zeros.             *
+ *      40      16     The units of the column, padded with zeros.            *
+ *      56      8      The offset of the column.                              *
+ *                                                                            *
+ *  Each column is n_rows doubles, and starts on a multiple of 64 bytes, so   *
+ *  that the columns of a mapped file are aligned for vector loads.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Write_CSV_Cache:                                          *
+ *  Purpose:                                                                  *
+ *      Writes columns of data to a binary cache.                             *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path of the cache. The file is replaced if it exists.         *
+ *      kind (const char *):                                                  *
+ *          The type of the .TAB file, at most 7 characters.                  *
+ *      names (const char * const *):                                         *
+ *          The name of each column, at most 39 characters.                   *
+ *      units (const char * const *):                                         *
+ *          The units of each column, at most 15 characters.                  *
+ *      columns (double * const *):                                           *
+ *          The columns. Columns whose pointer is NULL are left out.          *
+ *      n_columns (unsigned long):                                            *
+ *          The number of elements of names, units, and columns.              *
+ *      n_rows (unsigned long):                                               *
+ *          The number of elements of each column.                            *
+ *  Output:                                                                   *
+ *      success (rssringoccs_Bool):                                           *
+ *          True if the cache was written. If not, the file is removed.       *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Open_CSV_Cache:                                           *
+ *  Purpose:                                                                  *
+ *      Maps a binary cache into memory with rssringoccs_Map_CSVFile, and     *
+ *      checks that its header is valid, that it is of the given kind, and    *
+ *      that every column lies inside the file. n_rows and n_columns are set  *
+ *      from the header. Errors are set in the returned struct.               *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_CSV_Cache_Column:                                         *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the column with the given name, or NULL if there *
+ *      is no such column. The pointer is into the mapping, and is valid     *
+ *      until the cache is destroyed.                                         *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Find_CSV_Cache:                                           *
+ *  Purpose:                                                                  *
+ *      Returns filename followed by RSSRINGOCCS_CSV_CACHE_SUFFIX if that     *
+ *      file exists and was not modified before filename, and NULL if not.    *
+ *      The caller frees the result.                                          *
+ *  NOTES:                                                                    *
+ *      1.) The columns are used in place, so a cache may only be read on a   *
+ *          host with little-endian IEEE-754 doubles. On other hosts          *
+ *          rssringoccs_Open_CSV_Cache returns an error, and the readers      *
+ *          parse the .TAB file instead. Caches may be written on any host.   *
+ *      2.) File times are only accurate to a second on some systems. A       *
+ *          cache written in the same second the .TAB file was modified is    *
+ *          treated as current.                                               *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for fopen, fwrite, and remove.    *
+ *  3.) string.h:                                                             *
+ *          C standard library header. Used for memcpy and strlen.            *
+ *  4.) limits.h:                                                             *
+ *          C standard library header. Used for ULONG_MAX.                    *
+ *  5.) time.h:                                                               *
+ *          C standard library header. Used for difftime.                     *
+ *  6.) sys/stat.h:                                                           *
+ *          Used for stat. Available on both unix-like systems and Windows.   *
+ *  7.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  8.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  stat is POSIX, not C89, and is hidden by -ansi.                           */
+#if defined(__unix__) || defined(__APPLE__)
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#endif
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  Sizes, in bytes, of the parts of the file. See the table above.           */
+#define RSSRINGOCCS_CACHE_VERSION 1UL
+#define RSSRINGOCCS_CACHE_HEADER_SIZE 32UL
+#define RSSRINGOCCS_CACHE_ENTRY_SIZE 64UL
+#define RSSRINGOCCS_CACHE_NAME_SIZE 40UL
+#define RSSRINGOCCS_CACHE_UNIT_SIZE 16UL
+#define RSSRINGOCCS_CACHE_KIND_SIZE 8UL
+#define RSSRINGOCCS_CACHE_ALIGN 64UL
+
+static const char __cache_magic[8] = {'R', 'S', 'S', 'C', 'A', 'C', 'H', 'E'};
+
+/*  Writes x to p as a little-endian integer of n_bytes bytes.                */
+static void __put_uint(unsigned char *p, unsigned long x, unsigned int n_bytes)
+{
+    unsigned int n;
+
+    for (n = 0U; n < n_bytes; ++n)
+    {
+        p[n] = (unsigned char)(x & 0xFFUL);
+        x >>= 8;
+    }
+}
+
+/*  Reads a little-endian integer of n_bytes bytes. Returns false if it does  *
+ *  not fit in an unsigned long.                                              */
+static rssringoccs_Bool
+__get_uint(const unsigned char *p, unsigned int n_bytes, unsigned long *x)
+{
+    *x = 0UL;
+
+    while (n_bytes > 0U)
+    {
+        --n_bytes;
+        if (*x > (ULONG_MAX >> 8))
+            return rssringoccs_False;
+
+        *x = (*x << 8) | (unsigned long)p[n_bytes];
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Returns true if doubles are little-endian IEEE-754, as in the file.       */
+static rssringoccs_Bool __host_is_little_endian(void)
+{
+    const double one = 1.0;
+    unsigned char bytes[sizeof(double)];
+
+    if (sizeof(double) != 8)
+        return rssringoccs_False;
+
+    memcpy(bytes, &one, sizeof(one));
+    if ((bytes[7] == 0x3FU) && (bytes[6] == 0xF0U) && (bytes[0] == 0x00U))
+        return rssringoccs_True;
+    else
+        return rssringoccs_False;
+}
+
+/*  Rounds n up to a multiple of RSSRINGOCCS_CACHE_ALIGN.                     */
+static unsigned long __align(unsigned long n)
+{
+    return (n + RSSRINGOCCS_CACHE_ALIGN - 1UL) /
+           RSSRINGOCCS_CACHE_ALIGN * RSSRINGOCCS_CACHE_ALIGN;
+}
+
+/*  Writes the n_rows doubles of column to fp in little-endian order.         */
+static rssringoccs_Bool
+__write_column(FILE *fp, const double *column, unsigned long n_rows)
+{
+    unsigned char bytes[sizeof(double)];
+    unsigned long n;
+    unsigned int m;
+
+    if (__host_is_little_endian())
+    {
+        if (fwrite(column, sizeof(*column), n_rows, fp) != n_rows)
+            return rssringoccs_False;
+        return rssringoccs_True;
+    }
+
+    /*  Byte swap each element. Only big-endian hosts get here.               */
+    for (n = 0; n < n_rows; ++n)
+    {
+        for (m = 0U; m < sizeof(double); ++m)
+            bytes[m] = ((const unsigned char *)&column[n])[sizeof(double)-1-m];
+
+        if (fwrite(bytes, 1, sizeof(bytes), fp) != sizeof(bytes))
+            return rssringoccs_False;
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Function for writing columns of data to a binary cache.                   */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Write_CSV_Cache(const char *filename, const char *kind,
+                            const char * const *names,
+                            const char * const *units,
+                            double * const *columns,
+                            unsigned long n_columns, unsigned long n_rows)
+{
+    unsigned char *header, *entry;
+    unsigned long header_size, column_size, offset, n, n_used;
+    static const unsigned char padding[RSSRINGOCCS_CACHE_ALIGN] = {0};
+    rssringoccs_Bool success;
+    FILE *fp;
+
+    if ((filename == NULL) || (kind == NULL) || (names == NULL) ||
+        (units == NULL) || (columns == NULL))
+        return rssringoccs_False;
+
+    if (strlen(kind) >= RSSRINGOCCS_CACHE_KIND_SIZE)
+        return rssringoccs_False;
+
+    /*  Count the columns that are present and check their names.             */
+    n_used = 0;
+    for (n = 0; n < n_columns; ++n)
+    {
+        if (columns[n] == NULL)
+            continue;
+
+        if ((strlen(names[n]) >= RSSRINGOCCS_CACHE_NAME_SIZE) ||
+            (strlen(units[n]) >= RSSRINGOCCS_CACHE_UNIT_SIZE))
+            return rssringoccs_False;
+
+        ++n_used;
+    }
+
+    /*  The format stores the number of columns in four bytes.                */
+    if (n_used > 0xFFFFFFFFUL)
+        return rssringoccs_False;
+
+    header_size = RSSRINGOCCS_CACHE_HEADER_SIZE +
+                  n_used * RSSRINGOCCS_CACHE_ENTRY_SIZE;
+    column_size = sizeof(double) * n_rows;
+
+    /*  calloc, so that the padding in the names is zero.                     */
+    header = (unsigned char *)calloc(__align(header_size), 1);
+    if (header == NULL)
+        return rssringoccs_False;
+
+    memcpy(header, __cache_magic, sizeof(__cache_magic));
+    __put_uint(header + 8, RSSRINGOCCS_CACHE_VERSION, 4U);
+    __put_uint(header + 12, n_used, 4U);
+    __put_uint(header + 16, n_rows, 8U);
+    memcpy(header + 24, kind, strlen(kind));
+
+    /*  The column table. The columns follow the header, in order.            */
+    entry = header + RSSRINGOCCS_CACHE_HEADER_SIZE;
+    offset = __align(header_size);
+    for (n = 0; n < n_columns; ++n)
+    {
+        if (columns[n] == NULL)
+            continue;
+
+        memcpy(entry, names[n], strlen(names[n]));
+        memcpy(entry + RSSRINGOCCS_CACHE_NAME_SIZE, units[n], strlen(units[n]));
+        __put_uint(entry + RSSRINGOCCS_CACHE_NAME_SIZE +
+                   RSSRINGOCCS_CACHE_UNIT_SIZE, offset, 8U);
+        entry += RSSRINGOCCS_CACHE_ENTRY_SIZE;
+        offset += __align(column_size);
+    }
+
+    fp = fopen(filename, "wb");
+    if (fp == NULL)
+    {
+        free(header);
+        return rssringoccs_False;
+    }
+
+    success = (fwrite(header, 1, __align(header_size), fp) ==
+               __align(header_size));
+
+    for (n = 0; (n < n_columns) && success; ++n)
+    {
+        if (columns[n] == NULL)
+            continue;
+
+        success = __write_column(fp, columns[n], n_rows);
+        if (success)
+        {
+            offset = __align(column_size) - column_size;
+            success = (fwrite(padding, 1, offset, fp) == offset);
+        }
+    }
+
+    free(header);
+    if (fclose(fp) != 0)
+        success = rssringoccs_False;
+
+    /*  Do not leave a partial cache behind.                                  */
+    if (!success)
+        remove(filename);
+
+    return success;
+}
+/*  End of rssringoccs_Write_CSV_Cache.                                       */
+
+/*  Sets the error of cache and returns it.                                   */
+static rssringoccs_CSVFile *
+__cache_error(rssringoccs_CSVFile *cache, const char *message)
+{
+    cache->error_occurred = rssringoccs_True;
+    cache->error_message = rssringoccs_strdup(message);
+    return cache;
+}
+
+/*  Function for mapping a binary cache and checking its header.              */
+RSS_RINGOCCS_EXPORT rssringoccs_CSVFile *
+rssringoccs_Open_CSV_Cache(const char *filename, const char *kind)
+{
+    rssringoccs_CSVFile *cache;
+    const unsigned char *data, *entry;
+    unsigned long version, n_columns, n_rows, offset, n;
+    char file_kind[RSSRINGOCCS_CACHE_KIND_SIZE + 1];
+
+    cache = rssringoccs_Map_CSVFile(filename);
+    if (cache == NULL)
+        return cache;
+
+    if (cache->error_occurred)
+        return cache;
+
+    if (!__host_is_little_endian())
+        return __cache_error(
+            cache,
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Open_CSV_Cache\n\n"
+            "Binary caches can only be read on little-endian hosts.\n"
+        );
+
+    data = (const unsigned char *)cache->data;
+
+    if ((cache->size < RSSRINGOCCS_CACHE_HEADER_SIZE) ||
+        (memcmp(data, __cache_magic, sizeof(__cache_magic)) != 0))
+        return __cache_error(
+            cache,
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Open_CSV_Cache\n\n"
+            "File is not an rss_ringoccs binary cache.\n"
+        );
+
+    __get_uint(data + 8, 4U, &version);
+    __get_uint(data + 12, 4U, &n_columns);
+    memcpy(file_kind, data + 24, RSSRINGOCCS_CACHE_KIND_SIZE);
+    file_kind[RSSRINGOCCS_CACHE_KIND_SIZE] = '\0';
+
+    if (version != RSSRINGOCCS_CACHE_VERSION)
+        return __cache_error(
+            cache,
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Open_CSV_Cache\n\n"
+            "Binary cache has an unknown version.\n"
+        );
+
+    if ((kind != NULL) && (strcmp(file_kind, kind) != 0))
+        return __cache_error(
+            cache,
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Open_CSV_Cache\n\n"
+            "Binary cache holds a different kind of .TAB file.\n"
+        );
+
+    /*  Every column must lie inside the file.                                */
+    if ((!__get_uint(data + 16, 8U, &n_rows)) ||
+        (n_columns > (cache->size - RSSRINGOCCS_CACHE_HEADER_SIZE) /
+                     RSSRINGOCCS_CACHE_ENTRY_SIZE))
+        return __cache_error(
+            cache,
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Open_CSV_Cache\n\n"
+            "Binary cache is truncated or corrupted.\n"
+        );
+
+    entry = data + RSSRINGOCCS_CACHE_HEADER_SIZE;
+    for (n = 0; n < n_columns; ++n)
+    {
+        if ((!__get_uint(entry + RSSRINGOCCS_CACHE_NAME_SIZE +
+                         RSSRINGOCCS_CACHE_UNIT_SIZE, 8U, &offset)) ||
+            (offset % sizeof(double) != 0) || (offset > cache->size) ||
+            (n_rows > (cache->size - offset) / sizeof(double)) ||
+            (entry[RSSRINGOCCS_CACHE_NAME_SIZE - 1] != 0))
+            return __cache_error(
+                cache,
+                "Error Encountered: rss_ringoccs\n"
+                "\trssringoccs_Open_CSV_Cache\n\n"
+                "Binary cache is truncated or corrupted.\n"
+            );
+
+        entry += RSSRINGOCCS_CACHE_ENTRY_SIZE;
+    }
+
+    cache->n_rows = n_rows;
+    cache->n_columns = n_columns;
+    return cache;
+}
+/*  End of rssringoccs_Open_CSV_Cache.                                        */
+
+/*  Function for finding a column of a binary cache by name.                  */
+RSS_RINGOCCS_EXPORT double *
+rssringoccs_CSV_Cache_Column(const rssringoccs_CSVFile *cache,
+                             const char *name)
+{
+    const unsigned char *entry;
+    unsigned long offset, n;
+
+    if ((cache == NULL) || (name == NULL))
+        return NULL;
+
+    if (cache->error_occurred)
+        return NULL;
+
+    entry = (const unsigned char *)cache->data + RSSRINGOCCS_CACHE_HEADER_SIZE;
+    for (n = 0; n < cache->n_columns; ++n)
+    {
+        if (strcmp((const char *)entry, name) == 0)
+        {
+            __get_uint(entry + RSSRINGOCCS_CACHE_NAME_SIZE +
+                       RSSRINGOCCS_CACHE_UNIT_SIZE, 8U, &offset);
+            return (double *)(cache->data + offset);
+        }
+
+        entry += RSSRINGOCCS_CACHE_ENTRY_SIZE;
+    }
+
+    return NULL;
+}
+/*  End of rssringoccs_CSV_Cache_Column.                                      */
+
+/*  Function for finding an up to date binary cache of a file.                */
+RSS_RINGOCCS_EXPORT char *rssringoccs_Find_CSV_Cache(const char *filename)
+{
+    struct stat file_stats, cache_stats;
+    unsigned long length;
+    char *cache_name;
+
+    if (filename == NULL)
+        return NULL;
+
+    length = (unsigned long)strlen(filename);
+    cache_name = (char *)malloc(length + sizeof(RSSRINGOCCS_CSV_CACHE_SUFFIX));
+    if (cache_name == NULL)
+        return NULL;
+
+    memcpy(cache_name, filename, length);
+    memcpy(cache_name + length, RSSRINGOCCS_CSV_CACHE_SUFFIX,
+           sizeof(RSSRINGOCCS_CSV_CACHE_SUFFIX));
+
+    if ((stat(filename, &file_stats) != 0) ||
+        (stat(cache_name, &cache_stats) != 0) ||
+        (difftime(cache_stats.st_mtime, file_stats.st_mtime) < 0.0))
+    {
+        free(cache_name);
+        return NULL;
+    }
+
+    return cache_name;
+}
+/*  End of rssringoccs_Find_CSV_Cache.                                        */
@@ -0,0 +1,210 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                      rss_ringoccs_csv_parse_double                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Parse a decimal number from a buffer that need not be NUL terminated. *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_CSV_Parse_Double:                                         *
+ *  Purpose:                                                                  *
+ *      Converts the number at the start of str to a double.                  *
+ *  Arguments:                                                                *
+ *      str (const char *):                                                   *
+ *          The start of the number. Leading spaces and tabs are skipped.     *
+ *      end (const char *):                                                   *
+ *          One past the last character that may be read.                     *
+ *      stop (const char **):                                                 *
+ *          Set to the first character after the number. If there is no      *
+ *          number, this is str, as with strtod.                              *
+ *  Output:                                                                   *
+ *      x (double):                                                           *
+ *          The number, correctly rounded to double. 0 if there is none.      *
+ *  Method:                                                                   *
+ *      The digits are read into a double m, ignoring the decimal point, and  *
+ *      the number is m * 10^e. If m is at most 2^53 every step of reading    *
+ *      it is exact. If also |e| <= 22, 10^e is exact, and m * 10^e or        *
+ *      m / 10^-e is a single correctly rounded operation (Clinger's fast     *
+ *      path). The columns of the PDS .TAB files have at most 16 significant  *
+ *      digits, so nearly every field takes this path. Anything else, long    *
+ *      mantissas, large exponents, inf and nan, is copied to a NUL           *
+ *      terminated buffer and passed to strtod.                               *
+ *  NOTES:                                                                    *
+ *      1.) The fast path needs double arithmetic to be done in double, and   *
+ *          is not used where FLT_EVAL_METHOD is not 0, as with the x87.      *
+ *      2.) Fields longer than RSSRINGOCCS_CSV_MAX_FIELD characters are       *
+ *          truncated before they are passed to strtod.                       *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for strtod.                       *
+ *  2.) float.h:                                                              *
+ *          C standard library header. Used for FLT_EVAL_METHOD.              *
+ *  3.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <float.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  Longest field, in characters, handed to strtod.                           */
+#define RSSRINGOCCS_CSV_MAX_FIELD 127
+
+/*  FLT_EVAL_METHOD is C99. gcc and clang also predefine it in C89 mode, and  *
+ *  64-bit MSVC always rounds to double.                                      */
+#if defined(FLT_EVAL_METHOD)
+#if FLT_EVAL_METHOD == 0
+#define RSSRINGOCCS_CSV_FAST_PATH
+#endif
+#elif defined(__FLT_EVAL_METHOD__)
+#if __FLT_EVAL_METHOD__ == 0
+#define RSSRINGOCCS_CSV_FAST_PATH
+#endif
+#elif defined(_M_X64) || defined(_M_ARM64)
+#define RSSRINGOCCS_CSV_FAST_PATH
+#endif
+
+/*  The powers of ten that are exactly representable as doubles.              */
+static const double __pow_10[23] = {
+    1.0E0,  1.0E1,  1.0E2,  1.0E3,  1.0E4,  1.0E5,  1.0E6,  1.0E7,
+    1.0E8,  1.0E9,  1.0E10, 1.0E11, 1.0E12, 1.0E13, 1.0E14, 1.0E15,
+    1.0E16, 1.0E17, 1.0E18, 1.0E19, 1.0E20, 1.0E21, 1.0E22
+};
+
+/*  Copies [str, end) to a buffer and calls strtod on it.                     */
+static double __slow_path(const char *str, const char *end, const char **stop)
+{
+    char buffer[RSSRINGOCCS_CSV_MAX_FIELD + 1];
+    char *buffer_stop;
+    unsigned long n, len;
+    double x;
+
+    len = (unsigned long)(end - str);
+    if (len > RSSRINGOCCS_CSV_MAX_FIELD)
+        len = RSSRINGOCCS_CSV_MAX_FIELD;
+
+    for (n = 0; n < len; ++n)
+        buffer[n] = str[n];
+
+    buffer[len] = '\0';
+    x = strtod(buffer, &buffer_stop);
+    *stop = str + (buffer_stop - buffer);
+    return x;
+}
+
+/*  Function for parsing a number from a buffer that is not NUL terminated.   */
+RSS_RINGOCCS_EXPORT double
+rssringoccs_CSV_Parse_Double(const char *str, const char *end,
+                             const char **stop)
+{
+    const char *p, *start;
+    double m, x;
+    long e, exp_val;
+    int exp_sign;
+    rssringoccs_Bool negative, has_digits;
+
+    p = str;
+    while ((p < end) && ((*p == ' ') || (*p == '\t')))
+        ++p;
+
+    start = p;
+    negative = rssringoccs_False;
+    has_digits = rssringoccs_False;
+
+    if ((p < end) && ((*p == '-') || (*p == '+')))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    /*  The digits before and after the decimal point.                        */
+    m = 0.0;
+    e = 0;
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
+    {
+        m = 10.0*m + (double)(*p - '0');
+        has_digits = rssringoccs_True;
+        ++p;
+    }
+
+    if ((p < end) && (*p == '.'))
+    {
+        ++p;
+        while ((p < end) && (*p >= '0') && (*p <= '9'))
+        {
+            m = 10.0*m + (double)(*p - '0');
+            has_digits = rssringoccs_True;
+            --e;
+            ++p;
+        }
+    }
+
+    /*  No digits. This may be inf or nan, or not a number at all.            */
+    if (!has_digits)
+        return __slow_path(start, end, stop);
+
+    /*  The exponent. A lone e is not part of the number.                     */
+    if ((p < end) && ((*p == 'e') || (*p == 'E')))
+    {
+        const char *q = p + 1;
+        exp_sign = 1;
+        exp_val = 0;
+
+        if ((q < end) && ((*q == '-') || (*q == '+')))
+        {
+            exp_sign = (*q == '-') ? -1 : 1;
+            ++q;
+        }
+
+        if ((q < end) && (*q >= '0') && (*q <= '9'))
+        {
+            while ((q < end) && (*q >= '0') && (*q <= '9'))
+            {
+                /*  Large exponents go to strtod, so stop before overflow.    */
+                if (exp_val < 100000L)
+                    exp_val = 10L*exp_val + (long)(*q - '0');
+                ++q;
+            }
+
+            e += exp_sign * exp_val;
+            p = q;
+        }
+    }
+
+#ifdef RSSRINGOCCS_CSV_FAST_PATH
+    if ((m <= 9007199254740992.0) && (e >= -22L) && (e <= 22L))
+    {
+        if (e < 0)
+            x = m / __pow_10[-e];
+        else
+            x = m * __pow_10[e];
+
+        *stop = p;
+        return negative ? -x : x;
+    }
+#endif
+
+    return __slow_path(start, end, stop);
+}
+/*  End of rssringoccs_CSV_Parse_Double.                                      */
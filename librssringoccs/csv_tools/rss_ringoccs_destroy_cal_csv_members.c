@@ -26,6 +26,10 @@
 /*  Macro for freeing and nullifying the members of the geo CSV structs.      */
 #define DESTROY_CAL_VAR(var) if (var != NULL){free(var); var = NULL;}
 
+/*  Arrays read from a binary cache point into its mapping, and are not      *
+ *  freed individually. The mapping is released at the end.                  */
+#define FORGET_CAL_VAR(var) var = NULL
+
 /*  Free's all members of a rssringoccs_GeoCSV pointer except the             *
  *  error_message. Members are set to NULL after freeing.                     */
 RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_CalCSV_Members(rssringoccs_CalCSV *cal)
@@ -35,9 +39,20 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_CalCSV_Members(rssringoccs_CalCSV *
         return;
 
     /*  Destroy every variable except the error_message.                      */
-    DESTROY_CAL_VAR(cal->t_oet_spm_vals);
-    DESTROY_CAL_VAR(cal->f_sky_pred_vals);
-    DESTROY_CAL_VAR(cal->f_sky_resid_fit_vals);
-    DESTROY_CAL_VAR(cal->p_free_vals);
+    if (cal->cache == NULL)
+    {
+        DESTROY_CAL_VAR(cal->t_oet_spm_vals);
+        DESTROY_CAL_VAR(cal->f_sky_pred_vals);
+        DESTROY_CAL_VAR(cal->f_sky_resid_fit_vals);
+        DESTROY_CAL_VAR(cal->p_free_vals);
+    }
+    else
+    {
+        FORGET_CAL_VAR(cal->t_oet_spm_vals);
+        FORGET_CAL_VAR(cal->f_sky_pred_vals);
+        FORGET_CAL_VAR(cal->f_sky_resid_fit_vals);
+        FORGET_CAL_VAR(cal->p_free_vals);
+        rssringoccs_Destroy_CSVFile(&cal->cache);
+    }
 }
 /*  End of rssringoccs_Destroy_CalCSV_Members.                                */
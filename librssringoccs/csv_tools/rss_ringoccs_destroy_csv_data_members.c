@@ -39,6 +39,7 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_CSV_Members(rssringoccs_CSVData *cs
     DESTROY_CSV_VAR(csv->D_km_vals);
     DESTROY_CSV_VAR(csv->f_sky_hz_vals);
     DESTROY_CSV_VAR(csv->p_norm_vals);
+    DESTROY_CSV_VAR(csv->raw_tau_vals);
     DESTROY_CSV_VAR(csv->power_vals);
     DESTROY_CSV_VAR(csv->phase_rad_vals);
     DESTROY_CSV_VAR(csv->phase_vals);
@@ -0,0 +1,65 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************/
+
+/*  munmap is POSIX, not C89, and is hidden by -ansi.                         */
+#if defined(__unix__) || defined(__APPLE__)
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#define RSSRINGOCCS_CSV_USE_MMAP
+#endif
+
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+#ifdef RSSRINGOCCS_CSV_USE_MMAP
+#include <sys/types.h>
+#include <sys/mman.h>
+#endif
+
+/*  Unmaps or frees the data and chunk table of a CSV file, then the struct.  */
+RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_CSVFile(rssringoccs_CSVFile **csv)
+{
+    if (csv == NULL)
+        return;
+
+    if (*csv == NULL)
+        return;
+
+#ifdef RSSRINGOCCS_CSV_USE_MMAP
+    if ((*csv)->is_mapped)
+        munmap((*csv)->data, (size_t)(*csv)->size);
+    else
+        free((*csv)->data);
+#else
+    free((*csv)->data);
+#endif
+
+    if ((*csv)->chunk_start != NULL)
+        free((*csv)->chunk_start);
+
+    if ((*csv)->chunk_rows != NULL)
+        free((*csv)->chunk_rows);
+
+    if ((*csv)->error_message != NULL)
+        free((*csv)->error_message);
+
+    free(*csv);
+    *csv = NULL;
+}
@@ -26,6 +26,10 @@
 /*  Macro for freeing and nullifying the members of the geo CSV structs.      */
 #define DESTROY_DLP_VAR(var) if (var != NULL){free(var); var = NULL;}
 
+/*  Arrays read from a binary cache point into its mapping, and are not      *
+ *  freed individually. The mapping is released at the end.                  */
+#define FORGET_DLP_VAR(var) var = NULL
+
 /*  Free's all members of a rssringoccs_GeoCSV pointer except the             *
  *  error_message. Members are set to NULL after freeing.                     */
 RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_DLPCSV_Members(rssringoccs_DLPCSV *dlp)
@@ -35,18 +39,38 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_DLPCSV_Members(rssringoccs_DLPCSV *
         return;
 
     /*  Destroy every variable except the error_message.                      */
-    DESTROY_DLP_VAR(dlp->rho_km_vals);
-    DESTROY_DLP_VAR(dlp->rho_corr_pole_km_vals);
-    DESTROY_DLP_VAR(dlp->rho_corr_timing_km_vals);
-    DESTROY_DLP_VAR(dlp->phi_rl_deg_vals);
-    DESTROY_DLP_VAR(dlp->phi_ora_deg_vals);
-    DESTROY_DLP_VAR(dlp->p_norm_vals);
-    DESTROY_DLP_VAR(dlp->raw_tau_vals);
-    DESTROY_DLP_VAR(dlp->phase_deg_vals);
-    DESTROY_DLP_VAR(dlp->raw_tau_threshold_vals);
-    DESTROY_DLP_VAR(dlp->t_oet_spm_vals);
-    DESTROY_DLP_VAR(dlp->t_ret_spm_vals);
-    DESTROY_DLP_VAR(dlp->t_set_spm_vals);
-    DESTROY_DLP_VAR(dlp->B_deg_vals);
+    if (dlp->cache == NULL)
+    {
+        DESTROY_DLP_VAR(dlp->rho_km_vals);
+        DESTROY_DLP_VAR(dlp->rho_corr_pole_km_vals);
+        DESTROY_DLP_VAR(dlp->rho_corr_timing_km_vals);
+        DESTROY_DLP_VAR(dlp->phi_rl_deg_vals);
+        DESTROY_DLP_VAR(dlp->phi_ora_deg_vals);
+        DESTROY_DLP_VAR(dlp->p_norm_vals);
+        DESTROY_DLP_VAR(dlp->raw_tau_vals);
+        DESTROY_DLP_VAR(dlp->phase_deg_vals);
+        DESTROY_DLP_VAR(dlp->raw_tau_threshold_vals);
+        DESTROY_DLP_VAR(dlp->t_oet_spm_vals);
+        DESTROY_DLP_VAR(dlp->t_ret_spm_vals);
+        DESTROY_DLP_VAR(dlp->t_set_spm_vals);
+        DESTROY_DLP_VAR(dlp->B_deg_vals);
+    }
+    else
+    {
+        FORGET_DLP_VAR(dlp->rho_km_vals);
+        FORGET_DLP_VAR(dlp->rho_corr_pole_km_vals);
+        FORGET_DLP_VAR(dlp->rho_corr_timing_km_vals);
+        FORGET_DLP_VAR(dlp->phi_rl_deg_vals);
+        FORGET_DLP_VAR(dlp->phi_ora_deg_vals);
+        FORGET_DLP_VAR(dlp->p_norm_vals);
+        FORGET_DLP_VAR(dlp->raw_tau_vals);
+        FORGET_DLP_VAR(dlp->phase_deg_vals);
+        FORGET_DLP_VAR(dlp->raw_tau_threshold_vals);
+        FORGET_DLP_VAR(dlp->t_oet_spm_vals);
+        FORGET_DLP_VAR(dlp->t_ret_spm_vals);
+        FORGET_DLP_VAR(dlp->t_set_spm_vals);
+        FORGET_DLP_VAR(dlp->B_deg_vals);
+        rssringoccs_Destroy_CSVFile(&dlp->cache);
+    }
 }
 /*  End of rssringoccs_Destroy_GeoCSV_Members.                                */
@@ -26,6 +26,10 @@
 /*  Macro for freeing and nullifying the members of the geo CSV structs.      */
 #define DESTROY_GEO_VAR(var) if (var != NULL){free(var); var = NULL;}
 
+/*  Arrays read from a binary cache point into its mapping, and are not      *
+ *  freed individually. The mapping is released at the end.                  */
+#define FORGET_GEO_VAR(var) var = NULL
+
 /*  Free's all members of a rssringoccs_GeoCSV pointer except the             *
  *  error_message. Members are set to NULL after freeing.                     */
 RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_GeoCSV_Members(rssringoccs_GeoCSV *geo)
@@ -35,24 +39,50 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_GeoCSV_Members(rssringoccs_GeoCSV *
         return;
 
     /*  Destroy every variable except the error_message.                      */
-    DESTROY_GEO_VAR(geo->t_oet_spm_vals);
-    DESTROY_GEO_VAR(geo->t_ret_spm_vals);
-    DESTROY_GEO_VAR(geo->t_set_spm_vals);
-    DESTROY_GEO_VAR(geo->rho_km_vals);
-    DESTROY_GEO_VAR(geo->phi_rl_deg_vals);
-    DESTROY_GEO_VAR(geo->phi_ora_deg_vals);
-    DESTROY_GEO_VAR(geo->B_deg_vals);
-    DESTROY_GEO_VAR(geo->D_km_vals);
-    DESTROY_GEO_VAR(geo->rho_dot_kms_vals);
-    DESTROY_GEO_VAR(geo->phi_rl_dot_kms_vals);
-    DESTROY_GEO_VAR(geo->F_km_vals);
-    DESTROY_GEO_VAR(geo->R_imp_km_vals);
-    DESTROY_GEO_VAR(geo->rx_km_vals);
-    DESTROY_GEO_VAR(geo->ry_km_vals);
-    DESTROY_GEO_VAR(geo->rz_km_vals);
-    DESTROY_GEO_VAR(geo->vx_kms_vals);
-    DESTROY_GEO_VAR(geo->vy_kms_vals);
-    DESTROY_GEO_VAR(geo->vz_kms_vals);
-    DESTROY_GEO_VAR(geo->obs_spacecract_lat_deg_vals);
+    if (geo->cache == NULL)
+    {
+        DESTROY_GEO_VAR(geo->t_oet_spm_vals);
+        DESTROY_GEO_VAR(geo->t_ret_spm_vals);
+        DESTROY_GEO_VAR(geo->t_set_spm_vals);
+        DESTROY_GEO_VAR(geo->rho_km_vals);
+        DESTROY_GEO_VAR(geo->phi_rl_deg_vals);
+        DESTROY_GEO_VAR(geo->phi_ora_deg_vals);
+        DESTROY_GEO_VAR(geo->B_deg_vals);
+        DESTROY_GEO_VAR(geo->D_km_vals);
+        DESTROY_GEO_VAR(geo->rho_dot_kms_vals);
+        DESTROY_GEO_VAR(geo->phi_rl_dot_kms_vals);
+        DESTROY_GEO_VAR(geo->F_km_vals);
+        DESTROY_GEO_VAR(geo->R_imp_km_vals);
+        DESTROY_GEO_VAR(geo->rx_km_vals);
+        DESTROY_GEO_VAR(geo->ry_km_vals);
+        DESTROY_GEO_VAR(geo->rz_km_vals);
+        DESTROY_GEO_VAR(geo->vx_kms_vals);
+        DESTROY_GEO_VAR(geo->vy_kms_vals);
+        DESTROY_GEO_VAR(geo->vz_kms_vals);
+        DESTROY_GEO_VAR(geo->obs_spacecract_lat_deg_vals);
+    }
+    else
+    {
+        FORGET_GEO_VAR(geo->t_oet_spm_vals);
+        FORGET_GEO_VAR(geo->t_ret_spm_vals);
+        FORGET_GEO_VAR(geo->t_set_spm_vals);
+        FORGET_GEO_VAR(geo->rho_km_vals);
+        FORGET_GEO_VAR(geo->phi_rl_deg_vals);
+        FORGET_GEO_VAR(geo->phi_ora_deg_vals);
+        FORGET_GEO_VAR(geo->B_deg_vals);
+        FORGET_GEO_VAR(geo->D_km_vals);
+        FORGET_GEO_VAR(geo->rho_dot_kms_vals);
+        FORGET_GEO_VAR(geo->phi_rl_dot_kms_vals);
+        FORGET_GEO_VAR(geo->F_km_vals);
+        FORGET_GEO_VAR(geo->R_imp_km_vals);
+        FORGET_GEO_VAR(geo->rx_km_vals);
+        FORGET_GEO_VAR(geo->ry_km_vals);
+        FORGET_GEO_VAR(geo->rz_km_vals);
+        FORGET_GEO_VAR(geo->vx_kms_vals);
+        FORGET_GEO_VAR(geo->vy_kms_vals);
+        FORGET_GEO_VAR(geo->vz_kms_vals);
+        FORGET_GEO_VAR(geo->obs_spacecract_lat_deg_vals);
+        rssringoccs_Destroy_CSVFile(&geo->cache);
+    }
 }
 /*  End of rssringoccs_Destroy_GeoCSV_Members.                                */
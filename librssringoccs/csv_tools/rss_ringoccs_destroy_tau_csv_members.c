@@ -26,6 +26,10 @@
 /*  Macro for freeing and nullifying the members of the geo CSV structs.      */
 #define DESTROY_TAU_VAR(var) if (var != NULL){free(var); var = NULL;}
 
+/*  Arrays read from a binary cache point into its mapping, and are not      *
+ *  freed individually. The mapping is released at the end.                  */
+#define FORGET_TAU_VAR(var) var = NULL
+
 /*  Free's all members of a rssringoccs_TauCSV pointer except the             *
  *  error_message. Members are set to NULL after freeing.                     */
 RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_TauCSV_Members(rssringoccs_TauCSV *tau)
@@ -35,18 +39,38 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_TauCSV_Members(rssringoccs_TauCSV *
         return;
 
     /*  Destroy every variable except the error_message.                      */
-    DESTROY_TAU_VAR(tau->rho_km_vals);
-    DESTROY_TAU_VAR(tau->rho_corr_pole_km_vals);
-    DESTROY_TAU_VAR(tau->rho_corr_timing_km_vals);
-    DESTROY_TAU_VAR(tau->phi_rl_deg_vals);
-    DESTROY_TAU_VAR(tau->phi_ora_deg_vals);
-    DESTROY_TAU_VAR(tau->power_vals);
-    DESTROY_TAU_VAR(tau->tau_vals);
-    DESTROY_TAU_VAR(tau->phase_deg_vals);
-    DESTROY_TAU_VAR(tau->tau_threshold_vals);
-    DESTROY_TAU_VAR(tau->t_oet_spm_vals);
-    DESTROY_TAU_VAR(tau->t_ret_spm_vals);
-    DESTROY_TAU_VAR(tau->t_set_spm_vals);
-    DESTROY_TAU_VAR(tau->B_deg_vals);
+    if (tau->cache == NULL)
+    {
+        DESTROY_TAU_VAR(tau->rho_km_vals);
+        DESTROY_TAU_VAR(tau->rho_corr_pole_km_vals);
+        DESTROY_TAU_VAR(tau->rho_corr_timing_km_vals);
+        DESTROY_TAU_VAR(tau->phi_rl_deg_vals);
+        DESTROY_TAU_VAR(tau->phi_ora_deg_vals);
+        DESTROY_TAU_VAR(tau->power_vals);
+        DESTROY_TAU_VAR(tau->tau_vals);
+        DESTROY_TAU_VAR(tau->phase_deg_vals);
+        DESTROY_TAU_VAR(tau->tau_threshold_vals);
+        DESTROY_TAU_VAR(tau->t_oet_spm_vals);
+        DESTROY_TAU_VAR(tau->t_ret_spm_vals);
+        DESTROY_TAU_VAR(tau->t_set_spm_vals);
+        DESTROY_TAU_VAR(tau->B_deg_vals);
+    }
+    else
+    {
+        FORGET_TAU_VAR(tau->rho_km_vals);
+        FORGET_TAU_VAR(tau->rho_corr_pole_km_vals);
+        FORGET_TAU_VAR(tau->rho_corr_timing_km_vals);
+        FORGET_TAU_VAR(tau->phi_rl_deg_vals);
+        FORGET_TAU_VAR(tau->phi_ora_deg_vals);
+        FORGET_TAU_VAR(tau->power_vals);
+        FORGET_TAU_VAR(tau->tau_vals);
+        FORGET_TAU_VAR(tau->phase_deg_vals);
+        FORGET_TAU_VAR(tau->tau_threshold_vals);
+        FORGET_TAU_VAR(tau->t_oet_spm_vals);
+        FORGET_TAU_VAR(tau->t_ret_spm_vals);
+        FORGET_TAU_VAR(tau->t_set_spm_vals);
+        FORGET_TAU_VAR(tau->B_deg_vals);
+        rssringoccs_Destroy_CSVFile(&tau->cache);
+    }
 }
 /*  End of rssringoccs_Destroy_TauCSV_Members.                                */
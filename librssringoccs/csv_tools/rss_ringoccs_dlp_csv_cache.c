@@ -0,0 +1,246 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_dlp_csv_cache                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Write and read binary caches of the DLP.TAB files on the PDS.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Write_DLPCSV_Cache:                                       *
+ *  Purpose:                                                                  *
+ *      Writes the data in dlp to a binary cache, see                         *
+ *      rss_ringoccs_csv_cache.c for the file format. The columns are named   *
+ *      after the members of rssringoccs_DLPCSV, without the _vals suffix.    *
+ *  Arguments:                                                                *
+ *      dlp (const rssringoccs_DLPCSV *):                                     *
+ *          The data, usually from rssringoccs_Get_DLP.                       *
+ *      filename (const char *):                                              *
+ *          The path of the cache. For rssringoccs_Get_DLP to find it, this   *
+ *          is the path of the .TAB file followed by                          *
+ *          RSSRINGOCCS_CSV_CACHE_SUFFIX.                                     *
+ *  Output:                                                                   *
+ *      success (rssringoccs_Bool):                                           *
+ *          True if the cache was written.                                    *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Get_DLP_Cache:                                            *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Get_DLP, but reads a binary cache instead of a    *
+ *      .TAB file.                                                            *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path of the cache.                                            *
+ *      use_deprecated (rssringoccs_Bool):                                    *
+ *          As for rssringoccs_Get_DLP. The cache must not have the p_norm    *
+ *          column if this is set, and must have it if not.                   *
+ *  Output:                                                                   *
+ *      dlp (rssringoccs_DLPCSV *):                                           *
+ *          The data. Errors are set in error_occurred and error_message.     *
+ *  Method:                                                                   *
+ *      The cache is mapped with rssringoccs_Open_CSV_Cache, and the members  *
+ *      of dlp point into the mapping, so nothing is copied or parsed.        *
+ *      rssringoccs_Destroy_DLPCSV_Members unmaps it.                         *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc.                       *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for puts.                         *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  The number of columns in the DLP.TAB files.                               */
+#define RSSRINGOCCS_DLP_CACHE_COLUMNS 13
+
+/*  The name and units of each column, in the order of the .TAB file.         */
+static const char * const __dlp_names[RSSRINGOCCS_DLP_CACHE_COLUMNS] = {
+    "rho_km",
+    "rho_corr_pole_km",
+    "rho_corr_timing_km",
+    "phi_rl_deg",
+    "phi_ora_deg",
+    "p_norm",
+    "raw_tau",
+    "phase_deg",
+    "raw_tau_threshold",
+    "t_oet_spm",
+    "t_ret_spm",
+    "t_set_spm",
+    "B_deg"
+};
+
+static const char * const __dlp_units[RSSRINGOCCS_DLP_CACHE_COLUMNS] = {
+    "km",
+    "km",
+    "km",
+    "deg",
+    "deg",
+    "",
+    "",
+    "deg",
+    "",
+    "s",
+    "s",
+    "s",
+    "deg"
+};
+
+/*  Points members[n] to the member of dlp for column n.                      */
+static void __dlp_members(rssringoccs_DLPCSV *dlp, double **members[])
+{
+    members[0] = &dlp->rho_km_vals;
+    members[1] = &dlp->rho_corr_pole_km_vals;
+    members[2] = &dlp->rho_corr_timing_km_vals;
+    members[3] = &dlp->phi_rl_deg_vals;
+    members[4] = &dlp->phi_ora_deg_vals;
+    members[5] = &dlp->p_norm_vals;
+    members[6] = &dlp->raw_tau_vals;
+    members[7] = &dlp->phase_deg_vals;
+    members[8] = &dlp->raw_tau_threshold_vals;
+    members[9] = &dlp->t_oet_spm_vals;
+    members[10] = &dlp->t_ret_spm_vals;
+    members[11] = &dlp->t_set_spm_vals;
+    members[12] = &dlp->B_deg_vals;
+}
+
+/*  Function for writing the data from a DLP.TAB file to a binary cache.      */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Write_DLPCSV_Cache(const rssringoccs_DLPCSV *dlp,
+                               const char *filename)
+{
+    double **members[RSSRINGOCCS_DLP_CACHE_COLUMNS];
+    double *columns[RSSRINGOCCS_DLP_CACHE_COLUMNS];
+    unsigned long n;
+
+    if (dlp == NULL)
+        return rssringoccs_False;
+
+    if (dlp->error_occurred)
+        return rssringoccs_False;
+
+    /*  The members are only read, so casting away const is safe.             */
+    __dlp_members((rssringoccs_DLPCSV *)dlp, members);
+    for (n = 0; n < RSSRINGOCCS_DLP_CACHE_COLUMNS; ++n)
+        columns[n] = *members[n];
+
+    return rssringoccs_Write_CSV_Cache(filename, "DLP", __dlp_names,
+                                       __dlp_units, columns,
+                                       RSSRINGOCCS_DLP_CACHE_COLUMNS,
+                                       dlp->n_elements);
+}
+/*  End of rssringoccs_Write_DLPCSV_Cache.                                    */
+
+/*  Function for reading the data from a binary cache of a DLP.TAB file.      */
+RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV *
+rssringoccs_Get_DLP_Cache(const char *filename,
+                          rssringoccs_Bool use_deprecated)
+{
+    rssringoccs_DLPCSV *dlp;
+    double **members[RSSRINGOCCS_DLP_CACHE_COLUMNS];
+    unsigned long n;
+    rssringoccs_Bool has_columns;
+
+    dlp = (rssringoccs_DLPCSV *)malloc(sizeof(*dlp));
+
+    /*  Check if malloc failed.                                               */
+    if (dlp == NULL)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\trssringoccs_Get_DLP_Cache\n\n"
+             "Malloc failed and returned NULL for dlp. Returning.\n");
+        return NULL;
+    }
+
+    __dlp_members(dlp, members);
+    for (n = 0; n < RSSRINGOCCS_DLP_CACHE_COLUMNS; ++n)
+        *members[n] = NULL;
+
+    dlp->n_elements = 0;
+    dlp->error_occurred = rssringoccs_False;
+    dlp->error_message = NULL;
+    dlp->cache = rssringoccs_Open_CSV_Cache(filename, "DLP");
+
+    if (dlp->cache == NULL)
+    {
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_DLP_Cache\n\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "cache. Aborting computation and returning.\n"
+        );
+        return dlp;
+    }
+
+    /*  Pass on the error from reading the cache.                             */
+    if (dlp->cache->error_occurred)
+    {
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = dlp->cache->error_message;
+        dlp->cache->error_message = NULL;
+        rssringoccs_Destroy_CSVFile(&dlp->cache);
+        return dlp;
+    }
+
+    /*  The members point into the mapping.                                   */
+    for (n = 0; n < RSSRINGOCCS_DLP_CACHE_COLUMNS; ++n)
+        *members[n] = rssringoccs_CSV_Cache_Column(dlp->cache,
+                                                   __dlp_names[n]);
+
+    /*  p_norm must be there if and only if use_deprecated is false, as in    *
+     *  the .TAB file. Every other column is needed.                          */
+    if (use_deprecated)
+        has_columns = (dlp->p_norm_vals == NULL);
+    else
+        has_columns = (dlp->p_norm_vals != NULL);
+
+    for (n = 0; n < RSSRINGOCCS_DLP_CACHE_COLUMNS; ++n)
+        if ((*members[n] == NULL) &&
+            (members[n] != &dlp->p_norm_vals))
+            has_columns = rssringoccs_False;
+
+    if (!has_columns)
+    {
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_DLP_Cache\n\n"
+            "Binary cache does not have the columns of a DLP.TAB file.\n"
+        );
+        rssringoccs_Destroy_DLPCSV_Members(dlp);
+        return dlp;
+    }
+
+    dlp->n_elements = dlp->cache->n_rows;
+    return dlp;
+}
+/*  End of rssringoccs_Get_DLP_Cache.                                         */
@@ -0,0 +1,1180 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                   rss_ringoccs_extract_csv_data_window                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Extract some of the data of the GEO, CAL, DLP, and TAU files, in a    *
+ *      window of radius or time, and interpolate it onto the DLP grid.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Extract_CSV_Data_Window:                                  *
+ *  Purpose:                                                                  *
+ *      Extracts the requested members of rssringoccs_CSVData for the part    *
+ *      of the DLP file in the given window.                                  *
+ *  Arguments:                                                                *
+ *      geo (const char *):                                                   *
+ *          The path to the GEO.TAB file.                                     *
+ *      cal (const char *):                                                   *
+ *          The path to the CAL.TAB file.                                     *
+ *      dlp (const char *):                                                   *
+ *          The path to the DLP.TAB file.                                     *
+ *      tau (const char *):                                                   *
+ *          The path to the TAU.TAB file, or NULL if there is none.           *
+ *      use_deprecated (rssringoccs_Bool):                                    *
+ *          Whether the files are in the older format, see rssringoccs_Get_*. *
+ *      columns (unsigned long):                                              *
+ *          The members to extract, a bitwise or of the                       *
+ *          RSSRINGOCCS_CSV_DATA_* flags. rho_km_vals is always extracted.    *
+ *      window (rssringoccs_CSV_Window_Type):                                 *
+ *          Whether start and end are radii in km, times in seconds past      *
+ *          midnight (t_oet_spm), or are ignored.                             *
+ *      start (double):                                                       *
+ *          The lower end of the window.                                      *
+ *      end (double):                                                         *
+ *          The upper end of the window.                                      *
+ *  Output:                                                                   *
+ *      csv_data (rssringoccs_CSVData *):                                     *
+ *          The data, or NULL if malloc fails. Members that were not          *
+ *          requested are NULL. On error, error_occurred is set and every     *
+ *          member is NULL.                                                   *
+ *  Method:                                                                   *
+ *      The DLP rows in the window are found by parsing only the key column,  *
+ *      and then only the requested columns of those rows are parsed. The     *
+ *      reading stops at the end of the window. The GEO and CAL files are     *
+ *      then read in the same way over the times covered by these rows, and   *
+ *      the TAU file over their radii, so that only the region that is        *
+ *      needed is read and interpolated. If a file has an up to date binary   *
+ *      cache, the columns are copied from it instead of parsed.              *
+ *                                                                            *
+ *      The computations are those of ExtractCSVData in CSV_tools.py: the     *
+ *      GEO data is interpolated against radius, the CAL data against time,   *
+ *      p_norm_vals is exp(-raw_tau / sin|B|), and the TAU data is            *
+ *      interpolated onto the DLP radii it covers.                            *
+ *  NOTES:                                                                    *
+ *      1.) The rows just outside of the window are included, so the data can *
+ *          be interpolated anywhere in [start, end].                         *
+ *      2.) The DLP radii must be strictly monotonic in the window. A chord   *
+ *          occultation is an error, and must be split into its ingress and   *
+ *          egress portions, or given a window that only covers one of them.  *
+ *      3.) The TAU members are computed on the tau_rho grid, which has       *
+ *          n_tau_elements points, and not on rho_km_vals.                    *
+ *      4.) DLP points outside of the times of the GEO or CAL file get the    *
+ *          value at the nearest end of the file, as with numpy.interp. It is *
+ *          an error if the file has no data in the times of the window.      *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for puts.                         *
+ *  3.) string.h:                                                             *
+ *          C standard library header. Used for memcpy.                       *
+ *  4.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing rssringoccs_Double_Exp and similar.        *
+ *  5.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  6.) rss_ringoccs_interpolate.h:                                           *
+ *          Header file containing rssringoccs_Double_Sorted_Interp1d.        *
+ *  7.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_interpolate.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  The most columns of any of the .TAB files, the current GEO format.        */
+#define __MAX_TAB_COLUMNS__ 19
+
+/*  The columns of each file in the current format, as named in the binary    *
+ *  cache, and the column that the deprecated format does not have. A file    *
+ *  with no such column has it set to the number of columns.                  */
+static const char * const __geo_names[19] = {
+    "t_oet_spm", "t_ret_spm", "t_set_spm", "rho_km", "phi_rl_deg",
+    "phi_ora_deg", "B_deg", "D_km", "rho_dot_kms", "phi_rl_dot_kms", "F_km",
+    "R_imp_km", "rx_km", "ry_km", "rz_km", "vx_kms", "vy_kms", "vz_kms",
+    "obs_spacecract_lat_deg"
+};
+
+static const char * const __cal_names[4] = {
+    "t_oet_spm", "f_sky_pred", "f_sky_resid_fit", "p_free"
+};
+
+static const char * const __dlp_names[13] = {
+    "rho_km", "rho_corr_pole_km", "rho_corr_timing_km", "phi_rl_deg",
+    "phi_ora_deg", "p_norm", "raw_tau", "phase_deg", "raw_tau_threshold",
+    "t_oet_spm", "t_ret_spm", "t_set_spm", "B_deg"
+};
+
+/*  The TAU files have the same columns as the DLP files, with power and tau  *
+ *  in place of p_norm and raw_tau.                                           */
+static const char * const __tau_names[13] = {
+    "rho_km", "rho_corr_pole_km", "rho_corr_timing_km", "phi_rl_deg",
+    "phi_ora_deg", "power", "tau", "phase_deg", "tau_threshold",
+    "t_oet_spm", "t_ret_spm", "t_set_spm", "B_deg"
+};
+
+/*  Indices of the columns that are used.                                     */
+#define __GEO_T_OET_SPM__ 0
+#define __GEO_RHO_KM__ 3
+#define __GEO_D_KM__ 7
+#define __GEO_RHO_DOT_KMS__ 8
+#define __GEO_RX_KM__ 12
+#define __GEO_RY_KM__ 13
+#define __GEO_RZ_KM__ 14
+#define __GEO_DEPRECATED__ 18
+
+#define __CAL_T_OET_SPM__ 0
+#define __CAL_F_SKY_PRED__ 1
+#define __CAL_F_SKY_RESID_FIT__ 2
+#define __CAL_DEPRECATED__ 4
+
+#define __DLP_RHO_KM__ 0
+#define __DLP_RHO_CORR_POLE_KM__ 1
+#define __DLP_RHO_CORR_TIMING_KM__ 2
+#define __DLP_PHI_RL_DEG__ 3
+#define __DLP_PHI_ORA_DEG__ 4
+#define __DLP_DEPRECATED__ 5
+#define __DLP_RAW_TAU__ 6
+#define __DLP_PHASE_DEG__ 7
+#define __DLP_RAW_TAU_THRESHOLD__ 8
+#define __DLP_T_OET_SPM__ 9
+#define __DLP_T_RET_SPM__ 10
+#define __DLP_T_SET_SPM__ 11
+#define __DLP_B_DEG__ 12
+
+#define __TAU_RHO_KM__ 0
+#define __TAU_DEPRECATED__ 5
+#define __TAU_TAU__ 6
+#define __TAU_PHASE_DEG__ 7
+#define __TAU_B_DEG__ 12
+
+/*  The columns read from one file. index[n] is the column, in the current    *
+ *  format, that is read into data[n]. The key is data[0].                    */
+typedef struct {
+    unsigned long index[__MAX_TAB_COLUMNS__];
+    double *data[__MAX_TAB_COLUMNS__];
+    unsigned long n_columns;
+    unsigned long n_rows;
+} __csv_window;
+
+/*  Returns the error message for a failed malloc.                            */
+static char *__malloc_error(void)
+{
+    return rssringoccs_strdup(
+        "Error Encountered: rss_ringoccs\n"
+        "\trssringoccs_Extract_CSV_Data_Window\n\n"
+        "Malloc returned NULL. Aborting.\n"
+    );
+}
+
+/*  Adds column to the columns that are read, if it is not already there.     */
+static void __add_column(__csv_window *win, unsigned long column)
+{
+    unsigned long n;
+
+    for (n = 0; n < win->n_columns; ++n)
+        if (win->index[n] == column)
+            return;
+
+    win->index[win->n_columns] = column;
+    win->data[win->n_columns] = NULL;
+    ++win->n_columns;
+}
+
+/*  Returns the data that was read for column, or NULL if it was not read.    */
+static double *__get_column(const __csv_window *win, unsigned long column)
+{
+    unsigned long n;
+
+    for (n = 0; n < win->n_columns; ++n)
+        if (win->index[n] == column)
+            return win->data[n];
+
+    return NULL;
+}
+
+/*  Takes the data of column from win, so that it is not freed with win.      */
+static double *__take_column(__csv_window *win, unsigned long column)
+{
+    double *data;
+    unsigned long n;
+
+    for (n = 0; n < win->n_columns; ++n)
+    {
+        if (win->index[n] == column)
+        {
+            data = win->data[n];
+            win->data[n] = NULL;
+            return data;
+        }
+    }
+
+    return NULL;
+}
+
+/*  Frees the data that was read.                                             */
+static void __free_window(__csv_window *win)
+{
+    unsigned long n;
+
+    for (n = 0; n < win->n_columns; ++n)
+    {
+        if (win->data[n] != NULL)
+        {
+            free(win->data[n]);
+            win->data[n] = NULL;
+        }
+    }
+}
+
+/*  Reverses the order of every column that was read.                         */
+static void __reverse_window(__csv_window *win)
+{
+    unsigned long n;
+
+    for (n = 0; n < win->n_columns; ++n)
+        rssringoccs_Reverse_Double_Array(win->data[n], win->n_rows);
+}
+
+/*  Finds the window in a sorted array, as rssringoccs_Find_CSV_Window does   *
+ *  in a CSV file.                                                            */
+static void
+__find_window(const double *key, unsigned long size, double start, double end,
+              unsigned long *first, unsigned long *n_rows)
+{
+    unsigned long n, last;
+    rssringoccs_Bool entered;
+
+    *first = 0;
+    *n_rows = 0;
+    last = 0;
+    entered = rssringoccs_False;
+
+    for (n = 0; n < size; ++n)
+    {
+        if ((start <= key[n]) && (key[n] <= end))
+        {
+            if (!entered)
+            {
+                *first = (n == 0 ? 0 : n - 1);
+                entered = rssringoccs_True;
+            }
+            last = n;
+        }
+        else if (entered)
+        {
+            last = n;
+            break;
+        }
+        else if ((n > 0) &&
+                 (((key[n-1] < start) && (key[n] > end)) ||
+                  ((key[n-1] > end) && (key[n] < start))))
+        {
+            *first = n - 1;
+            *n_rows = 2;
+            return;
+        }
+    }
+
+    if (entered)
+        *n_rows = last - *first + 1;
+}
+
+/*  Allocates the arrays of win for win->n_rows rows.                         */
+static rssringoccs_Bool __malloc_window(__csv_window *win)
+{
+    unsigned long n;
+
+    /*  malloc(0) may return NULL. An empty window needs no memory.           */
+    if (win->n_rows == 0)
+        return rssringoccs_True;
+
+    for (n = 0; n < win->n_columns; ++n)
+    {
+        win->data[n] = (double *)malloc(sizeof(double) * win->n_rows);
+        if (win->data[n] == NULL)
+        {
+            __free_window(win);
+            return rssringoccs_False;
+        }
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Sets csv->n_columns from the first line that is not blank. The rows are   *
+ *  not counted, as rssringoccs_Open_CSV would, so that the file is not read  *
+ *  past the end of the window.                                               */
+static void __count_columns(rssringoccs_CSVFile *csv)
+{
+    const char *p, *end;
+
+    p = csv->data;
+    end = csv->data + csv->size;
+
+    while ((p < end) && ((*p == ' ') || (*p == '\t') ||
+                         (*p == '\r') || (*p == '\n')))
+        ++p;
+
+    if (p == end)
+        return;
+
+    csv->n_columns = 1;
+    while ((p < end) && (*p != '\n'))
+    {
+        if (*p == ',')
+            ++csv->n_columns;
+        ++p;
+    }
+}
+
+/*  Reads the window from the binary cache of filename. Returns false if      *
+ *  there is no up to date cache with the columns of win, in which case       *
+ *  filename should be parsed instead.                                        */
+static rssringoccs_Bool
+__read_window_cache(__csv_window *win, const char *filename, const char *kind,
+                    const char * const *names, double start, double end,
+                    char **error_message)
+{
+    rssringoccs_CSVFile *cache;
+    double *columns[__MAX_TAB_COLUMNS__];
+    double *key;
+    char *cache_name;
+    unsigned long n, first;
+
+    /*  There must be a key to search.                                        */
+    if (win->n_columns == 0)
+        return rssringoccs_False;
+
+    cache_name = rssringoccs_Find_CSV_Cache(filename);
+    if (cache_name == NULL)
+        return rssringoccs_False;
+
+    cache = rssringoccs_Open_CSV_Cache(cache_name, kind);
+    free(cache_name);
+
+    if (cache == NULL)
+        return rssringoccs_False;
+
+    if (cache->error_occurred)
+    {
+        rssringoccs_Destroy_CSVFile(&cache);
+        return rssringoccs_False;
+    }
+
+    key = NULL;
+    for (n = 0; n < win->n_columns; ++n)
+    {
+        columns[n] = rssringoccs_CSV_Cache_Column(cache, names[win->index[n]]);
+        if (columns[n] == NULL)
+        {
+            rssringoccs_Destroy_CSVFile(&cache);
+            return rssringoccs_False;
+        }
+
+        if (n == 0)
+            key = columns[n];
+    }
+
+    __find_window(key, cache->n_rows, start, end, &first, &win->n_rows);
+
+    if (!__malloc_window(win))
+        *error_message = __malloc_error();
+    else
+        for (n = 0; n < win->n_columns; ++n)
+            memcpy(win->data[n], columns[n] + first,
+                   sizeof(double) * win->n_rows);
+
+    rssringoccs_Destroy_CSVFile(&cache);
+    return rssringoccs_True;
+}
+
+/*  Reads the columns of win, for the rows whose key is in [start, end], from *
+ *  the binary cache of filename, or from the file if there is no cache. On   *
+ *  error, *error_message is set, and nothing is allocated.                   */
+static void
+__read_window(__csv_window *win, const char *filename, const char *kind,
+              const char * const *names, unsigned long n_columns,
+              unsigned long deprecated_column, rssringoccs_Bool use_deprecated,
+              double start, double end, char **error_message)
+{
+    rssringoccs_CSVFile *csv;
+    double *columns[__MAX_TAB_COLUMNS__];
+    unsigned long n, column, first;
+
+    win->n_rows = 0;
+
+    if (__read_window_cache(win, filename, kind, names, start, end,
+                            error_message))
+        return;
+
+    /*  The deprecated format does not have one of the columns.               */
+    if (use_deprecated && (deprecated_column < n_columns))
+        --n_columns;
+
+    csv = rssringoccs_Map_CSVFile(filename);
+    if (csv == NULL)
+    {
+        *error_message = __malloc_error();
+        return;
+    }
+
+    if (csv->error_occurred)
+    {
+        *error_message = csv->error_message;
+        csv->error_message = NULL;
+        rssringoccs_Destroy_CSVFile(&csv);
+        return;
+    }
+
+    __count_columns(csv);
+    if (csv->n_columns != n_columns)
+    {
+        *error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "A CSV does not have the number of columns of its format.\n"
+            "Check the files and the value of use_deprecated.\n"
+        );
+        rssringoccs_Destroy_CSVFile(&csv);
+        return;
+    }
+
+    for (n = 0; n < __MAX_TAB_COLUMNS__; ++n)
+        columns[n] = NULL;
+
+    /*  Find the column of the file that each member of win is read from.     */
+    for (n = 0; n < win->n_columns; ++n)
+    {
+        column = win->index[n];
+        if (use_deprecated && (column > deprecated_column))
+            --column;
+
+        win->index[n] = column;
+    }
+
+    rssringoccs_Find_CSV_Window(csv, win->index[0], start, end,
+                                &first, &win->n_rows);
+
+    if (!csv->error_occurred)
+    {
+        if (!__malloc_window(win))
+        {
+            *error_message = __malloc_error();
+            rssringoccs_Destroy_CSVFile(&csv);
+            return;
+        }
+
+        for (n = 0; n < win->n_columns; ++n)
+            columns[win->index[n]] = win->data[n];
+
+        rssringoccs_Read_CSV_Rows(csv, columns, first, win->n_rows);
+    }
+
+    /*  Restore the indices of the current format, for __get_column.          */
+    for (n = 0; n < win->n_columns; ++n)
+        if (use_deprecated && (win->index[n] >= deprecated_column))
+            ++win->index[n];
+
+    if (csv->error_occurred)
+    {
+        *error_message = csv->error_message;
+        csv->error_message = NULL;
+        __free_window(win);
+    }
+
+    rssringoccs_Destroy_CSVFile(&csv);
+}
+
+/*  Sets the error of csv_data, and frees its members.                        */
+static void __set_error(rssringoccs_CSVData *csv_data, char *error_message)
+{
+    csv_data->error_occurred = rssringoccs_True;
+    csv_data->error_message = error_message;
+    rssringoccs_Destroy_CSV_Members(csv_data);
+}
+
+/*  Interpolates y(x) onto x_new. As with numpy.interp, which CSV_tools.py    *
+ *  uses, points of x_new outside of x get the value at the nearest end.      */
+static void
+__interp(double *x, double *y, unsigned long n_rows,
+         double *x_new, double *y_new, unsigned long n_new)
+{
+    unsigned long n;
+
+    rssringoccs_Double_Sorted_Interp1d(x, y, n_rows, x_new, y_new, n_new);
+
+    for (n = 0; n < n_new; ++n)
+    {
+        if (x_new[n] < x[0])
+            y_new[n] = y[0];
+        else if (x_new[n] > x[n_rows - 1])
+            y_new[n] = y[n_rows - 1];
+    }
+}
+
+/*  Interpolates y(x) onto csv_data->rho_km_vals, storing the result in *out. */
+static rssringoccs_Bool
+__interp_rho(rssringoccs_CSVData *csv_data, double *x, double *y,
+             unsigned long n_rows, double **out)
+{
+    *out = (double *)malloc(sizeof(**out) * csv_data->n_elements);
+    if (*out == NULL)
+        return rssringoccs_False;
+
+    __interp(x, y, n_rows, csv_data->rho_km_vals, *out, csv_data->n_elements);
+    return rssringoccs_True;
+}
+
+/*  Reads the DLP window and sets the members of csv_data that come from it.  *
+ *  The DLP t_oet_spm_vals are returned in *t_oet, for the GEO and CAL data.  */
+static rssringoccs_Bool
+__extract_dlp(rssringoccs_CSVData *csv_data, const char *dlp,
+              rssringoccs_Bool use_deprecated, unsigned long columns,
+              rssringoccs_CSV_Window_Type window, double start, double end,
+              double **t_oet)
+{
+    __csv_window win;
+    char *error_message;
+    double *rho, *t_set, *raw_tau, *B;
+    double dr_dt, min_dr_dt, max_dr_dt, mu;
+    unsigned long n;
+
+    error_message = NULL;
+    win.n_columns = 0;
+
+    /*  The key goes first. With no window, every row is read.                */
+    if (window == rssringoccs_CSV_SPM_Window)
+        __add_column(&win, __DLP_T_OET_SPM__);
+    else
+    {
+        __add_column(&win, __DLP_RHO_KM__);
+        if (window == rssringoccs_CSV_No_Window)
+        {
+            start = -rssringoccs_Infinity;
+            end = rssringoccs_Infinity;
+        }
+    }
+
+    __add_column(&win, __DLP_RHO_KM__);
+    __add_column(&win, __DLP_T_OET_SPM__);
+    __add_column(&win, __DLP_T_SET_SPM__);
+
+    if (columns & (RSSRINGOCCS_CSV_DATA_RAW_TAU | RSSRINGOCCS_CSV_DATA_P_NORM))
+        __add_column(&win, __DLP_RAW_TAU__);
+
+    if (columns & (RSSRINGOCCS_CSV_DATA_B_RAD | RSSRINGOCCS_CSV_DATA_P_NORM))
+        __add_column(&win, __DLP_B_DEG__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_PHASE_RAD)
+        __add_column(&win, __DLP_PHASE_DEG__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_PHI_RAD)
+        __add_column(&win, __DLP_PHI_ORA_DEG__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_PHI_RL_RAD)
+        __add_column(&win, __DLP_PHI_RL_DEG__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RAW_TAU_THRESHOLD)
+        __add_column(&win, __DLP_RAW_TAU_THRESHOLD__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RHO_CORR_POLE_KM)
+        __add_column(&win, __DLP_RHO_CORR_POLE_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RHO_CORR_TIMING_KM)
+        __add_column(&win, __DLP_RHO_CORR_TIMING_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_T_RET_SPM)
+        __add_column(&win, __DLP_T_RET_SPM__);
+
+    __read_window(&win, dlp, "DLP", __dlp_names, 13, __DLP_DEPRECATED__,
+                  use_deprecated, start, end, &error_message);
+
+    if (error_message != NULL)
+    {
+        __set_error(csv_data, error_message);
+        return rssringoccs_False;
+    }
+
+    if (win.n_rows < 2)
+    {
+        __free_window(&win);
+        __set_error(csv_data, rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "The window has fewer than two points of the DLP file.\n"
+        ));
+        return rssringoccs_False;
+    }
+
+    /*  drho/dt must have the same sign everywhere in the window.             */
+    rho = __get_column(&win, __DLP_RHO_KM__);
+    t_set = __get_column(&win, __DLP_T_SET_SPM__);
+    min_dr_dt = rssringoccs_Infinity;
+    max_dr_dt = -rssringoccs_Infinity;
+    for (n = 0; n < win.n_rows - 1; ++n)
+    {
+        dr_dt = (rho[n+1] - rho[n]) / (t_set[n+1] - t_set[n]);
+        if (dr_dt < min_dr_dt)
+            min_dr_dt = dr_dt;
+
+        if (max_dr_dt < dr_dt)
+            max_dr_dt = dr_dt;
+    }
+
+    if ((min_dr_dt < 0.0) && (max_dr_dt > 0.0))
+        error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "\rdrho/dt has positive and negative values. Check your DLP file.\n"
+            "\rIt is likely a chord occultation and needs to be split into\n"
+            "\ringress and egress portions.\n"
+        );
+    else if ((min_dr_dt == 0.0) || (max_dr_dt == 0.0))
+        error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "\rdrho/dt has zero-valued elements. Check your DLP file.\n"
+            "\rIt is likely a chord occultation and needs to be split into\n"
+            "\ringress and egress portions.\n"
+        );
+    else if (!((min_dr_dt < 0.0) || (max_dr_dt > 0.0)))
+        error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "\rdrho/dt is not a number. Check your DLP file.\n"
+        );
+
+    if (error_message != NULL)
+    {
+        __free_window(&win);
+        __set_error(csv_data, error_message);
+        return rssringoccs_False;
+    }
+
+    csv_data->n_elements = win.n_rows;
+
+    /*  Convert the angles to radians in place.                               */
+    B = __get_column(&win, __DLP_B_DEG__);
+    if (B != NULL)
+        for (n = 0; n < win.n_rows; ++n)
+            B[n] *= rssringoccs_Deg_To_Rad;
+
+    if (columns & RSSRINGOCCS_CSV_DATA_PHASE_RAD)
+    {
+        csv_data->phase_rad_vals = __take_column(&win, __DLP_PHASE_DEG__);
+        for (n = 0; n < win.n_rows; ++n)
+            csv_data->phase_rad_vals[n] *= rssringoccs_Deg_To_Rad;
+    }
+
+    if (columns & RSSRINGOCCS_CSV_DATA_PHI_RAD)
+    {
+        csv_data->phi_rad_vals = __take_column(&win, __DLP_PHI_ORA_DEG__);
+        for (n = 0; n < win.n_rows; ++n)
+            csv_data->phi_rad_vals[n] *= rssringoccs_Deg_To_Rad;
+    }
+
+    if (columns & RSSRINGOCCS_CSV_DATA_PHI_RL_RAD)
+    {
+        csv_data->phi_rl_rad_vals = __take_column(&win, __DLP_PHI_RL_DEG__);
+        for (n = 0; n < win.n_rows; ++n)
+            csv_data->phi_rl_rad_vals[n] *= rssringoccs_Deg_To_Rad;
+    }
+
+    if (columns & RSSRINGOCCS_CSV_DATA_P_NORM)
+    {
+        csv_data->p_norm_vals
+            = (double *)malloc(sizeof(*csv_data->p_norm_vals) * win.n_rows);
+        if (csv_data->p_norm_vals == NULL)
+        {
+            __free_window(&win);
+            __set_error(csv_data, __malloc_error());
+            return rssringoccs_False;
+        }
+
+        raw_tau = __get_column(&win, __DLP_RAW_TAU__);
+        for (n = 0; n < win.n_rows; ++n)
+        {
+            mu = rssringoccs_Double_Sin(rssringoccs_Double_Abs(B[n]));
+            csv_data->p_norm_vals[n] = rssringoccs_Double_Exp(-raw_tau[n]/mu);
+        }
+    }
+
+    /*  The other members are the columns as they were read.                  */
+    csv_data->rho_km_vals = __take_column(&win, __DLP_RHO_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_B_RAD)
+        csv_data->B_rad_vals = __take_column(&win, __DLP_B_DEG__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RAW_TAU)
+        csv_data->raw_tau_vals = __take_column(&win, __DLP_RAW_TAU__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RAW_TAU_THRESHOLD)
+        csv_data->raw_tau_threshold_vals
+            = __take_column(&win, __DLP_RAW_TAU_THRESHOLD__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RHO_CORR_POLE_KM)
+        csv_data->rho_corr_pole_km_vals
+            = __take_column(&win, __DLP_RHO_CORR_POLE_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RHO_CORR_TIMING_KM)
+        csv_data->rho_corr_timing_km_vals
+            = __take_column(&win, __DLP_RHO_CORR_TIMING_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_T_RET_SPM)
+        csv_data->t_ret_spm_vals = __take_column(&win, __DLP_T_RET_SPM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_T_SET_SPM)
+        csv_data->t_set_spm_vals = __take_column(&win, __DLP_T_SET_SPM__);
+
+    /*  t_oet_spm_vals is needed for the GEO and CAL windows either way.      */
+    *t_oet = __take_column(&win, __DLP_T_OET_SPM__);
+
+    __free_window(&win);
+    return rssringoccs_True;
+}
+
+/*  Reads the GEO file over the times of the DLP window and interpolates the  *
+ *  requested members onto the DLP radii.                                     */
+static rssringoccs_Bool
+__extract_geo(rssringoccs_CSVData *csv_data, const char *geo,
+              rssringoccs_Bool use_deprecated, unsigned long columns,
+              double t_start, double t_end)
+{
+    __csv_window win;
+    char *error_message;
+    double *geo_rho, *rho_dot;
+    rssringoccs_Bool ok;
+    unsigned long n;
+
+    error_message = NULL;
+    win.n_columns = 0;
+
+    __add_column(&win, __GEO_T_OET_SPM__);
+    __add_column(&win, __GEO_RHO_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_D_KM)
+        __add_column(&win, __GEO_D_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RHO_DOT_KMS)
+        __add_column(&win, __GEO_RHO_DOT_KMS__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RX_KM)
+        __add_column(&win, __GEO_RX_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RY_KM)
+        __add_column(&win, __GEO_RY_KM__);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RZ_KM)
+        __add_column(&win, __GEO_RZ_KM__);
+
+    __read_window(&win, geo, "GEO", __geo_names, 19, __GEO_DEPRECATED__,
+                  use_deprecated, t_start, t_end, &error_message);
+
+    if (error_message != NULL)
+    {
+        __set_error(csv_data, error_message);
+        return rssringoccs_False;
+    }
+
+    if (win.n_rows < 2)
+    {
+        __free_window(&win);
+        __set_error(csv_data, rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "The GEO file has no data in the times of the DLP window.\n"
+        ));
+        return rssringoccs_False;
+    }
+
+    /*  The GEO data is interpolated against radius, which must increase. For *
+     *  ingress occultations the radius decreases in time, so reverse it.     */
+    geo_rho = __get_column(&win, __GEO_RHO_KM__);
+    rho_dot = __get_column(&win, __GEO_RHO_DOT_KMS__);
+    if (geo_rho == NULL)
+    {
+        __free_window(&win);
+        __set_error(csv_data, rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "Could not read the ring radius column of the GEO file.\n"
+        ));
+        return rssringoccs_False;
+    }
+
+    if (geo_rho[0] > geo_rho[win.n_rows - 1])
+    {
+        __reverse_window(&win);
+        if (rho_dot != NULL)
+            for (n = 0; n < win.n_rows; ++n)
+                rho_dot[n] = rssringoccs_Double_Abs(rho_dot[n]);
+    }
+
+    ok = rssringoccs_True;
+
+    if (columns & RSSRINGOCCS_CSV_DATA_D_KM)
+        ok = ok && __interp_rho(csv_data, geo_rho,
+                                __get_column(&win, __GEO_D_KM__),
+                                win.n_rows, &csv_data->D_km_vals);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RHO_DOT_KMS)
+        ok = ok && __interp_rho(csv_data, geo_rho, rho_dot,
+                                win.n_rows, &csv_data->rho_dot_kms_vals);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RX_KM)
+        ok = ok && __interp_rho(csv_data, geo_rho,
+                                __get_column(&win, __GEO_RX_KM__),
+                                win.n_rows, &csv_data->rx_km_vals);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RY_KM)
+        ok = ok && __interp_rho(csv_data, geo_rho,
+                                __get_column(&win, __GEO_RY_KM__),
+                                win.n_rows, &csv_data->ry_km_vals);
+
+    if (columns & RSSRINGOCCS_CSV_DATA_RZ_KM)
+        ok = ok && __interp_rho(csv_data, geo_rho,
+                                __get_column(&win, __GEO_RZ_KM__),
+                                win.n_rows, &csv_data->rz_km_vals);
+
+    __free_window(&win);
+
+    if (!ok)
+        __set_error(csv_data, __malloc_error());
+
+    return ok;
+}
+
+/*  Reads the CAL file over the times of the DLP window and interpolates the  *
+ *  sky frequency onto the DLP times.                                         */
+static rssringoccs_Bool
+__extract_cal(rssringoccs_CSVData *csv_data, const char *cal,
+              double *t_oet, double t_start, double t_end)
+{
+    __csv_window win;
+    char *error_message;
+    double *f_sky_pred, *f_sky_resid;
+    unsigned long n;
+
+    error_message = NULL;
+    win.n_columns = 0;
+
+    __add_column(&win, __CAL_T_OET_SPM__);
+    __add_column(&win, __CAL_F_SKY_PRED__);
+    __add_column(&win, __CAL_F_SKY_RESID_FIT__);
+
+    __read_window(&win, cal, "CAL", __cal_names, 4, __CAL_DEPRECATED__,
+                  rssringoccs_False, t_start, t_end, &error_message);
+
+    if (error_message != NULL)
+    {
+        __set_error(csv_data, error_message);
+        return rssringoccs_False;
+    }
+
+    if (win.n_rows < 2)
+    {
+        __free_window(&win);
+        __set_error(csv_data, rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "The CAL file has no data in the times of the DLP window.\n"
+        ));
+        return rssringoccs_False;
+    }
+
+    csv_data->f_sky_hz_vals = (double *)
+        malloc(sizeof(*csv_data->f_sky_hz_vals) * csv_data->n_elements);
+
+    if (csv_data->f_sky_hz_vals == NULL)
+    {
+        __free_window(&win);
+        __set_error(csv_data, __malloc_error());
+        return rssringoccs_False;
+    }
+
+    /*  The sky frequency is the prediction minus the fit to the residual.    */
+    f_sky_pred = __get_column(&win, __CAL_F_SKY_PRED__);
+    f_sky_resid = __get_column(&win, __CAL_F_SKY_RESID_FIT__);
+    for (n = 0; n < win.n_rows; ++n)
+        f_sky_pred[n] -= f_sky_resid[n];
+
+    __interp(__get_column(&win, __CAL_T_OET_SPM__), f_sky_pred, win.n_rows,
+             t_oet, csv_data->f_sky_hz_vals, csv_data->n_elements);
+
+    __free_window(&win);
+    return rssringoccs_True;
+}
+
+/*  Reads the TAU file over the radii of the DLP window and interpolates it   *
+ *  onto the DLP radii that it covers.                                        */
+static rssringoccs_Bool
+__extract_tau(rssringoccs_CSVData *csv_data, const char *tau,
+              rssringoccs_Bool use_deprecated)
+{
+    __csv_window win;
+    char *error_message;
+    double *tau_rho, *tau_vals, *phase, *B, *rho;
+    double rho_min, rho_max;
+    unsigned long n, first;
+
+    error_message = NULL;
+    win.n_columns = 0;
+    rho = csv_data->rho_km_vals;
+
+    if (rho[0] < rho[csv_data->n_elements - 1])
+    {
+        rho_min = rho[0];
+        rho_max = rho[csv_data->n_elements - 1];
+    }
+    else
+    {
+        rho_min = rho[csv_data->n_elements - 1];
+        rho_max = rho[0];
+    }
+
+    __add_column(&win, __TAU_RHO_KM__);
+    __add_column(&win, __TAU_TAU__);
+    __add_column(&win, __TAU_PHASE_DEG__);
+    __add_column(&win, __TAU_B_DEG__);
+
+    __read_window(&win, tau, "TAU", __tau_names, 13, __TAU_DEPRECATED__,
+                  use_deprecated, rho_min, rho_max, &error_message);
+
+    if (error_message != NULL)
+    {
+        __set_error(csv_data, error_message);
+        return rssringoccs_False;
+    }
+
+    /*  A TAU file that does not overlap the window leaves the members NULL.  */
+    if (win.n_rows < 2)
+    {
+        __free_window(&win);
+        return rssringoccs_True;
+    }
+
+    tau_rho = __get_column(&win, __TAU_RHO_KM__);
+    if (tau_rho == NULL)
+    {
+        __free_window(&win);
+        __set_error(csv_data, rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "Could not read the ring radius column of the TAU file.\n"
+        ));
+        return rssringoccs_False;
+    }
+
+    if (tau_rho[0] > tau_rho[win.n_rows - 1])
+        __reverse_window(&win);
+
+    /*  The DLP radii are monotonic, so the ones the TAU file covers are      *
+     *  consecutive.                                                          */
+    __find_window(rho, csv_data->n_elements, tau_rho[0],
+                  tau_rho[win.n_rows - 1], &first, &csv_data->n_tau_elements);
+
+    /*  __find_window includes the points on either side, which are outside   *
+     *  of the TAU file. Remove them.                                         */
+    if ((csv_data->n_tau_elements > 0) &&
+        ((rho[first] < tau_rho[0]) || (rho[first] > tau_rho[win.n_rows-1])))
+    {
+        ++first;
+        --csv_data->n_tau_elements;
+    }
+
+    n = first + csv_data->n_tau_elements - 1;
+    if ((csv_data->n_tau_elements > 0) &&
+        ((rho[n] < tau_rho[0]) || (rho[n] > tau_rho[win.n_rows - 1])))
+        --csv_data->n_tau_elements;
+
+    if (csv_data->n_tau_elements == 0)
+    {
+        __free_window(&win);
+        return rssringoccs_True;
+    }
+
+    csv_data->tau_rho = (double *)
+        malloc(sizeof(*csv_data->tau_rho) * csv_data->n_tau_elements);
+    csv_data->tau_vals = (double *)
+        malloc(sizeof(*csv_data->tau_vals) * csv_data->n_tau_elements);
+    csv_data->phase_vals = (double *)
+        malloc(sizeof(*csv_data->phase_vals) * csv_data->n_tau_elements);
+    csv_data->power_vals = (double *)
+        malloc(sizeof(*csv_data->power_vals) * csv_data->n_tau_elements);
+
+    if ((csv_data->tau_rho == NULL) || (csv_data->tau_vals == NULL) ||
+        (csv_data->phase_vals == NULL) || (csv_data->power_vals == NULL))
+    {
+        __free_window(&win);
+        __set_error(csv_data, __malloc_error());
+        return rssringoccs_False;
+    }
+
+    memcpy(csv_data->tau_rho, rho + first,
+           sizeof(*csv_data->tau_rho) * csv_data->n_tau_elements);
+
+    /*  Interpolate phase in radians, and the sine of the opening angle, with *
+     *  which the power is computed from the optical depth.                   */
+    tau_vals = __get_column(&win, __TAU_TAU__);
+    phase = __get_column(&win, __TAU_PHASE_DEG__);
+    B = __get_column(&win, __TAU_B_DEG__);
+    for (n = 0; n < win.n_rows; ++n)
+    {
+        phase[n] *= rssringoccs_Deg_To_Rad;
+        B[n] = rssringoccs_Double_Sin(
+            rssringoccs_Double_Abs(rssringoccs_Deg_To_Rad*B[n])
+        );
+    }
+
+    rssringoccs_Double_Sorted_Interp1d(tau_rho, tau_vals, win.n_rows,
+                                       csv_data->tau_rho, csv_data->tau_vals,
+                                       csv_data->n_tau_elements);
+
+    rssringoccs_Double_Sorted_Interp1d(tau_rho, phase, win.n_rows,
+                                       csv_data->tau_rho, csv_data->phase_vals,
+                                       csv_data->n_tau_elements);
+
+    rssringoccs_Double_Sorted_Interp1d(tau_rho, B, win.n_rows,
+                                       csv_data->tau_rho, csv_data->power_vals,
+                                       csv_data->n_tau_elements);
+
+    for (n = 0; n < csv_data->n_tau_elements; ++n)
+        csv_data->power_vals[n] = rssringoccs_Double_Exp(
+            -csv_data->tau_vals[n] / csv_data->power_vals[n]
+        );
+
+    __free_window(&win);
+    return rssringoccs_True;
+}
+
+/*  Function for extracting the data in a window of the CSV files.            */
+RSS_RINGOCCS_EXPORT rssringoccs_CSVData *
+rssringoccs_Extract_CSV_Data_Window(const char *geo, const char *cal,
+                                    const char *dlp, const char *tau,
+                                    rssringoccs_Bool use_deprecated,
+                                    unsigned long columns,
+                                    rssringoccs_CSV_Window_Type window,
+                                    double start, double end)
+{
+    rssringoccs_CSVData *csv_data;
+    double *t_oet, t_start, t_end;
+    rssringoccs_Bool ok;
+
+    csv_data = (rssringoccs_CSVData *)malloc(sizeof(*csv_data));
+
+    if (csv_data == NULL)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\trssringoccs_Extract_CSV_Data_Window\n\n"
+             "Malloc failed and returned NULL for csv_data. Returning.\n");
+        return NULL;
+    }
+
+    /*  Initialize the members to NULL. This will prevent functions from      *
+     *  trying to free pointers that weren't malloc'd in the event of error.  */
+    csv_data->B_rad_vals = NULL;
+    csv_data->D_km_vals = NULL;
+    csv_data->f_sky_hz_vals = NULL;
+    csv_data->p_norm_vals = NULL;
+    csv_data->raw_tau_vals = NULL;
+    csv_data->power_vals = NULL;
+    csv_data->phase_rad_vals = NULL;
+    csv_data->phase_vals = NULL;
+    csv_data->phi_rad_vals = NULL;
+    csv_data->phi_rl_rad_vals = NULL;
+    csv_data->raw_tau_threshold_vals = NULL;
+    csv_data->rho_corr_pole_km_vals = NULL;
+    csv_data->rho_corr_timing_km_vals = NULL;
+    csv_data->rho_dot_kms_vals = NULL;
+    csv_data->rho_km_vals = NULL;
+    csv_data->rx_km_vals = NULL;
+    csv_data->ry_km_vals = NULL;
+    csv_data->rz_km_vals = NULL;
+    csv_data->t_oet_spm_vals = NULL;
+    csv_data->t_ret_spm_vals = NULL;
+    csv_data->t_set_spm_vals = NULL;
+    csv_data->tau_rho = NULL;
+    csv_data->tau_power = NULL;
+    csv_data->tau_vals = NULL;
+    csv_data->n_elements = 0;
+    csv_data->n_tau_elements = 0;
+    csv_data->error_occurred = rssringoccs_False;
+    csv_data->error_message = NULL;
+
+    if ((window != rssringoccs_CSV_No_Window) && !(start <= end))
+    {
+        __set_error(csv_data, rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Extract_CSV_Data_Window\n\n"
+            "The start of the window is greater than its end.\n"
+        ));
+        return csv_data;
+    }
+
+    t_oet = NULL;
+    ok = __extract_dlp(csv_data, dlp, use_deprecated, columns,
+                       window, start, end, &t_oet);
+
+    /*  The DLP files are sorted by radius, so the times of an ingress        *
+     *  occultation decrease.                                                 */
+    if (ok)
+    {
+        t_start = t_oet[0];
+        t_end = t_oet[csv_data->n_elements - 1];
+        if (t_start > t_end)
+        {
+            t_start = t_end;
+            t_end = t_oet[0];
+        }
+    }
+    else
+    {
+        t_start = 0.0;
+        t_end = 0.0;
+    }
+
+    if (ok && (columns & RSSRINGOCCS_CSV_DATA_GEO))
+        ok = __extract_geo(csv_data, geo, use_deprecated, columns,
+                           t_start, t_end);
+
+    if (ok && (columns & RSSRINGOCCS_CSV_DATA_F_SKY_HZ))
+        ok = __extract_cal(csv_data, cal, t_oet, t_start, t_end);
+
+    if (ok && (columns & RSSRINGOCCS_CSV_DATA_TAU) && (tau != NULL))
+        ok = __extract_tau(csv_data, tau, use_deprecated);
+
+    if (ok && (columns & RSSRINGOCCS_CSV_DATA_T_OET_SPM))
+        csv_data->t_oet_spm_vals = t_oet;
+    else if (t_oet != NULL)
+        free(t_oet);
+
+    return csv_data;
+}
+/*  End of rssringoccs_Extract_CSV_Data_Window.                               */
@@ -0,0 +1,181 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                        rss_ringoccs_find_csv_window                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Find the rows of a CSV file whose value in a sorted column lies in a  *
+ *      given range, without parsing the rest of the file.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Find_CSV_Window:                                          *
+ *  Purpose:                                                                  *
+ *      Finds the rows whose value in column key lies in [start, end], and    *
+ *      the rows just before and after them.                                  *
+ *  Arguments:                                                                *
+ *      csv (rssringoccs_CSVFile *):                                          *
+ *          A file opened with rssringoccs_Open_CSV.                          *
+ *      key (unsigned long):                                                  *
+ *          The column to search. It must be sorted, either increasing or     *
+ *          decreasing.                                                       *
+ *      start (double):                                                       *
+ *          The lower end of the window.                                      *
+ *      end (double):                                                         *
+ *          The upper end of the window.                                      *
+ *      first_row (unsigned long *):                                          *
+ *          Set to the index of the first row of the window.                  *
+ *      n_rows (unsigned long *):                                             *
+ *          Set to the number of rows in the window, or zero if no row of     *
+ *          the file lies in [start, end].                                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Only the key field of each row is parsed. Since the key is sorted,    *
+ *      the rows in [start, end] are consecutive, and the search stops at the *
+ *      first row after them.                                                 *
+ *  NOTES:                                                                    *
+ *      1.) The rows on either side of the window are included so that data   *
+ *          may be interpolated anywhere in [start, end]. If no row is in the *
+ *          window, but it lies between two rows, those two are returned.     *
+ *      2.) The indices do not count blank lines, as in                       *
+ *          rssringoccs_Read_CSV_Rows, which the output is meant for.         *
+ *      3.) A row without a key field is an error.                            *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) string.h:                                                             *
+ *          C standard library header. Used for memchr.                       *
+ *  2.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  3.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <string.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  Function for finding the rows of a CSV file in a window.                  */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Find_CSV_Window(rssringoccs_CSVFile *csv, unsigned long key,
+                            double start, double end,
+                            unsigned long *first_row, unsigned long *n_rows)
+{
+    const char *line, *line_end, *file_end, *field, *p;
+    unsigned long row, last, m;
+    rssringoccs_Bool entered;
+    double x, previous;
+
+    if ((first_row == NULL) || (n_rows == NULL))
+        return;
+
+    *first_row = 0;
+    *n_rows = 0;
+
+    if (csv == NULL)
+        return;
+
+    if (csv->error_occurred)
+        return;
+
+    line = csv->data;
+    file_end = csv->data + csv->size;
+    row = 0;
+    last = 0;
+    previous = 0.0;
+    entered = rssringoccs_False;
+
+    while (line < file_end)
+    {
+        line_end = (const char *)memchr(line, '\n', (size_t)(file_end - line));
+        if (line_end == NULL)
+            line_end = file_end;
+
+        /*  Skip blank lines.                                                 */
+        p = line;
+        while ((p < line_end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+            ++p;
+
+        if (p == line_end)
+        {
+            line = line_end + 1;
+            continue;
+        }
+
+        /*  Move to the key field, skipping the fields before it.             */
+        field = line;
+        for (m = 0; m < key; ++m)
+        {
+            p = (const char *)memchr(field, ',', (size_t)(line_end - field));
+            if (p == NULL)
+            {
+                csv->error_occurred = rssringoccs_True;
+                csv->error_message = rssringoccs_strdup(
+                    "Error Encountered: rss_ringoccs\n"
+                    "\trssringoccs_Find_CSV_Window\n\n"
+                    "A row of the CSV does not have the key column.\n"
+                );
+                return;
+            }
+            field = p + 1;
+        }
+
+        x = rssringoccs_CSV_Parse_Double(field, line_end, &p);
+
+        /*  NaN compares false, so it is never in the window.                 */
+        if ((start <= x) && (x <= end))
+        {
+            if (!entered)
+            {
+                *first_row = (row == 0 ? 0 : row - 1);
+                entered = rssringoccs_True;
+            }
+            last = row;
+        }
+
+        /*  The key is sorted, so no row after this one is in the window.     */
+        else if (entered)
+        {
+            last = row;
+            break;
+        }
+
+        /*  No row is in the window, but it lies between this row and the     *
+         *  one before it. Return the two of them.                            */
+        else if ((row > 0) &&
+                 (((previous < start) && (x > end)) ||
+                  ((previous > end) && (x < start))))
+        {
+            *first_row = row - 1;
+            *n_rows = 2;
+            return;
+        }
+
+        previous = x;
+        ++row;
+        line = line_end + 1;
+    }
+
+    if (entered)
+        *n_rows = last - *first_row + 1;
+}
+/*  End of rssringoccs_Find_CSV_Window.                                       */
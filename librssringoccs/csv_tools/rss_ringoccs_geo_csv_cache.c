@@ -0,0 +1,265 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_geo_csv_cache                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Write and read binary caches of the GEO.TAB files on the PDS.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Write_GeoCSV_Cache:                                       *
+ *  Purpose:                                                                  *
+ *      Writes the data in geo to a binary cache, see                         *
+ *      rss_ringoccs_csv_cache.c for the file format. The columns are named   *
+ *      after the members of rssringoccs_GeoCSV, without the _vals suffix.    *
+ *  Arguments:                                                                *
+ *      geo (const rssringoccs_GeoCSV *):                                     *
+ *          The data, usually from rssringoccs_Get_Geo.                       *
+ *      filename (const char *):                                              *
+ *          The path of the cache. For rssringoccs_Get_Geo to find it, this   *
+ *          is the path of the .TAB file followed by                          *
+ *          RSSRINGOCCS_CSV_CACHE_SUFFIX.                                     *
+ *  Output:                                                                   *
+ *      success (rssringoccs_Bool):                                           *
+ *          True if the cache was written.                                    *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Get_Geo_Cache:                                            *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Get_Geo, but reads a binary cache instead of a    *
+ *      .TAB file.                                                            *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path of the cache.                                            *
+ *      use_deprecated (rssringoccs_Bool):                                    *
+ *          As for rssringoccs_Get_Geo. The cache must not have the           *
+ *          obs_spacecract_lat_deg column if this is set, and must have it if *
+ *          not.                                                              *
+ *  Output:                                                                   *
+ *      geo (rssringoccs_GeoCSV *):                                           *
+ *          The data. Errors are set in error_occurred and error_message.     *
+ *  Method:                                                                   *
+ *      The cache is mapped with rssringoccs_Open_CSV_Cache, and the members  *
+ *      of geo point into the mapping, so nothing is copied or parsed.        *
+ *      rssringoccs_Destroy_GeoCSV_Members unmaps it.                         *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc.                       *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for puts.                         *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  The number of columns in the GEO.TAB files.                               */
+#define RSSRINGOCCS_GEO_CACHE_COLUMNS 19
+
+/*  The name and units of each column, in the order of the .TAB file.         */
+static const char * const __geo_names[RSSRINGOCCS_GEO_CACHE_COLUMNS] = {
+    "t_oet_spm",
+    "t_ret_spm",
+    "t_set_spm",
+    "rho_km",
+    "phi_rl_deg",
+    "phi_ora_deg",
+    "B_deg",
+    "D_km",
+    "rho_dot_kms",
+    "phi_rl_dot_kms",
+    "F_km",
+    "R_imp_km",
+    "rx_km",
+    "ry_km",
+    "rz_km",
+    "vx_kms",
+    "vy_kms",
+    "vz_kms",
+    "obs_spacecract_lat_deg"
+};
+
+static const char * const __geo_units[RSSRINGOCCS_GEO_CACHE_COLUMNS] = {
+    "s",
+    "s",
+    "s",
+    "km",
+    "deg",
+    "deg",
+    "deg",
+    "km",
+    "km/s",
+    "km/s",
+    "km",
+    "km",
+    "km",
+    "km",
+    "km",
+    "km/s",
+    "km/s",
+    "km/s",
+    "deg"
+};
+
+/*  Points members[n] to the member of geo for column n.                      */
+static void __geo_members(rssringoccs_GeoCSV *geo, double **members[])
+{
+    members[0] = &geo->t_oet_spm_vals;
+    members[1] = &geo->t_ret_spm_vals;
+    members[2] = &geo->t_set_spm_vals;
+    members[3] = &geo->rho_km_vals;
+    members[4] = &geo->phi_rl_deg_vals;
+    members[5] = &geo->phi_ora_deg_vals;
+    members[6] = &geo->B_deg_vals;
+    members[7] = &geo->D_km_vals;
+    members[8] = &geo->rho_dot_kms_vals;
+    members[9] = &geo->phi_rl_dot_kms_vals;
+    members[10] = &geo->F_km_vals;
+    members[11] = &geo->R_imp_km_vals;
+    members[12] = &geo->rx_km_vals;
+    members[13] = &geo->ry_km_vals;
+    members[14] = &geo->rz_km_vals;
+    members[15] = &geo->vx_kms_vals;
+    members[16] = &geo->vy_kms_vals;
+    members[17] = &geo->vz_kms_vals;
+    members[18] = &geo->obs_spacecract_lat_deg_vals;
+}
+
+/*  Function for writing the data from a GEO.TAB file to a binary cache.      */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Write_GeoCSV_Cache(const rssringoccs_GeoCSV *geo,
+                               const char *filename)
+{
+    double **members[RSSRINGOCCS_GEO_CACHE_COLUMNS];
+    double *columns[RSSRINGOCCS_GEO_CACHE_COLUMNS];
+    unsigned long n;
+
+    if (geo == NULL)
+        return rssringoccs_False;
+
+    if (geo->error_occurred)
+        return rssringoccs_False;
+
+    /*  The members are only read, so casting away const is safe.             */
+    __geo_members((rssringoccs_GeoCSV *)geo, members);
+    for (n = 0; n < RSSRINGOCCS_GEO_CACHE_COLUMNS; ++n)
+        columns[n] = *members[n];
+
+    return rssringoccs_Write_CSV_Cache(filename, "GEO", __geo_names,
+                                       __geo_units, columns,
+                                       RSSRINGOCCS_GEO_CACHE_COLUMNS,
+                                       geo->n_elements);
+}
+/*  End of rssringoccs_Write_GeoCSV_Cache.                                    */
+
+/*  Function for reading the data from a binary cache of a GEO.TAB file.      */
+RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV *
+rssringoccs_Get_Geo_Cache(const char *filename,
+                          rssringoccs_Bool use_deprecated)
+{
+    rssringoccs_GeoCSV *geo;
+    double **members[RSSRINGOCCS_GEO_CACHE_COLUMNS];
+    unsigned long n;
+    rssringoccs_Bool has_columns;
+
+    geo = (rssringoccs_GeoCSV *)malloc(sizeof(*geo));
+
+    /*  Check if malloc failed.                                               */
+    if (geo == NULL)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\trssringoccs_Get_Geo_Cache\n\n"
+             "Malloc failed and returned NULL for geo. Returning.\n");
+        return NULL;
+    }
+
+    __geo_members(geo, members);
+    for (n = 0; n < RSSRINGOCCS_GEO_CACHE_COLUMNS; ++n)
+        *members[n] = NULL;
+
+    geo->n_elements = 0;
+    geo->error_occurred = rssringoccs_False;
+    geo->error_message = NULL;
+    geo->cache = rssringoccs_Open_CSV_Cache(filename, "GEO");
+
+    if (geo->cache == NULL)
+    {
+        geo->error_occurred = rssringoccs_True;
+        geo->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Geo_Cache\n\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "cache. Aborting computation and returning.\n"
+        );
+        return geo;
+    }
+
+    /*  Pass on the error from reading the cache.                             */
+    if (geo->cache->error_occurred)
+    {
+        geo->error_occurred = rssringoccs_True;
+        geo->error_message = geo->cache->error_message;
+        geo->cache->error_message = NULL;
+        rssringoccs_Destroy_CSVFile(&geo->cache);
+        return geo;
+    }
+
+    /*  The members point into the mapping.                                   */
+    for (n = 0; n < RSSRINGOCCS_GEO_CACHE_COLUMNS; ++n)
+        *members[n] = rssringoccs_CSV_Cache_Column(geo->cache,
+                                                   __geo_names[n]);
+
+    /*  obs_spacecract_lat_deg must be there if and only if use_deprecated    *
+     *  is false, as in the .TAB file. Every other column is needed.          */
+    if (use_deprecated)
+        has_columns = (geo->obs_spacecract_lat_deg_vals == NULL);
+    else
+        has_columns = (geo->obs_spacecract_lat_deg_vals != NULL);
+
+    for (n = 0; n < RSSRINGOCCS_GEO_CACHE_COLUMNS; ++n)
+        if ((*members[n] == NULL) &&
+            (members[n] != &geo->obs_spacecract_lat_deg_vals))
+            has_columns = rssringoccs_False;
+
+    if (!has_columns)
+    {
+        geo->error_occurred = rssringoccs_True;
+        geo->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Geo_Cache\n\n"
+            "Binary cache does not have the columns of a GEO.TAB file.\n"
+        );
+        rssringoccs_Destroy_GeoCSV_Members(geo);
+        return geo;
+    }
+
+    geo->n_elements = geo->cache->n_rows;
+    return geo;
+}
+/*  End of rssringoccs_Get_Geo_Cache.                                         */
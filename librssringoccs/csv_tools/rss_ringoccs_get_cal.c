@@ -24,16 +24,31 @@
 #include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
 RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename)
 {
     rssringoccs_CalCSV *cal;
-    FILE *fp;
-    char buffer[1024];
-    char *record, *line;
-    int ch;
+    rssringoccs_CSVFile *csv;
+    char *cache_name;
+    double *columns[4];
     unsigned long line_count, column_count, n;
 
+    /*  Use the binary cache of the file if there is one that is up to date.  */
+    cache_name = rssringoccs_Find_CSV_Cache(filename);
+    if (cache_name != NULL)
+    {
+        cal = rssringoccs_Get_Cal_Cache(cache_name);
+        free(cache_name);
+
+        /*  If the cache can not be used, parse the file instead.             */
+        if (cal != NULL)
+        {
+            if (!cal->error_occurred)
+                return cal;
+
+            rssringoccs_Destroy_CalCSV(&cal);
+        }
+    }
+
     cal = (rssringoccs_CalCSV*)malloc(sizeof(*cal));
 
     /*  Check if malloc failed.                                               */
@@ -54,44 +69,41 @@ RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename
     cal->f_sky_resid_fit_vals = NULL;
     cal->p_free_vals = NULL;
     cal->error_message = NULL;
+    cal->cache = NULL;
+    cal->error_occurred = rssringoccs_False;
+    cal->n_elements = 0;
 
-    /*  Try to open the input file.                                           */
-    fp = fopen(filename, "r");
-
-    /*  If fopen returned NULL, the file likely does not exist. Return error. */
-    if (fp == NULL)
+    /*  Map the file into memory, and count its rows and columns.             */
+    csv = rssringoccs_Open_CSV(filename);
+    if (csv == NULL)
     {
         cal->error_occurred = rssringoccs_True;
         cal->error_message = rssringoccs_strdup(
             "Error Encountered: rss_ringoccs\n"
             "\trssringoccs_Get_Cal\n\n"
-            "fopen returned NULL. Failed to open file for reading.\n"
-            "It is likely the filename is incorrect or does not exist.\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "csv. Aborting computation and returning.\n"
         );
         return cal;
     }
 
-    /*  Count the number of lines in the CSV.                                 */
-    line_count = 0;
-    while(!feof(fp))
+    /*  If the file could not be read, it likely does not exist.              */
+    if (csv->error_occurred)
     {
-        ch = fgetc(fp);
-        if(ch == '\n')
-            line_count++;
+        cal->error_occurred = rssringoccs_True;
+        cal->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Cal\n\n"
+            "Failed to open file for reading.\n"
+            "It is likely the filename is incorrect or does not exist.\n"
+        );
+        rssringoccs_Destroy_CSVFile(&csv);
+        return cal;
     }
-    rewind(fp);
-    cal->n_elements = line_count;
 
-    /*  And count the number of columns.                                      */
-    column_count = 0;
-    line = fgets(buffer, sizeof(buffer), fp);
-    record = strtok(line, ",");
-    while (record != NULL)
-    {
-        record = strtok(NULL, ",");
-        column_count++;
-    }
-    rewind(fp);
+    line_count = csv->n_rows;
+    column_count = csv->n_columns;
+    cal->n_elements = line_count;
 
     /*  There should be 4 columns. Check this.                                */
     if (column_count != 4)
@@ -102,6 +114,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename
             "\ttrssringoccs_Get_Cal\n\n"
             "Input CSV does not have 4 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return cal;
     }
 
@@ -119,6 +132,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_CalCSV_Members(cal);
+        rssringoccs_Destroy_CSVFile(&csv);
         return cal;
     }
 
@@ -136,6 +150,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_CalCSV_Members(cal);
+        rssringoccs_Destroy_CSVFile(&csv);
         return cal;
     }
 
@@ -154,6 +169,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_CalCSV_Members(cal);
+        rssringoccs_Destroy_CSVFile(&csv);
         return cal;
     }
 
@@ -171,28 +187,27 @@ RSS_RINGOCCS_EXPORT rssringoccs_CalCSV* rssringoccs_Get_Cal(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_CalCSV_Members(cal);
+        rssringoccs_Destroy_CSVFile(&csv);
         return cal;
     }
 
-    line = fgets(buffer, sizeof(buffer), fp);
+    /*  Point to the array for each column of the file, in order.             */
     n = 0;
-    while(line != NULL)
+    columns[n++] = cal->t_oet_spm_vals;
+    columns[n++] = cal->f_sky_pred_vals;
+    columns[n++] = cal->f_sky_resid_fit_vals;
+    columns[n++] = cal->p_free_vals;
+
+    /*  Parse every row of the file in a single pass.                         */
+    rssringoccs_Read_CSV_Columns(csv, columns);
+    if (csv->error_occurred)
     {
-        record = strtok(line, ",");
-        cal->t_oet_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        cal->f_sky_pred_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        cal->f_sky_resid_fit_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        cal->p_free_vals[n] = atof(record);
-
-        line = fgets(buffer, sizeof(buffer), fp);
-        ++n;
+        cal->error_occurred = rssringoccs_True;
+        cal->error_message = csv->error_message;
+        csv->error_message = NULL;
+        rssringoccs_Destroy_CalCSV_Members(cal);
     }
 
+    rssringoccs_Destroy_CSVFile(&csv);
     return cal;
 }
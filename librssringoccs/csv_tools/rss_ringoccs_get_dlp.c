@@ -25,17 +25,32 @@
 #include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
 RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename,
                                         rssringoccs_Bool use_deprecated)
 {
     rssringoccs_DLPCSV *dlp;
-    FILE *fp;
-    char buffer[1024];
-    char *record, *line;
-    int ch;
+    rssringoccs_CSVFile *csv;
+    char *cache_name;
+    double *columns[13];
     unsigned long line_count, column_count, n;
 
+    /*  Use the binary cache of the file if there is one that is up to date.  */
+    cache_name = rssringoccs_Find_CSV_Cache(filename);
+    if (cache_name != NULL)
+    {
+        dlp = rssringoccs_Get_DLP_Cache(cache_name, use_deprecated);
+        free(cache_name);
+
+        /*  If the cache can not be used, parse the file instead.             */
+        if (dlp != NULL)
+        {
+            if (!dlp->error_occurred)
+                return dlp;
+
+            rssringoccs_Destroy_DLPCSV(&dlp);
+        }
+    }
+
     dlp = (rssringoccs_DLPCSV *)malloc(sizeof(*dlp));
 
     /*  Check if malloc failed.                                               */
@@ -65,44 +80,41 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
     dlp->t_set_spm_vals = NULL;
     dlp->B_deg_vals = NULL;
     dlp->error_message = NULL;
+    dlp->cache = NULL;
+    dlp->error_occurred = rssringoccs_False;
+    dlp->n_elements = 0;
 
-    /*  Try to open the input file.                                           */
-    fp = fopen(filename, "r");
-
-    /*  If fopen returned NULL, the file likely does not exist. Return error. */
-    if (fp == NULL)
+    /*  Map the file into memory, and count its rows and columns.             */
+    csv = rssringoccs_Open_CSV(filename);
+    if (csv == NULL)
     {
         dlp->error_occurred = rssringoccs_True;
         dlp->error_message = rssringoccs_strdup(
             "Error Encountered: rss_ringoccs\n"
             "\trssringoccs_Get_DLP\n\n"
-            "fopen returned NULL. Failed to open file for reading.\n"
-            "It is likely the filename is incorrect or does not exist.\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "csv. Aborting computation and returning.\n"
         );
         return dlp;
     }
 
-    /*  Count the number of lines in the CSV.                                 */
-    line_count = 0;
-    while(!feof(fp))
+    /*  If the file could not be read, it likely does not exist.              */
+    if (csv->error_occurred)
     {
-        ch = fgetc(fp);
-        if(ch == '\n')
-            line_count++;
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_DLP\n\n"
+            "Failed to open file for reading.\n"
+            "It is likely the filename is incorrect or does not exist.\n"
+        );
+        rssringoccs_Destroy_CSVFile(&csv);
+        return dlp;
     }
-    rewind(fp);
-    dlp->n_elements = line_count;
 
-    /*  And count the number of columns.                                      */
-    column_count = 0;
-    line = fgets(buffer, sizeof(buffer), fp);
-    record = strtok(line, ",");
-    while (record != NULL)
-    {
-        record = strtok(NULL, ",");
-        column_count++;
-    }
-    rewind(fp);
+    line_count = csv->n_rows;
+    column_count = csv->n_columns;
+    dlp->n_elements = line_count;
 
     /*  If use_deprecated was set to true, column_count must be 18. Check.    */
     if ((column_count != 12) && (use_deprecated))
@@ -114,6 +126,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
             "use_deprecated is set to true but the input CSV does not have\n"
             "12 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -127,6 +140,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
             "use_deprecated is set to false but the input CSV does not have\n"
             "13 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -144,6 +158,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -161,6 +176,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -178,6 +194,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -195,6 +212,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -213,6 +231,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -231,6 +250,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -248,6 +268,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -265,6 +286,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -282,6 +304,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -299,6 +322,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -316,6 +340,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -334,6 +359,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_DLPCSV_Members(dlp);
+        rssringoccs_Destroy_CSVFile(&csv);
         return dlp;
     }
 
@@ -358,59 +384,39 @@ RSS_RINGOCCS_EXPORT rssringoccs_DLPCSV* rssringoccs_Get_DLP(const char *filename
 
             /*  Free the variables that have been malloc'd so far.            */
             rssringoccs_Destroy_DLPCSV_Members(dlp);
+            rssringoccs_Destroy_CSVFile(&csv);
             return dlp;
         }
     }
 
-    line = fgets(buffer, sizeof(buffer), fp);
+    /*  Point to the array for each column of the file, in order. The         *
+     *  columns that are not in the deprecated format are left out.           */
     n = 0;
-    while(line != NULL)
+    columns[n++] = dlp->rho_km_vals;
+    columns[n++] = dlp->rho_corr_pole_km_vals;
+    columns[n++] = dlp->rho_corr_timing_km_vals;
+    columns[n++] = dlp->phi_rl_deg_vals;
+    columns[n++] = dlp->phi_ora_deg_vals;
+    if (!use_deprecated)
+        columns[n++] = dlp->p_norm_vals;
+    columns[n++] = dlp->raw_tau_vals;
+    columns[n++] = dlp->phase_deg_vals;
+    columns[n++] = dlp->raw_tau_threshold_vals;
+    columns[n++] = dlp->t_oet_spm_vals;
+    columns[n++] = dlp->t_ret_spm_vals;
+    columns[n++] = dlp->t_set_spm_vals;
+    columns[n++] = dlp->B_deg_vals;
+
+    /*  Parse every row of the file in a single pass.                         */
+    rssringoccs_Read_CSV_Columns(csv, columns);
+    if (csv->error_occurred)
     {
-        record = strtok(line, ",");
-        dlp->rho_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->rho_corr_pole_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->rho_corr_timing_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->phi_rl_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->phi_ora_deg_vals[n] = atof(record);
-
-        if (!use_deprecated)
-        {
-            record = strtok(NULL, ",");
-            dlp->p_norm_vals[n] = atof(record);
-        }
-
-        record = strtok(NULL, ",");
-        dlp->raw_tau_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->phase_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->raw_tau_threshold_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->t_oet_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->t_ret_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->t_set_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        dlp->B_deg_vals[n] = atof(record);
-
-        line = fgets(buffer, sizeof(buffer), fp);
-        ++n;
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = csv->error_message;
+        csv->error_message = NULL;
+        rssringoccs_Destroy_DLPCSV_Members(dlp);
     }
 
+    rssringoccs_Destroy_CSVFile(&csv);
     return dlp;
 }
@@ -25,17 +25,32 @@
 #include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
 RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename,
                                         rssringoccs_Bool use_deprecated)
 {
     rssringoccs_GeoCSV *geo;
-    FILE *fp;
-    char buffer[1024];
-    char *record, *line;
-    int ch;
+    rssringoccs_CSVFile *csv;
+    char *cache_name;
+    double *columns[19];
     unsigned long line_count, column_count, n;
 
+    /*  Use the binary cache of the file if there is one that is up to date.  */
+    cache_name = rssringoccs_Find_CSV_Cache(filename);
+    if (cache_name != NULL)
+    {
+        geo = rssringoccs_Get_Geo_Cache(cache_name, use_deprecated);
+        free(cache_name);
+
+        /*  If the cache can not be used, parse the file instead.             */
+        if (geo != NULL)
+        {
+            if (!geo->error_occurred)
+                return geo;
+
+            rssringoccs_Destroy_GeoCSV(&geo);
+        }
+    }
+
     geo = (rssringoccs_GeoCSV *)malloc(sizeof(*geo));
 
     /*  Check if malloc failed.                                               */
@@ -71,44 +86,41 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
     geo->vz_kms_vals = NULL;
     geo->obs_spacecract_lat_deg_vals = NULL;
     geo->error_message = NULL;
+    geo->cache = NULL;
+    geo->error_occurred = rssringoccs_False;
+    geo->n_elements = 0;
 
-    /*  Try to open the input file.                                           */
-    fp = fopen(filename, "r");
-
-    /*  If fopen returned NULL, the file likely does not exist. Return error. */
-    if (fp == NULL)
+    /*  Map the file into memory, and count its rows and columns.             */
+    csv = rssringoccs_Open_CSV(filename);
+    if (csv == NULL)
     {
         geo->error_occurred = rssringoccs_True;
         geo->error_message = rssringoccs_strdup(
             "Error Encountered: rss_ringoccs\n"
             "\trssringoccs_Get_Geo\n\n"
-            "fopen returned NULL. Failed to open file for reading.\n"
-            "It is likely the filename is incorrect or does not exist.\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "csv. Aborting computation and returning.\n"
         );
         return geo;
     }
 
-    /*  Count the number of lines in the CSV.                                 */
-    line_count = 0;
-    while(!feof(fp))
+    /*  If the file could not be read, it likely does not exist.              */
+    if (csv->error_occurred)
     {
-        ch = fgetc(fp);
-        if(ch == '\n')
-            line_count++;
+        geo->error_occurred = rssringoccs_True;
+        geo->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Geo\n\n"
+            "Failed to open file for reading.\n"
+            "It is likely the filename is incorrect or does not exist.\n"
+        );
+        rssringoccs_Destroy_CSVFile(&csv);
+        return geo;
     }
-    rewind(fp);
-    geo->n_elements = line_count;
 
-    /*  And count the number of columns.                                      */
-    column_count = 0;
-    line = fgets(buffer, sizeof(buffer), fp);
-    record = strtok(line, ",");
-    while (record != NULL)
-    {
-        record = strtok(NULL, ",");
-        column_count++;
-    }
-    rewind(fp);
+    line_count = csv->n_rows;
+    column_count = csv->n_columns;
+    geo->n_elements = line_count;
 
     /*  If use_deprecated was set to true, column_count must be 18. Check.    */
     if ((column_count != 18) && (use_deprecated))
@@ -120,6 +132,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
             "use_deprecated is set to true but the input CSV does not have\n"
             "18 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -133,6 +146,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
             "use_deprecated is set to false but the input CSV does not have\n"
             "19 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -150,6 +164,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -167,6 +182,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -184,6 +200,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -201,6 +218,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -218,6 +236,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -235,6 +254,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -252,6 +272,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -269,6 +290,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -286,6 +308,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -304,6 +327,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -321,6 +345,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -338,6 +363,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -355,6 +381,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -372,6 +399,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -389,6 +417,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -406,6 +435,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -423,6 +453,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -440,6 +471,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
         return geo;
     }
 
@@ -465,75 +497,45 @@ RSS_RINGOCCS_EXPORT rssringoccs_GeoCSV* rssringoccs_Get_Geo(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_GeoCSV_Members(geo);
+        rssringoccs_Destroy_CSVFile(&csv);
             return geo;
         }
     }
 
-    line = fgets(buffer, sizeof(buffer), fp);
+    /*  Point to the array for each column of the file, in order. The         *
+     *  columns that are not in the deprecated format are left out.           */
     n = 0;
-    while(line != NULL)
+    columns[n++] = geo->t_oet_spm_vals;
+    columns[n++] = geo->t_ret_spm_vals;
+    columns[n++] = geo->t_set_spm_vals;
+    columns[n++] = geo->rho_km_vals;
+    columns[n++] = geo->phi_rl_deg_vals;
+    columns[n++] = geo->phi_ora_deg_vals;
+    columns[n++] = geo->B_deg_vals;
+    columns[n++] = geo->D_km_vals;
+    columns[n++] = geo->rho_dot_kms_vals;
+    columns[n++] = geo->phi_rl_dot_kms_vals;
+    columns[n++] = geo->F_km_vals;
+    columns[n++] = geo->R_imp_km_vals;
+    columns[n++] = geo->rx_km_vals;
+    columns[n++] = geo->ry_km_vals;
+    columns[n++] = geo->rz_km_vals;
+    columns[n++] = geo->vx_kms_vals;
+    columns[n++] = geo->vy_kms_vals;
+    columns[n++] = geo->vz_kms_vals;
+    if (!use_deprecated)
+        columns[n++] = geo->obs_spacecract_lat_deg_vals;
+
+    /*  Parse every row of the file in a single pass.                         */
+    rssringoccs_Read_CSV_Columns(csv, columns);
+    if (csv->error_occurred)
     {
-        record = strtok(line, ",");
-        geo->t_oet_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->t_ret_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->t_set_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->rho_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->phi_rl_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->phi_ora_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->B_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->D_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->rho_dot_kms_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->phi_rl_dot_kms_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->F_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->R_imp_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->rx_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->ry_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->rz_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->vx_kms_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->vy_kms_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        geo->vz_kms_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        if (record != NULL)
-            geo->obs_spacecract_lat_deg_vals[n] = atof(record);
-
-        line = fgets(buffer, sizeof(buffer), fp);
-        ++n;
+        geo->error_occurred = rssringoccs_True;
+        geo->error_message = csv->error_message;
+        csv->error_message = NULL;
+        rssringoccs_Destroy_GeoCSV_Members(geo);
     }
 
+    rssringoccs_Destroy_CSVFile(&csv);
     return geo;
 }
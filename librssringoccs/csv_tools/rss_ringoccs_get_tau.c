@@ -25,17 +25,32 @@
 #include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
 RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename,
                                         rssringoccs_Bool use_deprecated)
 {
     rssringoccs_TauCSV *tau;
-    FILE *fp;
-    char buffer[1024];
-    char *record, *line;
-    int ch;
+    rssringoccs_CSVFile *csv;
+    char *cache_name;
+    double *columns[13];
     unsigned long line_count, column_count, n;
 
+    /*  Use the binary cache of the file if there is one that is up to date.  */
+    cache_name = rssringoccs_Find_CSV_Cache(filename);
+    if (cache_name != NULL)
+    {
+        tau = rssringoccs_Get_Tau_Cache(cache_name, use_deprecated);
+        free(cache_name);
+
+        /*  If the cache can not be used, parse the file instead.             */
+        if (tau != NULL)
+        {
+            if (!tau->error_occurred)
+                return tau;
+
+            rssringoccs_Destroy_TauCSV(&tau);
+        }
+    }
+
     tau = (rssringoccs_TauCSV *)malloc(sizeof(*tau));
 
     /*  Check if malloc failed.                                               */
@@ -65,44 +80,41 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
     tau->t_set_spm_vals = NULL;
     tau->B_deg_vals = NULL;
     tau->error_message = NULL;
+    tau->cache = NULL;
+    tau->error_occurred = rssringoccs_False;
+    tau->n_elements = 0;
 
-    /*  Try to open the input file.                                           */
-    fp = fopen(filename, "r");
-
-    /*  If fopen returned NULL, the file likely does not exist. Return error. */
-    if (fp == NULL)
+    /*  Map the file into memory, and count its rows and columns.             */
+    csv = rssringoccs_Open_CSV(filename);
+    if (csv == NULL)
     {
         tau->error_occurred = rssringoccs_True;
         tau->error_message = rssringoccs_strdup(
             "Error Encountered: rss_ringoccs\n"
             "\trssringoccs_Get_Tau\n\n"
-            "fopen returned NULL. Failed to open file for reading.\n"
-            "It is likely the filename is incorrect or does not exist.\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "csv. Aborting computation and returning.\n"
         );
         return tau;
     }
 
-    /*  Count the number of lines in the CSV.                                 */
-    line_count = 0;
-    while(!feof(fp))
+    /*  If the file could not be read, it likely does not exist.              */
+    if (csv->error_occurred)
     {
-        ch = fgetc(fp);
-        if(ch == '\n')
-            line_count++;
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Tau\n\n"
+            "Failed to open file for reading.\n"
+            "It is likely the filename is incorrect or does not exist.\n"
+        );
+        rssringoccs_Destroy_CSVFile(&csv);
+        return tau;
     }
-    rewind(fp);
-    tau->n_elements = line_count;
 
-    /*  And count the number of columns.                                      */
-    column_count = 0;
-    line = fgets(buffer, sizeof(buffer), fp);
-    record = strtok(line, ",");
-    while (record != NULL)
-    {
-        record = strtok(NULL, ",");
-        column_count++;
-    }
-    rewind(fp);
+    line_count = csv->n_rows;
+    column_count = csv->n_columns;
+    tau->n_elements = line_count;
 
     /*  If use_deprecated was set to true, column_count must be 18. Check.    */
     if ((column_count != 12) && (use_deprecated))
@@ -114,6 +126,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
             "use_deprecated is set to true but the input CSV does not have\n"
             "12 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -127,6 +140,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
             "use_deprecated is set to false but the input CSV does not have\n"
             "13 columns. Aborting computation.\n"
         );
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -144,6 +158,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -161,6 +176,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -178,6 +194,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -195,6 +212,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -213,6 +231,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -231,6 +250,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -248,6 +268,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -265,6 +286,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -282,6 +304,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -299,6 +322,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -316,10 +340,11 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
-    /*  Allocate memory for tau_threshold_vals and check for error.       */
+    /*  Allocate memory for tau_threshold_vals and check for error.           */
     tau->tau_threshold_vals
         = (double *)malloc(sizeof(*tau->tau_threshold_vals) * line_count);
     if (tau->tau_threshold_vals == NULL)
@@ -334,6 +359,7 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
         /*  Free the variables that have been malloc'd so far.                */
         rssringoccs_Destroy_TauCSV_Members(tau);
+        rssringoccs_Destroy_CSVFile(&csv);
         return tau;
     }
 
@@ -358,59 +384,39 @@ RSS_RINGOCCS_EXPORT rssringoccs_TauCSV* rssringoccs_Get_Tau(const char *filename
 
             /*  Free the variables that have been malloc'd so far.            */
             rssringoccs_Destroy_TauCSV_Members(tau);
+            rssringoccs_Destroy_CSVFile(&csv);
             return tau;
         }
     }
 
-    line = fgets(buffer, sizeof(buffer), fp);
+    /*  Point to the array for each column of the file, in order. The         *
+     *  columns that are not in the deprecated format are left out.           */
     n = 0;
-    while(line != NULL)
+    columns[n++] = tau->rho_km_vals;
+    columns[n++] = tau->rho_corr_pole_km_vals;
+    columns[n++] = tau->rho_corr_timing_km_vals;
+    columns[n++] = tau->phi_rl_deg_vals;
+    columns[n++] = tau->phi_ora_deg_vals;
+    if (!use_deprecated)
+        columns[n++] = tau->power_vals;
+    columns[n++] = tau->tau_vals;
+    columns[n++] = tau->phase_deg_vals;
+    columns[n++] = tau->tau_threshold_vals;
+    columns[n++] = tau->t_oet_spm_vals;
+    columns[n++] = tau->t_ret_spm_vals;
+    columns[n++] = tau->t_set_spm_vals;
+    columns[n++] = tau->B_deg_vals;
+
+    /*  Parse every row of the file in a single pass.                         */
+    rssringoccs_Read_CSV_Columns(csv, columns);
+    if (csv->error_occurred)
     {
-        record = strtok(line, ",");
-        tau->rho_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->rho_corr_pole_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->rho_corr_timing_km_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->phi_rl_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->phi_ora_deg_vals[n] = atof(record);
-
-        if (!use_deprecated)
-        {
-            record = strtok(NULL, ",");
-            tau->power_vals[n] = atof(record);
-        }
-
-        record = strtok(NULL, ",");
-        tau->tau_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->phase_deg_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->tau_threshold_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->t_oet_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->t_ret_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->t_set_spm_vals[n] = atof(record);
-
-        record = strtok(NULL, ",");
-        tau->B_deg_vals[n] = atof(record);
-
-        line = fgets(buffer, sizeof(buffer), fp);
-        ++n;
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = csv->error_message;
+        csv->error_message = NULL;
+        rssringoccs_Destroy_TauCSV_Members(tau);
     }
 
+    rssringoccs_Destroy_CSVFile(&csv);
     return tau;
 }
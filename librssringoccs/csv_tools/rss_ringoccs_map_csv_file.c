@@ -0,0 +1,202 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_map_csv_file                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Map a file into memory for the CSV readers and the binary cache.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Map_CSVFile:                                              *
+ *  Purpose:                                                                  *
+ *      Loads a file into memory.                                             *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path to the file.                                             *
+ *  Output:                                                                   *
+ *      csv (rssringoccs_CSVFile *):                                          *
+ *          The file, or NULL if malloc fails. If the file cannot be read,    *
+ *          error_occurred is set.                                            *
+ *  Method:                                                                   *
+ *      On unix-like systems the file is mapped with mmap, and the kernel is  *
+ *      told it will be read in order, so that it reads ahead. Elsewhere, or  *
+ *      if mmap fails, the file is read into memory with a single fread.      *
+ *  NOTES:                                                                    *
+ *      1.) The mapping is private and writable. Pages that are written to    *
+ *          are copied, and the file is not changed. This lets the arrays of  *
+ *          a binary cache be used, and modified, in place, as                *
+ *          rssringoccs_Extract_CSV_Data does when it reverses the GEO data.  *
+ *      2.) The file is closed before returning. A mapping stays valid after  *
+ *          its file is closed.                                               *
+ *      3.) An empty file is not an error. data is NULL and size is zero.     *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for fopen and fread.              *
+ *  3.) sys/mman.h, sys/stat.h, fcntl.h, unistd.h:                            *
+ *          POSIX headers, for mmap. Only used on unix-like systems.          *
+ *  4.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  5.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  mmap and posix_madvise are POSIX, not C89, and are hidden by -ansi.       */
+#if defined(__unix__) || defined(__APPLE__)
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#define RSSRINGOCCS_CSV_USE_MMAP
+#endif
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+#ifdef RSSRINGOCCS_CSV_USE_MMAP
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*  Reads the file into csv->data, setting csv->size.                         */
+static void __load_file(rssringoccs_CSVFile *csv, const char *filename)
+{
+#ifdef RSSRINGOCCS_CSV_USE_MMAP
+    struct stat file_stats;
+    void *map;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd == -1)
+        return;
+
+    if (fstat(fd, &file_stats) == -1)
+    {
+        close(fd);
+        return;
+    }
+
+    /*  mmap does not accept a length of zero.                                */
+    if (file_stats.st_size == 0)
+    {
+        csv->error_occurred = rssringoccs_False;
+        close(fd);
+        return;
+    }
+
+    map = mmap(NULL, (size_t)file_stats.st_size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map != MAP_FAILED)
+    {
+        posix_madvise(map, (size_t)file_stats.st_size, POSIX_MADV_SEQUENTIAL);
+        csv->data = (char *)map;
+        csv->size = (unsigned long)file_stats.st_size;
+        csv->is_mapped = rssringoccs_True;
+        csv->error_occurred = rssringoccs_False;
+        return;
+    }
+#endif
+
+    /*  No mmap, or mmap failed. Read the whole file with one fread.          */
+    {
+        FILE *fp;
+        long size;
+
+        fp = fopen(filename, "rb");
+        if (fp == NULL)
+            return;
+
+        if ((fseek(fp, 0L, SEEK_END) != 0) || ((size = ftell(fp)) < 0L))
+        {
+            fclose(fp);
+            return;
+        }
+        rewind(fp);
+
+        if (size > 0L)
+        {
+            csv->data = (char *)malloc((size_t)size);
+            if (csv->data == NULL)
+            {
+                fclose(fp);
+                return;
+            }
+
+            if (fread(csv->data, 1, (size_t)size, fp) != (size_t)size)
+            {
+                free(csv->data);
+                csv->data = NULL;
+                fclose(fp);
+                return;
+            }
+        }
+
+        fclose(fp);
+        csv->size = (unsigned long)size;
+        csv->error_occurred = rssringoccs_False;
+    }
+}
+
+/*  Function for loading a file into memory.                                  */
+RSS_RINGOCCS_EXPORT rssringoccs_CSVFile *
+rssringoccs_Map_CSVFile(const char *filename)
+{
+    rssringoccs_CSVFile *csv;
+
+    csv = (rssringoccs_CSVFile *)malloc(sizeof(*csv));
+    if (csv == NULL)
+        return csv;
+
+    csv->data = NULL;
+    csv->size = 0;
+    csv->n_rows = 0;
+    csv->n_columns = 0;
+    csv->n_chunks = 0;
+    csv->chunk_start = NULL;
+    csv->chunk_rows = NULL;
+    csv->is_mapped = rssringoccs_False;
+    csv->error_message = NULL;
+
+    /*  __load_file clears this on success.                                   */
+    csv->error_occurred = rssringoccs_True;
+    __load_file(csv, filename);
+
+    if (csv->error_occurred)
+        csv->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Map_CSVFile\n\n"
+            "Failed to open file for reading.\n"
+            "It is likely the filename is incorrect or does not exist.\n"
+        );
+
+    return csv;
+}
+/*  End of rssringoccs_Map_CSVFile.                                           */
@@ -0,0 +1,207 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                           rss_ringoccs_open_csv                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Map a CSV file into memory and count its rows and columns.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Open_CSV:                                                 *
+ *  Purpose:                                                                  *
+ *      Opens a CSV file for rssringoccs_Read_CSV_Columns.                    *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path to the file.                                             *
+ *  Output:                                                                   *
+ *      csv (rssringoccs_CSVFile *):                                          *
+ *          The file, or NULL if malloc fails. If the file cannot be read,    *
+ *          error_occurred is set.                                            *
+ *  Method:                                                                   *
+ *      The file is loaded with rssringoccs_Map_CSVFile. The rows are counted *
+ *      by searching for newlines with memchr, which the C libraries          *
+ *      vectorize, instead of calling fgetc for every character. Files of at  *
+ *      least two chunks are split into chunks of about                       *
+ *      RSSRINGOCCS_CSV_CHUNK_SIZE bytes, each moved forward to the start of  *
+ *      a line, and the rows of each chunk are counted in parallel with       *
+ *      OpenMP, if available. The chunks and their row counts are saved so    *
+ *      that rssringoccs_Read_CSV_Rows can parse them in parallel.            *
+ *  NOTES:                                                                    *
+ *      1.) Blank lines, such as a trailing empty line, are not counted.      *
+ *      2.) The chunks depend only on the file, not on the number of threads. *
+ *      3.) If the chunk table cannot be allocated, the file is counted, and  *
+ *          later parsed, on one thread. This is not an error.                *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) string.h:                                                             *
+ *          C standard library header. Used for memchr.                       *
+ *  3.) rss_ringoccs_bool.h:                                                  *
+ *          Header file containing rssringoccs_Bool, and True and False.      *
+ *  4.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <string.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  The approximate size, in bytes, of the chunks a file is split into.       */
+#define RSSRINGOCCS_CSV_CHUNK_SIZE (1UL << 20)
+
+/*  Returns true if [start, end) has nothing but whitespace.                  */
+static rssringoccs_Bool __is_blank_line(const char *start, const char *end)
+{
+    while (start < end)
+    {
+        if ((*start != ' ') && (*start != '\t') && (*start != '\r'))
+            return rssringoccs_False;
+        ++start;
+    }
+    return rssringoccs_True;
+}
+
+/*  Counts the lines in [start, end) that are not blank.                      */
+static unsigned long __count_rows(const char *start, const char *end)
+{
+    const char *line_end;
+    unsigned long n_rows = 0;
+
+    while (start < end)
+    {
+        line_end = (const char *)memchr(start, '\n', (size_t)(end - start));
+        if (line_end == NULL)
+            line_end = end;
+
+        if (!__is_blank_line(start, line_end))
+            ++n_rows;
+
+        start = line_end + 1;
+    }
+
+    return n_rows;
+}
+
+/*  Splits a large file into chunks and counts the rows of each. Returns      *
+ *  false if the chunk table could not be allocated.                          */
+static rssringoccs_Bool __count_chunks(rssringoccs_CSVFile *csv)
+{
+    const char *p;
+    unsigned long n, n_chunks, step;
+    long k;
+
+    n_chunks = csv->size / RSSRINGOCCS_CSV_CHUNK_SIZE;
+    step = csv->size / n_chunks;
+
+    csv->chunk_start = (unsigned long *)
+        malloc(sizeof(*csv->chunk_start) * (n_chunks + 1));
+    csv->chunk_rows = (unsigned long *)
+        malloc(sizeof(*csv->chunk_rows) * n_chunks);
+
+    if ((csv->chunk_start == NULL) || (csv->chunk_rows == NULL))
+    {
+        free(csv->chunk_start);
+        free(csv->chunk_rows);
+        csv->chunk_start = NULL;
+        csv->chunk_rows = NULL;
+        return rssringoccs_False;
+    }
+
+    /*  Move the start of each chunk forward to the start of the next line.   *
+     *  If a line is longer than a chunk, some chunks are empty.              */
+    csv->chunk_start[0] = 0;
+    for (n = 1; n < n_chunks; ++n)
+    {
+        p = (const char *)memchr(csv->data + n*step, '\n',
+                                 (size_t)(csv->size - n*step));
+        if (p == NULL)
+            csv->chunk_start[n] = csv->size;
+        else
+            csv->chunk_start[n] = (unsigned long)(p - csv->data) + 1;
+    }
+    csv->chunk_start[n_chunks] = csv->size;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (k = 0; k < (long)n_chunks; ++k)
+        csv->chunk_rows[k] = __count_rows(csv->data + csv->chunk_start[k],
+                                          csv->data + csv->chunk_start[k+1]);
+
+    csv->n_chunks = n_chunks;
+    for (n = 0; n < n_chunks; ++n)
+        csv->n_rows += csv->chunk_rows[n];
+
+    return rssringoccs_True;
+}
+
+/*  Function for opening a CSV file and counting its rows and columns.        */
+RSS_RINGOCCS_EXPORT rssringoccs_CSVFile *rssringoccs_Open_CSV(const char *filename)
+{
+    rssringoccs_CSVFile *csv;
+    const char *line, *line_end, *end, *comma;
+
+    csv = rssringoccs_Map_CSVFile(filename);
+    if (csv == NULL)
+        return csv;
+
+    if (csv->error_occurred)
+        return csv;
+
+    /*  Count the columns of the first row that is not blank.                 */
+    line = csv->data;
+    end = csv->data + csv->size;
+    while (line < end)
+    {
+        line_end = (const char *)memchr(line, '\n', (size_t)(end - line));
+        if (line_end == NULL)
+            line_end = end;
+
+        if (!__is_blank_line(line, line_end))
+        {
+            comma = line;
+            csv->n_columns = 1;
+            while ((comma = (const char *)memchr(
+                        comma, ',', (size_t)(line_end - comma))) != NULL)
+            {
+                ++csv->n_columns;
+                ++comma;
+            }
+            break;
+        }
+
+        line = line_end + 1;
+    }
+
+    /*  Count the rows, in chunks if the file is large enough.                */
+    if (csv->size >= 2*RSSRINGOCCS_CSV_CHUNK_SIZE)
+    {
+        if (__count_chunks(csv))
+            return csv;
+    }
+
+    csv->n_rows = __count_rows(csv->data, end);
+    return csv;
+}
+/*  End of rssringoccs_Open_CSV.                                              */
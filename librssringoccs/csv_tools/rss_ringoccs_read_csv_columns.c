@@ -0,0 +1,315 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                       rss_ringoccs_read_csv_columns                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Parse the numbers in a CSV file into one array per column.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Read_CSV_Rows:                                            *
+ *  Purpose:                                                                  *
+ *      Parses n_rows rows of csv, starting at row first_row, storing field m *
+ *      of row first_row + n in columns[m][n].                                *
+ *  Arguments:                                                                *
+ *      csv (rssringoccs_CSVFile *):                                          *
+ *          A file opened with rssringoccs_Open_CSV.                          *
+ *      columns (double **):                                                  *
+ *          An array of csv->n_columns pointers. Each is either NULL, in      *
+ *          which case that column is skipped, or points to n_rows doubles.   *
+ *      first_row (unsigned long):                                            *
+ *          The index of the first row to parse. Blank lines are not counted. *
+ *      n_rows (unsigned long):                                               *
+ *          The number of rows to parse.                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      A single pass over the file. The end of each line is found with       *
+ *      memchr, and each field is converted in place with                     *
+ *      rssringoccs_CSV_Parse_Double, so nothing is copied, and there is no   *
+ *      limit on the length of a line as there was with fgets. The rows       *
+ *      before first_row are skipped without being parsed, and the file is    *
+ *      not read past the last row requested.                                 *
+ *                                                                            *
+ *      If rssringoccs_Open_CSV split the file into chunks, the row counts of *
+ *      the chunks give the index of the first row of each, and hence where   *
+ *      its rows go in the columns. The chunks holding requested rows are     *
+ *      then parsed in parallel with OpenMP, if available, each writing to    *
+ *      its own part of the columns, so the rows are in the same order as on  *
+ *      a single thread and nothing has to be joined afterwards. Chunks with  *
+ *      no requested rows are not read.                                       *
+ *  NOTES:                                                                    *
+ *      1.) Blank lines are skipped, as in rssringoccs_Open_CSV.              *
+ *      2.) A row with fewer than csv->n_columns fields is an error. Fields   *
+ *          past csv->n_columns are ignored.                                  *
+ *      3.) A field that is not a number is read as 0, as with atof.          *
+ *      4.) It is an error if the file ends before the last row requested.    *
+ *      5.) The output, and the errors, are the same with any number of       *
+ *          threads. If the memory to track the chunks cannot be allocated,   *
+ *          the rows are parsed on a single thread.                           *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Read_CSV_Columns:                                         *
+ *  Purpose:                                                                  *
+ *      Parses every row of csv, storing field m of row n in columns[m][n].   *
+ *  Arguments:                                                                *
+ *      csv (rssringoccs_CSVFile *):                                          *
+ *          A file opened with rssringoccs_Open_CSV.                          *
+ *      columns (double **):                                                  *
+ *          An array of csv->n_columns pointers. Each is either NULL, in      *
+ *          which case that column is skipped, or points to csv->n_rows       *
+ *          doubles.                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Calls rssringoccs_Read_CSV_Rows for all csv->n_rows rows.             *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) string.h:                                                             *
+ *          C standard library header. Used for memchr.                       *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <string.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  Parses n_rows rows of [line, end), skipping the first skip rows, and      *
+ *  stores field m of the n-th row parsed in columns[m][offset + n]. Returns  *
+ *  the number of rows parsed. short_row is set if a row has fewer than       *
+ *  n_columns fields, in which case parsing stops there.                      */
+static unsigned long
+__parse_rows(double **columns, unsigned long n_columns,
+             const char *line, const char *end, unsigned long skip,
+             unsigned long n_rows, unsigned long offset,
+             rssringoccs_Bool *short_row)
+{
+    const char *line_end, *field, *stop, *p;
+    unsigned long n, m, row;
+    double x;
+
+    n = 0;
+    row = 0;
+    *short_row = rssringoccs_False;
+
+    while ((line < end) && (n < n_rows))
+    {
+        line_end = (const char *)memchr(line, '\n', (size_t)(end - line));
+        if (line_end == NULL)
+            line_end = end;
+
+        /*  Skip blank lines.                                                 */
+        p = line;
+        while ((p < line_end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+            ++p;
+
+        if (p == line_end)
+        {
+            line = line_end + 1;
+            continue;
+        }
+
+        /*  Skip the rows before the first requested without parsing them.    */
+        if (row < skip)
+        {
+            ++row;
+            line = line_end + 1;
+            continue;
+        }
+
+        field = line;
+        for (m = 0; m < n_columns; ++m)
+        {
+            if (field > line_end)
+            {
+                *short_row = rssringoccs_True;
+                return n;
+            }
+
+            if (columns[m] != NULL)
+            {
+                x = rssringoccs_CSV_Parse_Double(field, line_end, &stop);
+                columns[m][offset + n] = x;
+            }
+            else
+                stop = field;
+
+            /*  Move past the next comma. If there is none, the row is over.  */
+            p = (const char *)memchr(stop, ',', (size_t)(line_end - stop));
+            if (p == NULL)
+                field = line_end + 1;
+            else
+                field = p + 1;
+        }
+
+        ++n;
+        ++row;
+        line = line_end + 1;
+    }
+
+    return n;
+}
+
+/*  Parses the requested rows chunk by chunk, in parallel. Returns false if   *
+ *  the memory for the chunks could not be allocated, in which case nothing   *
+ *  has been parsed.                                                          */
+static rssringoccs_Bool
+__parse_chunks(rssringoccs_CSVFile *csv, double **columns,
+               unsigned long first_row, unsigned long n_rows,
+               unsigned long *n_parsed, rssringoccs_Bool *short_row)
+{
+    unsigned long *chunk_first, *parsed;
+    rssringoccs_Bool *chunk_short;
+    unsigned long n, row;
+    long k;
+
+    chunk_first = (unsigned long *)
+        malloc(sizeof(*chunk_first) * csv->n_chunks);
+    parsed = (unsigned long *)malloc(sizeof(*parsed) * csv->n_chunks);
+    chunk_short = (rssringoccs_Bool *)
+        malloc(sizeof(*chunk_short) * csv->n_chunks);
+
+    if ((chunk_first == NULL) || (parsed == NULL) || (chunk_short == NULL))
+    {
+        /*  free does nothing if the input is NULL, so this is safe.          */
+        free(chunk_first);
+        free(parsed);
+        free(chunk_short);
+        return rssringoccs_False;
+    }
+
+    /*  The index of the first row of each chunk.                             */
+    row = 0;
+    for (n = 0; n < csv->n_chunks; ++n)
+    {
+        chunk_first[n] = row;
+        row += csv->chunk_rows[n];
+    }
+
+    /*  Each chunk parses the requested rows it holds, in [lo, hi), into its  *
+     *  own part of the columns.                                              */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (k = 0; k < (long)csv->n_chunks; ++k)
+    {
+        unsigned long lo, hi;
+
+        lo = chunk_first[k];
+        hi = chunk_first[k] + csv->chunk_rows[k];
+
+        if (lo < first_row)
+            lo = first_row;
+
+        if (hi > first_row + n_rows)
+            hi = first_row + n_rows;
+
+        if (lo < hi)
+            parsed[k] = __parse_rows(columns, csv->n_columns,
+                                     csv->data + csv->chunk_start[k],
+                                     csv->data + csv->chunk_start[k+1],
+                                     lo - chunk_first[k], hi - lo,
+                                     lo - first_row, &chunk_short[k]);
+        else
+        {
+            parsed[k] = 0;
+            chunk_short[k] = rssringoccs_False;
+        }
+    }
+
+    *n_parsed = 0;
+    *short_row = rssringoccs_False;
+    for (n = 0; n < csv->n_chunks; ++n)
+    {
+        *n_parsed += parsed[n];
+        if (chunk_short[n])
+            *short_row = rssringoccs_True;
+    }
+
+    free(chunk_first);
+    free(parsed);
+    free(chunk_short);
+    return rssringoccs_True;
+}
+
+/*  Function for parsing a range of rows of a CSV file.                       */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Read_CSV_Rows(rssringoccs_CSVFile *csv, double **columns,
+                          unsigned long first_row, unsigned long n_rows)
+{
+    unsigned long n;
+    rssringoccs_Bool short_row, chunked;
+
+    if ((csv == NULL) || (columns == NULL))
+        return;
+
+    if (csv->error_occurred)
+        return;
+
+    chunked = rssringoccs_False;
+    if (csv->n_chunks > 0)
+        chunked = __parse_chunks(csv, columns, first_row, n_rows,
+                                 &n, &short_row);
+
+    if (!chunked)
+        n = __parse_rows(columns, csv->n_columns, csv->data,
+                         csv->data + csv->size, first_row, n_rows, 0,
+                         &short_row);
+
+    if (short_row)
+    {
+        csv->error_occurred = rssringoccs_True;
+        csv->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Read_CSV_Rows\n\n"
+            "A row of the CSV has fewer columns than the first row.\n"
+        );
+    }
+    else if (n < n_rows)
+    {
+        csv->error_occurred = rssringoccs_True;
+        csv->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Read_CSV_Rows\n\n"
+            "The CSV has fewer rows than were requested.\n"
+        );
+    }
+}
+/*  End of rssringoccs_Read_CSV_Rows.                                         */
+
+/*  Function for parsing the columns of a CSV file.                           */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Read_CSV_Columns(rssringoccs_CSVFile *csv, double **columns)
+{
+    if (csv == NULL)
+        return;
+
+    rssringoccs_Read_CSV_Rows(csv, columns, 0, csv->n_rows);
+}
+/*  End of rssringoccs_Read_CSV_Columns.                                      */
@@ -0,0 +1,246 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_tau_csv_cache                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Write and read binary caches of the TAU.TAB files on the PDS.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Write_TauCSV_Cache:                                       *
+ *  Purpose:                                                                  *
+ *      Writes the data in tau to a binary cache, see                         *
+ *      rss_ringoccs_csv_cache.c for the file format. The columns are named   *
+ *      after the members of rssringoccs_TauCSV, without the _vals suffix.    *
+ *  Arguments:                                                                *
+ *      tau (const rssringoccs_TauCSV *):                                     *
+ *          The data, usually from rssringoccs_Get_Tau.                       *
+ *      filename (const char *):                                              *
+ *          The path of the cache. For rssringoccs_Get_Tau to find it, this   *
+ *          is the path of the .TAB file followed by                          *
+ *          RSSRINGOCCS_CSV_CACHE_SUFFIX.                                     *
+ *  Output:                                                                   *
+ *      success (rssringoccs_Bool):                                           *
+ *          True if the cache was written.                                    *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Get_Tau_Cache:                                            *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Get_Tau, but reads a binary cache instead of a    *
+ *      .TAB file.                                                            *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path of the cache.                                            *
+ *      use_deprecated (rssringoccs_Bool):                                    *
+ *          As for rssringoccs_Get_Tau. The cache must not have the power     *
+ *          column if this is set, and must have it if not.                   *
+ *  Output:                                                                   *
+ *      tau (rssringoccs_TauCSV *):                                           *
+ *          The data. Errors are set in error_occurred and error_message.     *
+ *  Method:                                                                   *
+ *      The cache is mapped with rssringoccs_Open_CSV_Cache, and the members  *
+ *      of tau point into the mapping, so nothing is copied or parsed.        *
+ *      rssringoccs_Destroy_TauCSV_Members unmaps it.                         *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc.                       *
+ *  2.) stdio.h:                                                              *
+ *          C standard library header. Used for puts.                         *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_csv_tools.h:                                             *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <stdio.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+
+/*  The number of columns in the TAU.TAB files.                               */
+#define RSSRINGOCCS_TAU_CACHE_COLUMNS 13
+
+/*  The name and units of each column, in the order of the .TAB file.         */
+static const char * const __tau_names[RSSRINGOCCS_TAU_CACHE_COLUMNS] = {
+    "rho_km",
+    "rho_corr_pole_km",
+    "rho_corr_timing_km",
+    "phi_rl_deg",
+    "phi_ora_deg",
+    "power",
+    "tau",
+    "phase_deg",
+    "tau_threshold",
+    "t_oet_spm",
+    "t_ret_spm",
+    "t_set_spm",
+    "B_deg"
+};
+
+static const char * const __tau_units[RSSRINGOCCS_TAU_CACHE_COLUMNS] = {
+    "km",
+    "km",
+    "km",
+    "deg",
+    "deg",
+    "",
+    "",
+    "deg",
+    "",
+    "s",
+    "s",
+    "s",
+    "deg"
+};
+
+/*  Points members[n] to the member of tau for column n.                      */
+static void __tau_members(rssringoccs_TauCSV *tau, double **members[])
+{
+    members[0] = &tau->rho_km_vals;
+    members[1] = &tau->rho_corr_pole_km_vals;
+    members[2] = &tau->rho_corr_timing_km_vals;
+    members[3] = &tau->phi_rl_deg_vals;
+    members[4] = &tau->phi_ora_deg_vals;
+    members[5] = &tau->power_vals;
+    members[6] = &tau->tau_vals;
+    members[7] = &tau->phase_deg_vals;
+    members[8] = &tau->tau_threshold_vals;
+    members[9] = &tau->t_oet_spm_vals;
+    members[10] = &tau->t_ret_spm_vals;
+    members[11] = &tau->t_set_spm_vals;
+    members[12] = &tau->B_deg_vals;
+}
+
+/*  Function for writing the data from a TAU.TAB file to a binary cache.      */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Write_TauCSV_Cache(const rssringoccs_TauCSV *tau,
+                               const char *filename)
+{
+    double **members[RSSRINGOCCS_TAU_CACHE_COLUMNS];
+    double *columns[RSSRINGOCCS_TAU_CACHE_COLUMNS];
+    unsigned long n;
+
+    if (tau == NULL)
+        return rssringoccs_False;
+
+    if (tau->error_occurred)
+        return rssringoccs_False;
+
+    /*  The members are only read, so casting away const is safe.             */
+    __tau_members((rssringoccs_TauCSV *)tau, members);
+    for (n = 0; n < RSSRINGOCCS_TAU_CACHE_COLUMNS; ++n)
+        columns[n] = *members[n];
+
+    return rssringoccs_Write_CSV_Cache(filename, "TAU", __tau_names,
+                                       __tau_units, columns,
+                                       RSSRINGOCCS_TAU_CACHE_COLUMNS,
+                                       tau->n_elements);
+}
+/*  End of rssringoccs_Write_TauCSV_Cache.                                    */
+
+/*  Function for reading the data from a binary cache of a TAU.TAB file.      */
+RSS_RINGOCCS_EXPORT rssringoccs_TauCSV *
+rssringoccs_Get_Tau_Cache(const char *filename,
+                          rssringoccs_Bool use_deprecated)
+{
+    rssringoccs_TauCSV *tau;
+    double **members[RSSRINGOCCS_TAU_CACHE_COLUMNS];
+    unsigned long n;
+    rssringoccs_Bool has_columns;
+
+    tau = (rssringoccs_TauCSV *)malloc(sizeof(*tau));
+
+    /*  Check if malloc failed.                                               */
+    if (tau == NULL)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\trssringoccs_Get_Tau_Cache\n\n"
+             "Malloc failed and returned NULL for tau. Returning.\n");
+        return NULL;
+    }
+
+    __tau_members(tau, members);
+    for (n = 0; n < RSSRINGOCCS_TAU_CACHE_COLUMNS; ++n)
+        *members[n] = NULL;
+
+    tau->n_elements = 0;
+    tau->error_occurred = rssringoccs_False;
+    tau->error_message = NULL;
+    tau->cache = rssringoccs_Open_CSV_Cache(filename, "TAU");
+
+    if (tau->cache == NULL)
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Tau_Cache\n\n"
+            "Malloc returned NULL. Failed to allocate memory for.\n"
+            "cache. Aborting computation and returning.\n"
+        );
+        return tau;
+    }
+
+    /*  Pass on the error from reading the cache.                             */
+    if (tau->cache->error_occurred)
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = tau->cache->error_message;
+        tau->cache->error_message = NULL;
+        rssringoccs_Destroy_CSVFile(&tau->cache);
+        return tau;
+    }
+
+    /*  The members point into the mapping.                                   */
+    for (n = 0; n < RSSRINGOCCS_TAU_CACHE_COLUMNS; ++n)
+        *members[n] = rssringoccs_CSV_Cache_Column(tau->cache,
+                                                   __tau_names[n]);
+
+    /*  power must be there if and only if use_deprecated is false, as in     *
+     *  the .TAB file. Every other column is needed.                          */
+    if (use_deprecated)
+        has_columns = (tau->power_vals == NULL);
+    else
+        has_columns = (tau->power_vals != NULL);
+
+    for (n = 0; n < RSSRINGOCCS_TAU_CACHE_COLUMNS; ++n)
+        if ((*members[n] == NULL) &&
+            (members[n] != &tau->power_vals))
+            has_columns = rssringoccs_False;
+
+    if (!has_columns)
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "Error Encountered: rss_ringoccs\n"
+            "\trssringoccs_Get_Tau_Cache\n\n"
+            "Binary cache does not have the columns of a TAU.TAB file.\n"
+        );
+        rssringoccs_Destroy_TauCSV_Members(tau);
+        return tau;
+    }
+
+    tau->n_elements = tau->cache->n_rows;
+    return tau;
+}
+/*  End of rssringoccs_Get_Tau_Cache.                                         */
@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include <rss_ringoccs/include/rss_ringoccs_bool.h>
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 #include <rss_ringoccs/include/rss_ringoccs_fft.h>
@@ -5,10 +6,20 @@ RSS_RINGOCCS_EXPORT rssringoccs_ComplexDouble* rssringoccs_Complex_FFT(rssringoc
                         rssringoccs_Bool inverse)
 {
     rssringoccs_ComplexDouble *out;
-    if ((N > 0) && ((N & (N-1)) == 0))
-        out = rssringoccs_Complex_FFT_Cooley_Tukey(in, N, inverse);
-    else
-        out = rssringoccs_Complex_FFT_Bluestein_Chirp_Z(in, N, inverse);
+    rssringoccs_FFT_Plan *plan;
 
+    /*  The plan picks radix-4 for powers of two, mixed-radix for sizes with  *
+     *  factors 2, 3, and 5, and Bluestein otherwise.                         *
+     *  For repeated transforms of the same size, create the plan once with   *
+     *  rssringoccs_FFT_Plan_Create and call rssringoccs_FFT_Plan_Execute.    */
+    plan = rssringoccs_FFT_Plan_Create(N, inverse, RSSRINGOCCS_FFT_DEFAULT);
+    if (plan == NULL)
+        return NULL;
+
+    out = (rssringoccs_ComplexDouble *)malloc(sizeof(*out) * N);
+    if (out != NULL)
+        rssringoccs_FFT_Plan_Execute(plan, in, out);
+
+    rssringoccs_FFT_Plan_Destroy(plan);
     return out;
 }
@@ -0,0 +1,357 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                        rss_ringoccs_fft_plan_create                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Precompute everything needed for an FFT of a given size.              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_FFT_Plan_Create:                                          *
+ *  Purpose:                                                                  *
+ *      Creates a plan for the discrete Fourier transform of N points.        *
+ *  Arguments:                                                                *
+ *      N (unsigned long):                                                    *
+ *          The number of points in the transform.                            *
+ *      inverse (rssringoccs_Bool):                                           *
+ *          Boolean for whether the plan computes the inverse transform.      *
+ *      flags (unsigned int):                                                 *
+ *          RSSRINGOCCS_FFT_DEFAULT, or a combination of:                     *
+ *              RSSRINGOCCS_FFT_UNNORMALIZED:                                 *
+ *                  Skip the 1/N factor of the inverse transform.             *
+ *              RSSRINGOCCS_FFT_RADIX_2:                                      *
+ *                  Use radix-2 instead of radix-4 for powers of two.         *
+ *              RSSRINGOCCS_FFT_SPLIT_RADIX:                                  *
+ *                  Use split-radix instead of radix-4 for powers of two.     *
+ *              RSSRINGOCCS_FFT_REAL_INPUT:                                   *
+ *                  Make a plan for rssringoccs_FFT_Plan_Execute_Real.        *
+ *  Output:                                                                   *
+ *      plan (rssringoccs_FFT_Plan *):                                        *
+ *          The plan, or NULL if N is zero or malloc failed.                  *
+ *  Method:                                                                  *
+ *      The algorithm is chosen from N:                                       *
+ *                                                                            *
+ *          N a power of two:                                                 *
+ *              Radix-4 by default. The plan stores the twiddle factors and   *
+ *              the bit reversal permutation, and the transform does pairs    *
+ *              of radix-2 passes as one radix-4 pass, in place. This is half *
+ *              the passes over the data and 3 complex products for every 4   *
+ *              points instead of 4. RSSRINGOCCS_FFT_RADIX_2 does the radix-2 *
+ *              passes one at a time, and RSSRINGOCCS_FFT_SPLIT_RADIX uses    *
+ *              the recursive split-radix algorithm, which needs the fewest   *
+ *              multiplications of the three.                                 *
+ *          N = 2^a 3^b 5^c:                                                  *
+ *              Mixed-radix. N is factored into 5's, 4's, 3's, and 2's and    *
+ *              the transform is a recursive Cooley-Tukey using butterflies   *
+ *              for each factor, so the data need not be padded.              *
+ *          Anything else:                                                    *
+ *              Bluestein's chirp-z algorithm, which writes the transform as  *
+ *              a convolution:                                                *
+ *                                                                            *
+ *                  X_k = c_k sum_n (x_n c_n) conj(c_{k-n})                   *
+ *                                                                            *
+ *              with c_n = exp(-i pi n^2 / N). The convolution is computed    *
+ *              with a transform of size M >= 2N-1, where M is chosen as the  *
+ *              smallest number with prime factors 2, 3, and 5 only. The      *
+ *              chirp, the transform of conj(c_n), and the plan for size M    *
+ *              are all computed here, so that executing the plan only needs  *
+ *              two transforms of size M instead of three.                    *
+ *                                                                            *
+ *      With RSSRINGOCCS_FFT_REAL_INPUT and N even, the N real inputs are     *
+ *      packed as N/2 complex numbers z_n = x_{2n} + i x_{2n+1}, and the plan *
+ *      holds a complex plan of size N/2 and the twiddles used to separate    *
+ *      the transforms of the even and odd points afterwards. For odd N the   *
+ *      data is transformed as N complex numbers.                             *
+ *  NOTES:                                                                    *
+ *      1.) n^2 is reduced mod 2N before computing the chirp, since           *
+ *          exp(-i pi n^2 / N) has period 2N in n^2. This keeps the argument  *
+ *          of the exponential small and accurate for large n.                *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing the value of pi.                           *
+ *  3.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex arithmetic.                        *
+ *  4.) rss_ringoccs_fft.h:                                                   *
+ *          Header file where the rssringoccs_FFT_Plan typedef is found.      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+
+/*  Computes exp(-/+ 2 pi i k / N) for k < n_twiddles.                       */
+static rssringoccs_Bool
+__twiddle_table(rssringoccs_FFT_Plan *plan, unsigned long n_twiddles)
+{
+    unsigned long k;
+    double factor;
+
+    plan->twiddles = (rssringoccs_ComplexDouble *)
+                         malloc(sizeof(*plan->twiddles) * n_twiddles);
+
+    if (plan->twiddles == NULL)
+        return rssringoccs_False;
+
+    /*  The forward transform uses exp(-2 pi i k / N), the inverse exp(+...). */
+    if (plan->inverse)
+        factor = rssringoccs_Two_Pi/(double)plan->N;
+    else
+        factor = -rssringoccs_Two_Pi/(double)plan->N;
+
+    for (k = 0; k < n_twiddles; ++k)
+        plan->twiddles[k] = rssringoccs_CDouble_Polar(1.0, (double)k * factor);
+
+    return rssringoccs_True;
+}
+
+/*  Computes the twiddle factors and bit reversal table for a radix-2 or      *
+ *  radix-4 plan.                                                             */
+static rssringoccs_Bool __radix_2_tables(rssringoccs_FFT_Plan *plan)
+{
+    unsigned long k, n, r, bits, N;
+
+    N = plan->N;
+    plan->bit_reverse = (unsigned long *)malloc(sizeof(*plan->bit_reverse)*N);
+
+    if ((plan->bit_reverse == NULL) || (!__twiddle_table(plan, N)))
+        return rssringoccs_False;
+
+    /*  Number of bits in N-1, which is log2(N).                              */
+    bits = 0;
+    while ((1UL << bits) < N)
+        ++bits;
+
+    for (n = 0; n < N; ++n)
+    {
+        r = 0;
+        for (k = 0; k < bits; ++k)
+            r |= ((n >> k) & 1UL) << (bits - 1 - k);
+
+        plan->bit_reverse[n] = r;
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Splits N into factors of 5, 4, 3, and 2. Returns the number of factors,   *
+ *  or zero if N has any other prime factor.                                  */
+static unsigned int __factor(unsigned long N, unsigned long *factors)
+{
+    const unsigned long radices[4] = {5UL, 4UL, 3UL, 2UL};
+    unsigned int n_factors, k;
+
+    n_factors = 0;
+    for (k = 0; k < 4; ++k)
+    {
+        while ((N % radices[k]) == 0)
+        {
+            factors[n_factors] = radices[k];
+            ++n_factors;
+            N /= radices[k];
+        }
+    }
+
+    if (N != 1)
+        return 0;
+
+    return n_factors;
+}
+
+/*  Computes the twiddle factors, work space, and factors of N for a          *
+ *  split-radix or mixed-radix plan.                                          */
+static rssringoccs_Bool __recursive_tables(rssringoccs_FFT_Plan *plan)
+{
+    plan->work = (rssringoccs_ComplexDouble *)
+                     malloc(sizeof(*plan->work) * plan->N);
+
+    if ((plan->work == NULL) || (!__twiddle_table(plan, plan->N)))
+        return rssringoccs_False;
+
+    plan->n_factors = __factor(plan->N, plan->factors);
+    return rssringoccs_True;
+}
+
+/*  Computes the half size plan and the twiddle factors for a real plan.      */
+static rssringoccs_Bool __real_tables(rssringoccs_FFT_Plan *plan)
+{
+    unsigned long M;
+
+    /*  The sub plan is never normalized. The 1/N is done afterwards.         */
+    if (plan->N & 1UL)
+        M = plan->N;
+    else
+        M = plan->N >> 1;
+
+    plan->work     = (rssringoccs_ComplexDouble *)
+                         malloc(sizeof(*plan->work) * M);
+    plan->sub_plan = rssringoccs_FFT_Plan_Create(M, plan->inverse,
+                                                 RSSRINGOCCS_FFT_UNNORMALIZED);
+
+    if ((plan->work == NULL) || (plan->sub_plan == NULL))
+        return rssringoccs_False;
+
+    if (plan->N & 1UL)
+        return rssringoccs_True;
+
+    return __twiddle_table(plan, M + 1);
+}
+
+/*  Computes the chirp and its transform for a Bluestein plan.                */
+static rssringoccs_Bool __bluestein_tables(rssringoccs_FFT_Plan *plan)
+{
+    unsigned long n, M, N, two_N, n_sq;
+    unsigned long factors[RSSRINGOCCS_FFT_MAX_FACTORS];
+    double factor, rcpr_M;
+
+    N = plan->N;
+    two_N = 2*N;
+
+    /*  Smallest size with factors 2, 3, and 5 that can hold the linear       *
+     *  convolution. These sizes are never much more than 2N-1, and the       *
+     *  mixed-radix plan handles them without padding.                        */
+    M = 2*N - 1;
+    while (__factor(M, factors) == 0)
+        ++M;
+
+    plan->chirp     = (rssringoccs_ComplexDouble *)
+                          malloc(sizeof(*plan->chirp) * N);
+    plan->chirp_fft = (rssringoccs_ComplexDouble *)
+                          malloc(sizeof(*plan->chirp_fft) * M);
+    plan->work      = (rssringoccs_ComplexDouble *)
+                          malloc(sizeof(*plan->work) * M);
+    plan->sub_plan  = rssringoccs_FFT_Plan_Create(M, rssringoccs_False,
+                                                  RSSRINGOCCS_FFT_DEFAULT);
+
+    if ((plan->chirp == NULL) || (plan->chirp_fft == NULL) ||
+        (plan->work == NULL) || (plan->sub_plan == NULL))
+        return rssringoccs_False;
+
+    if (plan->inverse)
+        factor = rssringoccs_One_Pi/(double)N;
+    else
+        factor = -rssringoccs_One_Pi/(double)N;
+
+    /*  c_n = exp(-/+ i pi n^2 / N). n^2 is reduced mod 2N first.             */
+    for (n = 0; n < N; ++n)
+    {
+        n_sq = ((n % two_N) * (n % two_N)) % two_N;
+        plan->chirp[n] = rssringoccs_CDouble_Polar(1.0, (double)n_sq * factor);
+    }
+
+    /*  conj(c_m) at m and M - m, so that the cyclic convolution of size M    *
+     *  equals the linear one for the N outputs we need.                      */
+    for (n = 0; n < M; ++n)
+        plan->chirp_fft[n] = rssringoccs_CDouble_Zero;
+
+    plan->chirp_fft[0] = rssringoccs_CDouble_Conjugate(plan->chirp[0]);
+    for (n = 1; n < N; ++n)
+    {
+        plan->chirp_fft[n]     = rssringoccs_CDouble_Conjugate(plan->chirp[n]);
+        plan->chirp_fft[M - n] = plan->chirp_fft[n];
+    }
+
+    rssringoccs_FFT_Plan_Execute(plan->sub_plan, plan->chirp_fft,
+                                 plan->chirp_fft);
+
+    /*  The inverse transform of size M is done with the forward plan, so     *
+     *  fold its 1/M factor in here.                                          */
+    rcpr_M = 1.0/(double)M;
+    for (n = 0; n < M; ++n)
+        plan->chirp_fft[n] = rssringoccs_CDouble_Multiply_Real(
+            rcpr_M, plan->chirp_fft[n]
+        );
+
+    return rssringoccs_True;
+}
+
+/*  Function for creating an FFT plan of size N.                              */
+RSS_RINGOCCS_EXPORT rssringoccs_FFT_Plan *
+rssringoccs_FFT_Plan_Create(unsigned long N, rssringoccs_Bool inverse,
+                            unsigned int flags)
+{
+    rssringoccs_FFT_Plan *plan;
+    rssringoccs_Bool success;
+
+    if (N == 0)
+        return NULL;
+
+    plan = (rssringoccs_FFT_Plan *)malloc(sizeof(*plan));
+    if (plan == NULL)
+        return NULL;
+
+    /*  Set all pointers to NULL so the plan can be safely destroyed if one   *
+     *  of the allocations below fails.                                       */
+    plan->N           = N;
+    plan->inverse     = inverse;
+    plan->flags       = flags;
+    plan->twiddles    = NULL;
+    plan->bit_reverse = NULL;
+    plan->chirp       = NULL;
+    plan->chirp_fft   = NULL;
+    plan->work        = NULL;
+    plan->sub_plan    = NULL;
+    plan->n_factors   = 0;
+
+    if (flags & RSSRINGOCCS_FFT_REAL_INPUT)
+    {
+        plan->algorithm = rssringoccs_FFT_Real;
+        success = __real_tables(plan);
+    }
+    else if (((N & (N-1)) == 0) && (flags & RSSRINGOCCS_FFT_SPLIT_RADIX))
+    {
+        plan->algorithm = rssringoccs_FFT_Split_Radix;
+        success = __recursive_tables(plan);
+    }
+    else if ((N & (N-1)) == 0)
+    {
+        if (flags & RSSRINGOCCS_FFT_RADIX_2)
+            plan->algorithm = rssringoccs_FFT_Radix_2;
+        else
+            plan->algorithm = rssringoccs_FFT_Radix_4;
+
+        success = __radix_2_tables(plan);
+    }
+    else if (__factor(N, plan->factors) != 0)
+    {
+        plan->algorithm = rssringoccs_FFT_Mixed_Radix;
+        success = __recursive_tables(plan);
+    }
+    else
+    {
+        plan->algorithm = rssringoccs_FFT_Bluestein;
+        success = __bluestein_tables(plan);
+    }
+
+    if (!success)
+    {
+        rssringoccs_FFT_Plan_Destroy(plan);
+        return NULL;
+    }
+
+    return plan;
+}
+/*  End of rssringoccs_FFT_Plan_Create.                                       */
@@ -0,0 +1,44 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                       rss_ringoccs_fft_plan_destroy                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Free an FFT plan and all of the memory it owns.                       *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+
+/*  Function for freeing an FFT plan. NULL is allowed and does nothing.       */
+RSS_RINGOCCS_EXPORT void rssringoccs_FFT_Plan_Destroy(rssringoccs_FFT_Plan *plan)
+{
+    if (plan == NULL)
+        return;
+
+    /*  free does nothing if the input is NULL, so this is safe.              */
+    free(plan->twiddles);
+    free(plan->bit_reverse);
+    free(plan->chirp);
+    free(plan->chirp_fft);
+    free(plan->work);
+    rssringoccs_FFT_Plan_Destroy(plan->sub_plan);
+    free(plan);
+}
+/*  End of rssringoccs_FFT_Plan_Destroy.                                      */
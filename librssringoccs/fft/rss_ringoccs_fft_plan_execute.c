@@ -0,0 +1,472 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                       rss_ringoccs_fft_plan_execute                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compute a discrete Fourier transform using a precomputed plan.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_FFT_Plan_Execute:                                         *
+ *  Purpose:                                                                  *
+ *      Computes the transform of in, as described by plan, and stores it in  *
+ *      out.                                                                  *
+ *  Arguments:                                                                *
+ *      plan (rssringoccs_FFT_Plan *):                                        *
+ *          A plan from rssringoccs_FFT_Plan_Create.                          *
+ *      in (const rssringoccs_ComplexDouble *):                               *
+ *          The input data, plan->N points.                                   *
+ *      out (rssringoccs_ComplexDouble *):                                    *
+ *          The output, plan->N points. This may be the same array as in.     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                  *
+ *      Radix-2 and radix-4 plans permute the input into bit reversed order   *
+ *      and then do passes of butterflies in place. A radix-4 pass does two   *
+ *      radix-2 passes at once. For a block of 4q points with twiddles        *
+ *      w^j = exp(-2 pi i j k / 4q), the two passes give                      *
+ *                                                                            *
+ *          y_k     = (x_0 + w^2 x_1) + (w x_2 + w^3 x_3)                     *
+ *          y_{k+q} = (x_0 - w^2 x_1) - i (w x_2 - w^3 x_3)                   *
+ *                                                                            *
+ *      and so on, where x_j is the value at k + jq. If log2(N) is odd, one   *
+ *      radix-2 pass is done first.                                           *
+ *                                                                            *
+ *      Split-radix plans split the transform into one of size N/2 for the    *
+ *      even points and two of size N/4 for the points 1 and 3 mod 4, and     *
+ *      combine these with an L-shaped butterfly. Mixed-radix plans split a   *
+ *      transform of size n = p m into p transforms of size m, p the first    *
+ *      factor, and combine these with a butterfly of size p. Both recurse    *
+ *      out of place, using plan->work when in and out are the same.          *
+ *                                                                            *
+ *      Bluestein plans multiply by the chirp, convolve with the conjugate    *
+ *      chirp using the plan of size M, and multiply by the chirp again. The  *
+ *      inverse transform of size M is computed with the forward plan via     *
+ *                                                                            *
+ *          ifft(X) = conj(fft(conj(X))) / M                                  *
+ *                                                                            *
+ *      where the 1/M is already part of the stored chirp spectrum.           *
+ *  NOTES:                                                                    *
+ *      1.) Bluestein, split-radix, and mixed-radix plans use plan->work, so  *
+ *          the same plan must not be executed by two threads at once.        *
+ *      2.) Real plans are run with rssringoccs_FFT_Plan_Execute_Real. This   *
+ *          function does nothing for them.                                   *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex arithmetic.                        *
+ *  3.) rss_ringoccs_fft.h:                                                   *
+ *          Header file where the rssringoccs_FFT_Plan typedef is found.      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+
+/*  Multiplies by -i for forward transforms, and by +i for inverse ones.      */
+static rssringoccs_ComplexDouble
+__rotate(const rssringoccs_FFT_Plan *plan, rssringoccs_ComplexDouble z)
+{
+    double re, im;
+
+    re = rssringoccs_CDouble_Real_Part(z);
+    im = rssringoccs_CDouble_Imag_Part(z);
+
+    if (plan->inverse)
+        return rssringoccs_CDouble_Rect(-im, re);
+    else
+        return rssringoccs_CDouble_Rect(im, -re);
+}
+
+/*  In-place radix-2 pass over blocks of len points.                          */
+static void
+__radix_2_pass(const rssringoccs_FFT_Plan *plan,
+               rssringoccs_ComplexDouble *out, unsigned long len)
+{
+    unsigned long half, step, n, k;
+    rssringoccs_ComplexDouble u, v;
+
+    half = len >> 1;
+    step = plan->N / len;
+
+    for (n = 0; n < plan->N; n += len)
+    {
+        for (k = 0; k < half; ++k)
+        {
+            u = out[n + k];
+            v = rssringoccs_CDouble_Multiply(plan->twiddles[k*step],
+                                             out[n + k + half]);
+            out[n + k]        = rssringoccs_CDouble_Add(u, v);
+            out[n + k + half] = rssringoccs_CDouble_Subtract(u, v);
+        }
+    }
+}
+
+/*  In-place radix-4 pass over blocks of 4q points. This is the same as the   *
+ *  radix-2 passes for blocks of 2q and 4q points done one after the other.   */
+static void
+__radix_4_pass(const rssringoccs_FFT_Plan *plan,
+               rssringoccs_ComplexDouble *out, unsigned long q)
+{
+    unsigned long n, k, step, len;
+    rssringoccs_ComplexDouble x0, t1, t2, t3, b0, b1, c2, c3;
+
+    len  = q << 2;
+    step = plan->N / len;
+
+    for (n = 0; n < plan->N; n += len)
+    {
+        for (k = 0; k < q; ++k)
+        {
+            x0 = out[n + k];
+            t1 = rssringoccs_CDouble_Multiply(plan->twiddles[2*k*step],
+                                              out[n + k + q]);
+            t2 = rssringoccs_CDouble_Multiply(plan->twiddles[k*step],
+                                              out[n + k + 2*q]);
+            t3 = rssringoccs_CDouble_Multiply(plan->twiddles[3*k*step],
+                                              out[n + k + 3*q]);
+
+            b0 = rssringoccs_CDouble_Add(x0, t1);
+            b1 = rssringoccs_CDouble_Subtract(x0, t1);
+            c2 = rssringoccs_CDouble_Add(t2, t3);
+            c3 = __rotate(plan, rssringoccs_CDouble_Subtract(t2, t3));
+
+            out[n + k]       = rssringoccs_CDouble_Add(b0, c2);
+            out[n + k + q]   = rssringoccs_CDouble_Add(b1, c3);
+            out[n + k + 2*q] = rssringoccs_CDouble_Subtract(b0, c2);
+            out[n + k + 3*q] = rssringoccs_CDouble_Subtract(b1, c3);
+        }
+    }
+}
+
+/*  Radix-2 or radix-4 transform, out of place or in place.                   */
+static void
+__radix_2_execute(const rssringoccs_FFT_Plan *plan,
+                  const rssringoccs_ComplexDouble *in,
+                  rssringoccs_ComplexDouble *out)
+{
+    unsigned long n, r, len;
+    rssringoccs_ComplexDouble tmp;
+
+    /*  Bit reversal is its own inverse, so swapping pairs works in place.    */
+    if (in == out)
+    {
+        for (n = 0; n < plan->N; ++n)
+        {
+            r = plan->bit_reverse[n];
+            if (r > n)
+            {
+                tmp    = out[n];
+                out[n] = out[r];
+                out[r] = tmp;
+            }
+        }
+    }
+    else
+    {
+        for (n = 0; n < plan->N; ++n)
+            out[plan->bit_reverse[n]] = in[n];
+    }
+
+    if (plan->algorithm == rssringoccs_FFT_Radix_2)
+    {
+        for (len = 2; len <= plan->N; len <<= 1)
+            __radix_2_pass(plan, out, len);
+        return;
+    }
+
+    /*  If log2(N) is odd, one radix-2 pass leaves an even number of passes.  */
+    len = 1;
+    while ((len << 2) <= plan->N)
+        len <<= 2;
+
+    if (len < plan->N)
+    {
+        __radix_2_pass(plan, out, 2);
+        len = 2;
+    }
+    else
+        len = 1;
+
+    for (; (len << 2) <= plan->N; len <<= 2)
+        __radix_4_pass(plan, out, len);
+}
+
+/*  Recursive split-radix transform of n points of in, spaced stride apart.   */
+static void
+__split_radix(const rssringoccs_FFT_Plan *plan,
+              const rssringoccs_ComplexDouble *in, unsigned long stride,
+              rssringoccs_ComplexDouble *out, unsigned long n)
+{
+    unsigned long k, q, step;
+    rssringoccs_ComplexDouble u0, u1, z, z3, s, d;
+
+    if (n == 1)
+    {
+        out[0] = in[0];
+        return;
+    }
+    else if (n == 2)
+    {
+        out[0] = rssringoccs_CDouble_Add(in[0], in[stride]);
+        out[1] = rssringoccs_CDouble_Subtract(in[0], in[stride]);
+        return;
+    }
+
+    q    = n >> 2;
+    step = plan->N / n;
+
+    /*  Even points in the first half, 1 mod 4 and 3 mod 4 in the quarters.   */
+    __split_radix(plan, in, 2*stride, out, 2*q);
+    __split_radix(plan, in + stride, 4*stride, out + 2*q, q);
+    __split_radix(plan, in + 3*stride, 4*stride, out + 3*q, q);
+
+    for (k = 0; k < q; ++k)
+    {
+        u0 = out[k];
+        u1 = out[k + q];
+        z  = rssringoccs_CDouble_Multiply(plan->twiddles[k*step],
+                                          out[k + 2*q]);
+        z3 = rssringoccs_CDouble_Multiply(plan->twiddles[3*k*step],
+                                          out[k + 3*q]);
+        s = rssringoccs_CDouble_Add(z, z3);
+        d = __rotate(plan, rssringoccs_CDouble_Subtract(z, z3));
+
+        out[k]       = rssringoccs_CDouble_Add(u0, s);
+        out[k + q]   = rssringoccs_CDouble_Add(u1, d);
+        out[k + 2*q] = rssringoccs_CDouble_Subtract(u0, s);
+        out[k + 3*q] = rssringoccs_CDouble_Subtract(u1, d);
+    }
+}
+
+/*  Transform of size p = 2, 3, 4, or 5 of the points in y, stored in y.      */
+static void
+__small_dft(const rssringoccs_FFT_Plan *plan,
+            rssringoccs_ComplexDouble *y, unsigned long p)
+{
+    /*  cos(2 pi / 3), sin(2 pi / 3), and cos and sin of 2 pi/5 and 4 pi/5.   */
+    const double c3  = -0.5;
+    const double s3  =  0.86602540378443864676;
+    const double c51 =  0.30901699437494742410;
+    const double c52 = -0.80901699437494742410;
+    const double s51 =  0.95105651629515357212;
+    const double s52 =  0.58778525229247312917;
+
+    double sign;
+    rssringoccs_ComplexDouble t0, t1, t2, t3, t4, a1, a2, b1, b2;
+
+    /*  The forward transform uses exp(-2 pi i k / p), the inverse exp(+...). */
+    if (plan->inverse)
+        sign = 1.0;
+    else
+        sign = -1.0;
+
+    if (p == 2)
+    {
+        t0   = y[0];
+        y[0] = rssringoccs_CDouble_Add(t0, y[1]);
+        y[1] = rssringoccs_CDouble_Subtract(t0, y[1]);
+    }
+    else if (p == 3)
+    {
+        t1 = rssringoccs_CDouble_Add(y[1], y[2]);
+        t2 = rssringoccs_CDouble_Subtract(y[1], y[2]);
+        a1 = rssringoccs_CDouble_Add(y[0],
+                                     rssringoccs_CDouble_Multiply_Real(c3, t1));
+        b1 = rssringoccs_CDouble_Multiply_Imag(sign*s3, t2);
+
+        y[0] = rssringoccs_CDouble_Add(y[0], t1);
+        y[1] = rssringoccs_CDouble_Add(a1, b1);
+        y[2] = rssringoccs_CDouble_Subtract(a1, b1);
+    }
+    else if (p == 4)
+    {
+        t0 = rssringoccs_CDouble_Add(y[0], y[2]);
+        t1 = rssringoccs_CDouble_Subtract(y[0], y[2]);
+        t2 = rssringoccs_CDouble_Add(y[1], y[3]);
+        t3 = __rotate(plan, rssringoccs_CDouble_Subtract(y[1], y[3]));
+
+        y[0] = rssringoccs_CDouble_Add(t0, t2);
+        y[1] = rssringoccs_CDouble_Add(t1, t3);
+        y[2] = rssringoccs_CDouble_Subtract(t0, t2);
+        y[3] = rssringoccs_CDouble_Subtract(t1, t3);
+    }
+    else
+    {
+        t1 = rssringoccs_CDouble_Add(y[1], y[4]);
+        t2 = rssringoccs_CDouble_Add(y[2], y[3]);
+        t3 = rssringoccs_CDouble_Subtract(y[1], y[4]);
+        t4 = rssringoccs_CDouble_Subtract(y[2], y[3]);
+
+        a1 = rssringoccs_CDouble_Add(
+            y[0], rssringoccs_CDouble_Add(
+                rssringoccs_CDouble_Multiply_Real(c51, t1),
+                rssringoccs_CDouble_Multiply_Real(c52, t2)
+            )
+        );
+        a2 = rssringoccs_CDouble_Add(
+            y[0], rssringoccs_CDouble_Add(
+                rssringoccs_CDouble_Multiply_Real(c52, t1),
+                rssringoccs_CDouble_Multiply_Real(c51, t2)
+            )
+        );
+        b1 = rssringoccs_CDouble_Add(
+            rssringoccs_CDouble_Multiply_Imag(sign*s51, t3),
+            rssringoccs_CDouble_Multiply_Imag(sign*s52, t4)
+        );
+        b2 = rssringoccs_CDouble_Subtract(
+            rssringoccs_CDouble_Multiply_Imag(sign*s52, t3),
+            rssringoccs_CDouble_Multiply_Imag(sign*s51, t4)
+        );
+
+        y[0] = rssringoccs_CDouble_Add(y[0], rssringoccs_CDouble_Add(t1, t2));
+        y[1] = rssringoccs_CDouble_Add(a1, b1);
+        y[2] = rssringoccs_CDouble_Add(a2, b2);
+        y[3] = rssringoccs_CDouble_Subtract(a2, b2);
+        y[4] = rssringoccs_CDouble_Subtract(a1, b1);
+    }
+}
+
+/*  Recursive mixed-radix transform of n points of in, spaced stride apart,   *
+ *  using the factors of the plan starting at plan->factors[f].               */
+static void
+__mixed_radix(const rssringoccs_FFT_Plan *plan,
+              const rssringoccs_ComplexDouble *in, unsigned long stride,
+              rssringoccs_ComplexDouble *out, unsigned long n, unsigned int f)
+{
+    unsigned long j, k, p, m, step;
+    rssringoccs_ComplexDouble y[5];
+
+    if (n == 1)
+    {
+        out[0] = in[0];
+        return;
+    }
+
+    p    = plan->factors[f];
+    m    = n / p;
+    step = plan->N / n;
+
+    /*  Transform the points j mod p for each j, and store them in order.     */
+    for (j = 0; j < p; ++j)
+        __mixed_radix(plan, in + j*stride, p*stride, out + j*m, m, f + 1);
+
+    for (k = 0; k < m; ++k)
+    {
+        y[0] = out[k];
+        for (j = 1; j < p; ++j)
+            y[j] = rssringoccs_CDouble_Multiply(plan->twiddles[j*k*step],
+                                                out[k + j*m]);
+
+        __small_dft(plan, y, p);
+
+        for (j = 0; j < p; ++j)
+            out[k + j*m] = y[j];
+    }
+}
+
+/*  Bluestein's algorithm, out of place or in place.                          */
+static void
+__bluestein_execute(rssringoccs_FFT_Plan *plan,
+                    const rssringoccs_ComplexDouble *in,
+                    rssringoccs_ComplexDouble *out)
+{
+    unsigned long n, M;
+    rssringoccs_ComplexDouble *work;
+
+    M = plan->sub_plan->N;
+    work = plan->work;
+
+    /*  a_n = x_n c_n, padded with zeros to size M.                           */
+    for (n = 0; n < plan->N; ++n)
+        work[n] = rssringoccs_CDouble_Multiply(in[n], plan->chirp[n]);
+
+    for (n = plan->N; n < M; ++n)
+        work[n] = rssringoccs_CDouble_Zero;
+
+    rssringoccs_FFT_Plan_Execute(plan->sub_plan, work, work);
+
+    /*  Multiply by the spectrum of the conjugate chirp, and conjugate so the *
+     *  forward plan computes the inverse transform.                          */
+    for (n = 0; n < M; ++n)
+        work[n] = rssringoccs_CDouble_Conjugate(
+            rssringoccs_CDouble_Multiply(work[n], plan->chirp_fft[n])
+        );
+
+    rssringoccs_FFT_Plan_Execute(plan->sub_plan, work, work);
+
+    /*  X_k = c_k conj(work_k).                                               */
+    for (n = 0; n < plan->N; ++n)
+        out[n] = rssringoccs_CDouble_Multiply(
+            plan->chirp[n], rssringoccs_CDouble_Conjugate(work[n])
+        );
+}
+
+/*  Function for computing an FFT from a plan.                                */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_FFT_Plan_Execute(rssringoccs_FFT_Plan *plan,
+                             const rssringoccs_ComplexDouble *in,
+                             rssringoccs_ComplexDouble *out)
+{
+    unsigned long n;
+    double rcpr_N;
+
+    if ((plan == NULL) || (in == NULL) || (out == NULL))
+        return;
+
+    if ((plan->algorithm == rssringoccs_FFT_Radix_2) ||
+        (plan->algorithm == rssringoccs_FFT_Radix_4))
+        __radix_2_execute(plan, in, out);
+    else if (plan->algorithm == rssringoccs_FFT_Bluestein)
+        __bluestein_execute(plan, in, out);
+    else if (plan->algorithm == rssringoccs_FFT_Real)
+        return;
+    else
+    {
+        /*  The recursive transforms are out of place. Copy in to the work    *
+         *  space first if the transform is in place.                         */
+        if (in == out)
+        {
+            for (n = 0; n < plan->N; ++n)
+                plan->work[n] = in[n];
+
+            in = plan->work;
+        }
+
+        if (plan->algorithm == rssringoccs_FFT_Split_Radix)
+            __split_radix(plan, in, 1, out, plan->N);
+        else
+            __mixed_radix(plan, in, 1, out, plan->N, 0);
+    }
+
+    /*  The inverse Fourier transform has a 1/N factor in front of the sum.   */
+    if ((plan->inverse) && !(plan->flags & RSSRINGOCCS_FFT_UNNORMALIZED))
+    {
+        rcpr_N = 1.0/(double)plan->N;
+        for (n = 0; n < plan->N; ++n)
+            out[n] = rssringoccs_CDouble_Multiply_Real(rcpr_N, out[n]);
+    }
+}
+/*  End of rssringoccs_FFT_Plan_Execute.                                      */
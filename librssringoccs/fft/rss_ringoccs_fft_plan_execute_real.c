@@ -0,0 +1,138 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                     rss_ringoccs_fft_plan_execute_real                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compute the discrete Fourier transform of real data using a plan.     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_FFT_Plan_Execute_Real:                                    *
+ *  Purpose:                                                                  *
+ *      Computes the transform of the real array in, as described by plan,    *
+ *      and stores the first N/2+1 values in out.                             *
+ *  Arguments:                                                                *
+ *      plan (rssringoccs_FFT_Plan *):                                        *
+ *          A plan from rssringoccs_FFT_Plan_Create made with the             *
+ *          RSSRINGOCCS_FFT_REAL_INPUT flag.                                  *
+ *      in (const double *):                                                  *
+ *          The input data, plan->N points.                                   *
+ *      out (rssringoccs_ComplexDouble *):                                    *
+ *          The output, plan->N/2 + 1 points.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      For even N, pack the data as z_n = x_{2n} + i x_{2n+1}, n < N/2, and  *
+ *      compute the transform Z_k of size N/2. If E_k and O_k are the         *
+ *      transforms of the even and odd points, then since these are real,     *
+ *                                                                            *
+ *          E_k = (Z_k + conj(Z_{N/2-k})) / 2                                 *
+ *          O_k = (Z_k - conj(Z_{N/2-k})) / 2i                                *
+ *                                                                            *
+ *      and X_k = E_k + exp(-2 pi i k / N) O_k for k <= N/2. This is one      *
+ *      complex transform of half the size, about half the work of a complex  *
+ *      transform of size N. For odd N the data is transformed as complex     *
+ *      numbers with zero imaginary part.                                     *
+ *  NOTES:                                                                    *
+ *      1.) Inverse real plans use exp(+2 pi i k / N) and scale by 1/N unless *
+ *          the plan is unnormalized, same as the complex plans.              *
+ *      2.) This function does nothing if the plan is not a real plan.        *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex arithmetic.                        *
+ *  3.) rss_ringoccs_fft.h:                                                   *
+ *          Header file where the rssringoccs_FFT_Plan typedef is found.      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+
+/*  Function for computing an FFT of real data from a plan.                   */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_FFT_Plan_Execute_Real(rssringoccs_FFT_Plan *plan, const double *in,
+                                  rssringoccs_ComplexDouble *out)
+{
+    unsigned long n, k, half;
+    double rcpr_N;
+    rssringoccs_ComplexDouble z, z_conj, even, odd;
+
+    if ((plan == NULL) || (in == NULL) || (out == NULL))
+        return;
+
+    if (plan->algorithm != rssringoccs_FFT_Real)
+        return;
+
+    half = plan->N >> 1;
+
+    /*  For odd N, compute the complex transform and keep the first half.     */
+    if (plan->N & 1UL)
+    {
+        for (n = 0; n < plan->N; ++n)
+            plan->work[n] = rssringoccs_CDouble_Rect(in[n], 0.0);
+
+        rssringoccs_FFT_Plan_Execute(plan->sub_plan, plan->work, plan->work);
+
+        for (k = 0; k <= half; ++k)
+            out[k] = plan->work[k];
+    }
+    else
+    {
+        for (n = 0; n < half; ++n)
+            plan->work[n] = rssringoccs_CDouble_Rect(in[2*n], in[2*n + 1]);
+
+        rssringoccs_FFT_Plan_Execute(plan->sub_plan, plan->work, plan->work);
+
+        /*  Separate the transforms of the even and odd points. Z is periodic *
+         *  with period N/2, so Z_{N/2} is Z_0.                               */
+        for (k = 0; k <= half; ++k)
+        {
+            z      = plan->work[k % half];
+            z_conj = plan->work[(half - k) % half];
+            z_conj = rssringoccs_CDouble_Conjugate(z_conj);
+
+            even = rssringoccs_CDouble_Multiply_Real(
+                0.5, rssringoccs_CDouble_Add(z, z_conj)
+            );
+            odd  = rssringoccs_CDouble_Multiply_Imag(
+                -0.5, rssringoccs_CDouble_Subtract(z, z_conj)
+            );
+
+            out[k] = rssringoccs_CDouble_Add(
+                even, rssringoccs_CDouble_Multiply(plan->twiddles[k], odd)
+            );
+        }
+    }
+
+    /*  The inverse Fourier transform has a 1/N factor in front of the sum.   */
+    if ((plan->inverse) && !(plan->flags & RSSRINGOCCS_FFT_UNNORMALIZED))
+    {
+        rcpr_N = 1.0/(double)plan->N;
+        for (k = 0; k <= half; ++k)
+            out[k] = rssringoccs_CDouble_Multiply_Real(rcpr_N, out[k]);
+    }
+}
+/*  End of rssringoccs_FFT_Plan_Execute_Real.                                 */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                           rss_ringoccs_real_fft                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compute the discrete Fourier transform of real data.                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Real_FFT:                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the FFT of the N real numbers in.                            *
+ *  Arguments:                                                                *
+ *      in (double *):                                                        *
+ *          The input data, N points.                                         *
+ *      N (unsigned long):                                                    *
+ *          The number of points in in.                                       *
+ *      inverse (rssringoccs_Bool):                                           *
+ *          Boolean for whether to compute the inverse transform.             *
+ *  Output:                                                                   *
+ *      out (rssringoccs_ComplexDouble *):                                    *
+ *          The first N/2+1 values of the transform. The rest are the         *
+ *          conjugates of these. Returns NULL if malloc fails or N is zero.   *
+ *  NOTES:                                                                    *
+ *      1.) For repeated transforms of the same size, create the plan once    *
+ *          with rssringoccs_FFT_Plan_Create and RSSRINGOCCS_FFT_REAL_INPUT,  *
+ *          and call rssringoccs_FFT_Plan_Execute_Real.                       *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc.                       *
+ *  2.) rss_ringoccs_fft.h:                                                   *
+ *          Header file containing the FFT plans.                             *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+
+/*  Function for computing the FFT of real data.                              */
+RSS_RINGOCCS_EXPORT rssringoccs_ComplexDouble *
+rssringoccs_Real_FFT(double *in, unsigned long N, rssringoccs_Bool inverse)
+{
+    rssringoccs_ComplexDouble *out;
+    rssringoccs_FFT_Plan *plan;
+
+    plan = rssringoccs_FFT_Plan_Create(N, inverse, RSSRINGOCCS_FFT_REAL_INPUT);
+    if (plan == NULL)
+        return NULL;
+
+    out = (rssringoccs_ComplexDouble *)malloc(sizeof(*out) * (N/2 + 1));
+    if (out != NULL)
+        rssringoccs_FFT_Plan_Execute_Real(plan, in, out);
+
+    rssringoccs_FFT_Plan_Destroy(plan);
+    return out;
+}
+/*  End of rssringoccs_Real_FFT.                                              */
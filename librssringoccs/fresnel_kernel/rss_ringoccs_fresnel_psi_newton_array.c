@@ -0,0 +1,159 @@
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_kernel.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_Double_Newton_Raphson_Fresnel_Psi_Array                   *
+ *  Purpose:                                                                  *
+ *      Same as Newton_Raphson_Fresnel_Psi, but for every point of a window   *
+ *      at once. Also returns psi at the stationary azimuth angle.            *
+ *  Arguments:                                                                *
+ *      k (double):                                                           *
+ *          The wavenumber at the center of the window.                       *
+ *      r (double):                                                           *
+ *          The ring radius at the center of the window.                      *
+ *      r0 (const double *):                                                  *
+ *          The ring radius at each point of the window.                      *
+ *      phi0 (const double *):                                                *
+ *          The ring azimuth angle at each point of the window.               *
+ *      B (double):                                                           *
+ *          The ring opening angle at the center of the window.               *
+ *      D (double):                                                           *
+ *          The spacecraft to ring-intercept distance at the center.          *
+ *      EPS (double):                                                         *
+ *          Iteration stops when |dpsi/dphi| <= EPS.                          *
+ *      toler (unsigned char):                                                *
+ *          Iteration stops after toler + 1 steps.                            *
+ *      phi (double *):                                                       *
+ *          On input, the starting guess at each point. On output, the        *
+ *          stationary azimuth angle.                                         *
+ *      psi (double *):                                                       *
+ *          The Fresnel kernel at the stationary azimuth angle.               *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the window.                               *
+ *  Method:                                                                   *
+ *      Everything that depends only on the center, cos(B), 1/D and kD, is    *
+ *      computed once, and cos(phi0) and sin(phi0) once per point. Each pass  *
+ *      computes cos(phi) and sin(phi) once and uses them for psi and its     *
+ *      first two derivatives, where the scalar routine calls Cos and Sin     *
+ *      for each of dpsi and d2psi, and again for psi.                        *
+ *                                                                            *
+ *      The points are done RSSRINGOCCS_NEWTON_LANES at a time. The sines     *
+ *      and cosines of a group are computed with one call to                  *
+ *      rssringoccs_Double_SinCos_Array. Every lane of a group is evaluated   *
+ *      on each pass, and a mask freezes the lanes that are done. Lanes of a  *
+ *      window converge in about the same number of steps, so little work is  *
+ *      wasted on frozen lanes.                                               *
+ *                                                                            *
+ *      Each lane stops as the scalar routine does. It takes no step if       *
+ *      |dpsi/dphi| <= EPS at the starting guess. Otherwise it is done after  *
+ *      the step taken with |dpsi/dphi| <= EPS, or after toler + 1 steps. One *
+ *      more pass then evaluates psi at the final phi.                        *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_Newton_Raphson_Fresnel_Psi_Array(double k, double r,
+                                                    const double *r0,
+                                                    const double *phi0,
+                                                    double B, double D,
+                                                    double EPS,
+                                                    unsigned char toler,
+                                                    double *phi, double *psi,
+                                                    unsigned long n_pts)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    unsigned long m, j, n_lanes, n_moved;
+    unsigned int iter;
+    double rcpr_D, rcpr_D_squared, kD, xi_factor, r_squared;
+    double cos_phi_phi0, sin_phi_phi0;
+    double xi, eta, psi0, dxi, dxi2, deta, deta2, dpsi, psi_d2, psi_val;
+    double rcpr_psi0, step;
+    unsigned char skip, moving, done;
+
+    /*  Per-point values that do not change between steps.                    */
+    double cos_phi0[RSSRINGOCCS_NEWTON_LANES];
+    double sin_phi0[RSSRINGOCCS_NEWTON_LANES];
+    double x0[RSSRINGOCCS_NEWTON_LANES];
+    double eta_factor[RSSRINGOCCS_NEWTON_LANES];
+    double eta_const[RSSRINGOCCS_NEWTON_LANES];
+    unsigned char active[RSSRINGOCCS_NEWTON_LANES];
+
+    /*  cos(phi) and sin(phi) at the current guess of each lane.              */
+    double cos_phi[RSSRINGOCCS_NEWTON_LANES];
+    double sin_phi[RSSRINGOCCS_NEWTON_LANES];
+
+    /*  Terms that depend only on the center of the window.                   */
+    rcpr_D = 1.0 / D;
+    rcpr_D_squared = rcpr_D * rcpr_D;
+    kD = k * D;
+    xi_factor = rssringoccs_Double_Cos(B) * rcpr_D;
+    r_squared = r * r;
+
+    for (m = 0; m < n_pts; m += n_lanes)
+    {
+        n_lanes = n_pts - m;
+        if (n_lanes > RSSRINGOCCS_NEWTON_LANES)
+            n_lanes = RSSRINGOCCS_NEWTON_LANES;
+
+        rssringoccs_Double_SinCos_Array(phi0 + m, sin_phi0, cos_phi0, n_lanes);
+
+        for (j = 0; j < n_lanes; ++j)
+        {
+            x0[j]         = r0[m+j] * cos_phi0[j];
+            eta_factor[j] = 2.0 * r * r0[m+j] * rcpr_D_squared;
+            eta_const[j]  = (r0[m+j]*r0[m+j] + r_squared) * rcpr_D_squared;
+            active[j]     = 1;
+        }
+
+        /*  At most toler + 1 Newton steps, and one more pass for psi.        */
+        for (iter = 0U; iter <= (unsigned int)toler + 1U; ++iter)
+        {
+            n_moved = 0;
+            rssringoccs_Double_SinCos_Array(phi + m, sin_phi, cos_phi, n_lanes);
+
+            for (j = 0; j < n_lanes; ++j)
+            {
+                cos_phi_phi0 = sin_phi[j]*sin_phi0[j] + cos_phi[j]*cos_phi0[j];
+                sin_phi_phi0 = sin_phi[j]*cos_phi0[j] - cos_phi[j]*sin_phi0[j];
+
+                /*  xi and eta (MTR86 Equations 4b and 4c), and derivatives.  */
+                xi   = xi_factor * (r * cos_phi[j] - x0[j]);
+                eta  = eta_const[j] - eta_factor[j]*cos_phi_phi0;
+                psi0 = rssringoccs_Double_Sqrt(1.0 + eta - 2.0*xi);
+                rcpr_psi0 = 1.0 / psi0;
+
+                dxi   = -xi_factor * (r * sin_phi[j]);
+                dxi2  = -xi_factor * (r * cos_phi[j]);
+                deta  = eta_factor[j] * sin_phi_phi0;
+                deta2 = eta_factor[j] * cos_phi_phi0;
+
+                /*  psi and its first two derivatives with respect to phi.    */
+                psi_val = kD * (psi0 + xi - 1.0);
+                dpsi    = kD * (0.5*rcpr_psi0*(deta - 2.0*dxi) + dxi);
+                psi_d2  = -0.25*rcpr_psi0*rcpr_psi0*rcpr_psi0 *
+                          (deta - 2.0*dxi) * (deta - 2.0*dxi);
+                psi_d2 += 0.5*rcpr_psi0*(deta2 - 2.0*dxi2) + dxi2;
+                psi_d2 *= kD;
+
+                /*  As in the scalar routine, a lane that starts with         *
+                 *  |dpsi/dphi| <= EPS takes no step. Otherwise it steps, and *
+                 *  is done after the step taken with |dpsi/dphi| <= EPS, or  *
+                 *  after toler + 1 steps.                                    */
+                skip   = (iter == 0U) & (rssringoccs_Double_Abs(dpsi) <= EPS);
+                moving = active[j] & !skip;
+                done   = skip | (rssringoccs_Double_Abs(dpsi) <= EPS) |
+                         (iter >= (unsigned int)toler);
+
+                /*  Frozen lanes keep their phi, so psi_val is unchanged.     */
+                step = moving ? dpsi / psi_d2 : 0.0;
+                psi[m+j] = psi_val;
+                phi[m+j] -= step;
+                active[j] = active[j] & !done;
+                n_moved += moving;
+            }
+
+            /*  psi is at the final phi once a pass takes no steps.           */
+            if (n_moved == 0)
+                break;
+        }
+    }
+}
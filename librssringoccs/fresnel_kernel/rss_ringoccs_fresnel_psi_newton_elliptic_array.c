@@ -0,0 +1,188 @@
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_kernel.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_Double_Newton_Raphson_Fresnel_Ellipse_Array               *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Double_Newton_Raphson_Fresnel_Ellipse, but for    *
+ *      every point of a window at once. Also returns psi at the stationary   *
+ *      azimuth angle, using the distance D from the spacecraft to the        *
+ *      stationary point.                                                     *
+ *  Arguments:                                                                *
+ *      k (double):                                                           *
+ *          The wavenumber at the center of the window.                       *
+ *      r (double):                                                           *
+ *          The ring radius at the center of the window.                      *
+ *      r0 (const double *):                                                  *
+ *          The ring radius at each point of the window.                      *
+ *      phi0 (const double *):                                                *
+ *          The ring azimuth angle at each point of the window.               *
+ *      B (double):                                                           *
+ *          The ring opening angle at the center of the window.               *
+ *      ecc (double):                                                         *
+ *          The eccentricity of the ring.                                     *
+ *      peri (double):                                                        *
+ *          The longitude of periapse of the ring.                            *
+ *      EPS (double):                                                         *
+ *          Iteration stops when |dpsi/dphi| <= EPS.                          *
+ *      toler (unsigned char):                                                *
+ *          Iteration stops after toler + 1 steps.                            *
+ *      rx, ry, rz (double):                                                  *
+ *          The position of the spacecraft at the center of the window.       *
+ *      phi (double *):                                                       *
+ *          On input, the starting guess at each point. On output, the        *
+ *          stationary azimuth angle.                                         *
+ *      psi (double *):                                                       *
+ *          The Fresnel kernel at the stationary azimuth angle.               *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the window.                               *
+ *  Method:                                                                   *
+ *      See rssringoccs_Double_Newton_Raphson_Fresnel_Psi_Array. The radius   *
+ *      rho of the ellipse through r at the starting guess is found from      *
+ *      cos(phi - peri), which is computed from cos(phi) and sin(phi), so     *
+ *      each pass needs only one sine and cosine. D is computed on each pass  *
+ *      and held fixed when computing the derivatives, as in the scalar       *
+ *      routine.                                                              *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_Newton_Raphson_Fresnel_Ellipse_Array(double k, double r,
+                                                        const double *r0,
+                                                        const double *phi0,
+                                                        double B, double ecc,
+                                                        double peri,
+                                                        double EPS,
+                                                        unsigned char toler,
+                                                        double rx, double ry,
+                                                        double rz,
+                                                        double *phi,
+                                                        double *psi,
+                                                        unsigned long n_pts)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    unsigned long m, j, n_lanes, n_moved;
+    unsigned int iter;
+    double cos_B, cos_peri, sin_peri, rz_squared, r_squared;
+    double D, kD, rcpr_D, rcpr_D_squared, xi_factor, eta_factor, dx, dy;
+    double cos_phi_phi0, sin_phi_phi0;
+    double cos_phi_peri, sin_phi_peri, ecc_cos_factor, rho, drho;
+    double xi, eta, psi0, dxi, dxi2, deta, deta2, dxi_rho, deta_rho;
+    double dpsi, psi_d2, psi_val, rcpr_psi0, step;
+    unsigned char skip, moving, done;
+
+    /*  Per-point values that do not change between steps.                    */
+    double cos_phi0[RSSRINGOCCS_NEWTON_LANES];
+    double sin_phi0[RSSRINGOCCS_NEWTON_LANES];
+    double x0[RSSRINGOCCS_NEWTON_LANES];
+    double rho_factor[RSSRINGOCCS_NEWTON_LANES];
+    unsigned char active[RSSRINGOCCS_NEWTON_LANES];
+
+    /*  cos(phi) and sin(phi) at the current guess of each lane.              */
+    double cos_phi[RSSRINGOCCS_NEWTON_LANES];
+    double sin_phi[RSSRINGOCCS_NEWTON_LANES];
+
+    /*  Terms that depend only on the center of the window.                   */
+    cos_B = rssringoccs_Double_Cos(B);
+    cos_peri = rssringoccs_Double_Cos(peri);
+    sin_peri = rssringoccs_Double_Sin(peri);
+    rz_squared = rz * rz;
+    r_squared = r * r;
+
+    for (m = 0; m < n_pts; m += n_lanes)
+    {
+        n_lanes = n_pts - m;
+        if (n_lanes > RSSRINGOCCS_NEWTON_LANES)
+            n_lanes = RSSRINGOCCS_NEWTON_LANES;
+
+        rssringoccs_Double_SinCos_Array(phi0 + m, sin_phi0, cos_phi0, n_lanes);
+
+        for (j = 0; j < n_lanes; ++j)
+        {
+            x0[j]       = r0[m+j] * cos_phi0[j];
+            active[j]   = 1;
+        }
+
+        /*  At most toler + 1 Newton steps, and one more pass for psi.        */
+        for (iter = 0U; iter <= (unsigned int)toler + 1U; ++iter)
+        {
+            n_moved = 0;
+            rssringoccs_Double_SinCos_Array(phi + m, sin_phi, cos_phi, n_lanes);
+
+            for (j = 0; j < n_lanes; ++j)
+            {
+                /*  Distance from the spacecraft to the point (r0, phi).      */
+                dx = r0[m+j] * cos_phi[j] - rx;
+                dy = r0[m+j] * sin_phi[j] - ry;
+                D  = rssringoccs_Double_Sqrt(dx*dx + dy*dy + rz_squared);
+                kD = k * D;
+                rcpr_D = 1.0 / D;
+                rcpr_D_squared = rcpr_D * rcpr_D;
+                xi_factor = cos_B * rcpr_D;
+
+                cos_phi_phi0 = sin_phi[j]*sin_phi0[j] + cos_phi[j]*cos_phi0[j];
+                sin_phi_phi0 = sin_phi[j]*cos_phi0[j] - cos_phi[j]*sin_phi0[j];
+                cos_phi_peri = cos_phi[j]*cos_peri + sin_phi[j]*sin_peri;
+                sin_phi_peri = sin_phi[j]*cos_peri - cos_phi[j]*sin_peri;
+
+                /*  The radius of the ellipse through r at the first guess.   */
+                ecc_cos_factor = 1.0 + ecc * cos_phi_peri;
+                if (iter == 0U)
+                    rho_factor[j] = r * ecc_cos_factor;
+
+                rho  = rho_factor[j] / ecc_cos_factor;
+                drho = rho * ecc * sin_phi_peri / ecc_cos_factor;
+
+                /*  psi at the ring radius r.                                 */
+                xi   = xi_factor * (r * cos_phi[j] - x0[j]);
+                eta  = (r0[m+j]*r0[m+j] + r_squared) * rcpr_D_squared -
+                       2.0 * r * r0[m+j] * rcpr_D_squared * cos_phi_phi0;
+                psi0 = rssringoccs_Double_Sqrt(1.0 + eta - 2.0*xi);
+                psi_val = kD * (psi0 + xi - 1.0);
+
+                /*  The derivatives are taken at the ellipse radius rho.      */
+                eta_factor = 2.0 * rho * r0[m+j] * rcpr_D_squared;
+                xi   = xi_factor * (rho * cos_phi[j] - x0[j]);
+                eta  = (r0[m+j]*r0[m+j] + rho*rho) * rcpr_D_squared -
+                       eta_factor * cos_phi_phi0;
+                psi0 = rssringoccs_Double_Sqrt(1.0 + eta - 2.0*xi);
+                rcpr_psi0 = 1.0 / psi0;
+
+                dxi      = -xi_factor * (rho * sin_phi[j]);
+                dxi2     = -xi_factor * (rho * cos_phi[j]);
+                deta     = eta_factor * sin_phi_phi0;
+                deta2    = eta_factor * cos_phi_phi0;
+                dxi_rho  = xi_factor * cos_phi[j];
+                deta_rho = 2.0*(rho - r0[m+j]*cos_phi_phi0)*rcpr_D_squared;
+
+                dpsi  = 0.5*rcpr_psi0*(deta - 2.0*dxi) + dxi;
+                dpsi += (0.5*rcpr_psi0*(deta_rho - 2.0*dxi_rho) + dxi_rho)*drho;
+                dpsi *= kD;
+
+                psi_d2  = -0.25*rcpr_psi0*rcpr_psi0*rcpr_psi0 *
+                          (deta - 2.0*dxi) * (deta - 2.0*dxi);
+                psi_d2 += 0.5*rcpr_psi0*(deta2 - 2.0*dxi2) + dxi2;
+                psi_d2 *= kD;
+
+                /*  As in the scalar routine, a lane that starts with         *
+                 *  |dpsi/dphi| <= EPS takes no step. Otherwise it steps, and *
+                 *  is done after the step taken with |dpsi/dphi| <= EPS, or  *
+                 *  after toler + 1 steps.                                    */
+                skip   = (iter == 0U) & (rssringoccs_Double_Abs(dpsi) <= EPS);
+                moving = active[j] & !skip;
+                done   = skip | (rssringoccs_Double_Abs(dpsi) <= EPS) |
+                         (iter >= (unsigned int)toler);
+
+                /*  Frozen lanes keep their phi, so psi_val is unchanged.     */
+                step = moving ? dpsi / psi_d2 : 0.0;
+                psi[m+j] = psi_val;
+                phi[m+j] -= step;
+                active[j] = active[j] & !done;
+                n_moved += moving;
+            }
+
+            /*  psi is at the final phi once a pass takes no steps.           */
+            if (n_moved == 0)
+                break;
+        }
+    }
+}
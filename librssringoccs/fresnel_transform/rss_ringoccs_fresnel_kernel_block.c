@@ -0,0 +1,197 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                     rss_ringoccs_fresnel_kernel_block                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the weighted Fresnel kernel w exp(-i psi) for a block of     *
+ *      points of the window.                                                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Fresnel_Kernel_Block:                                     *
+ *  Purpose:                                                                  *
+ *      Computes ker[n] = w_func[n] exp(-i psi[n]) for 0 <= n < n_pts.        *
+ *  Arguments:                                                                *
+ *      psi (const double *):                                                 *
+ *          The Fresnel kernel at each point of the block.                    *
+ *      w_func (const double *):                                              *
+ *          The window function at each point of the block.                   *
+ *      ker_re (double *):                                                    *
+ *          The real part of the output, w_func[n] cos(psi[n]).               *
+ *      ker_im (double *):                                                    *
+ *          The imaginary part of the output, -w_func[n] sin(psi[n]).         *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the block.                                *
+ *      norm (rssringoccs_ComplexDouble *):                                   *
+ *          If not NULL, the sum of the ker[n] is added to this.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      This is the inner loop of every Fresnel transform, so it is written   *
+ *      without function calls or branches so that the compiler can turn it   *
+ *      into SIMD instructions. The argument is reduced to [-pi/4, pi/4]      *
+ *      with a three part Cody-Waite reduction by pi/2:                       *
+ *                                                                            *
+ *          r = ((x - n P1) - n P2) - n P3,     n = round(2x / pi)            *
+ *                                                                            *
+ *      P1 and P2 have 33 significant bits, so n P1 and n P2 are exact for    *
+ *      |n| < 2^20. sin(r) and cos(r) are computed with the minimax           *
+ *      polynomials from fdlibm, and the quadrant n mod 4 selects which of    *
+ *      +/- sin(r) and +/- cos(r) is the sine and cosine of x. Arguments      *
+ *      outside of the range of the reduction, and NaN, are recomputed with   *
+ *      rssringoccs_Double_SinCos in a second pass, which reduces each of     *
+ *      these large arguments only once for both the sine and cosine.         *
+ *                                                                            *
+ *      2x / pi is rounded by adding and subtracting 1.5 * 2^52, which needs  *
+ *      no function calls or conversions to int.                              *
+ *                                                                            *
+ *      With GCC on x86_64 GNU/Linux the function is built for AVX-512, AVX2, *
+ *      and the baseline instruction set, and the best version is picked      *
+ *      when the library is loaded. See rss_ringoccs_config.h.                *
+ *  NOTES:                                                                    *
+ *      1.) The result agrees with libm to within a few ULP, it is not bit    *
+ *          for bit identical.                                                *
+ *      2.) The rounding trick needs double arithmetic to be done in double   *
+ *          precision with round to nearest. This is the case with SSE2 and   *
+ *          on every 64-bit platform, but not with the x87 FPU.               *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  3.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing sine and cosine.                           *
+ *  4.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex addition.                          *
+ *  5.) rss_ringoccs_fresnel_transform.h:                                     *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
+
+/*  Constants for the Cody-Waite reduction, pi/2 = P1 + P2 + P3.              */
+#define TWO_BY_PI  6.36619772367581382433e-01
+#define PIO2_1     1.57079632673412561417e+00
+#define PIO2_2     6.07710050630396597660e-11
+#define PIO2_3     2.02226624879595063154e-21
+
+/*  The reduction is exact for |x| < 2^20 pi/2. Larger values use libm.       */
+#define REDUCTION_LIMIT 1.6470993291652855e+06
+
+/*  1.5 * 2^52. Adding and subtracting this rounds to the nearest integer.    */
+#define ROUND_MAGIC 6755399441055744.0
+
+/*  Coefficients for sin(r) = r + r^3 (S1 + r^2 S2 + ...) on [-pi/4, pi/4].   */
+#define S1 -1.66666666666666324348e-01
+#define S2  8.33333333332248946124e-03
+#define S3 -1.98412698298579493134e-04
+#define S4  2.75573137070700676789e-06
+#define S5 -2.50507602534068634195e-08
+#define S6  1.58969099521155010221e-10
+
+/*  Coefficients for cos(r) = 1 - r^2/2 + r^4 (C1 + r^2 C2 + ...).            */
+#define C1  4.16666666666666019037e-02
+#define C2 -1.38888888888741095749e-03
+#define C3  2.48015872894767294178e-05
+#define C4 -2.75573143513906633035e-07
+#define C5  2.08757232129817482790e-09
+#define C6 -1.13596475577881948265e-11
+
+/*  Function for computing w exp(-i psi) across a block of the window.        */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Fresnel_Kernel_Block(const double *psi, const double *w_func,
+                                 double *ker_re, double *ker_im,
+                                 unsigned long n_pts,
+                                 rssringoccs_ComplexDouble *norm)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long n;
+    double x, y, q, r, z, abs_q, sin_r, cos_r, sin_x, cos_x, norm_re, norm_im;
+    double sin_psi, cos_psi;
+
+    for (n = 0; n < n_pts; ++n)
+    {
+        /*  Round 2x/pi to the nearest integer y, and compute q = y mod 4 in   *
+         *  the range [-2, 2]. These are exact for the values the reduction    *
+         *  is used on. For larger values, infinity, and NaN, the result is    *
+         *  meaningless, but it is replaced in the loop below.                */
+        x = psi[n];
+        y = (x*TWO_BY_PI + ROUND_MAGIC) - ROUND_MAGIC;
+        q = y - 4.0*((0.25*y + ROUND_MAGIC) - ROUND_MAGIC);
+
+        /*  Reduce x to [-pi/4, pi/4].                                        */
+        r = ((x - y*PIO2_1) - y*PIO2_2) - y*PIO2_3;
+        z = r*r;
+
+        /*  Compute sin(r) and cos(r) using Horner's method.                  */
+        sin_r = r + r*z*(S1 + z*(S2 + z*(S3 + z*(S4 + z*(S5 + z*S6)))));
+        cos_r = 1.0 - 0.5*z +
+                z*z*(C1 + z*(C2 + z*(C3 + z*(C4 + z*(C5 + z*C6)))));
+
+        /*  In odd quadrants sine and cosine swap roles. Sine is negative in   *
+         *  quadrants 2 and 3 (q = 2, -2, -1), and cosine in quadrants 1 and   *
+         *  2 (q = 1, 2, -2). Everything is done in double precision, with     *
+         *  no conversions to int, so that the loop can be vectorized.        */
+        abs_q = fabs(q);
+        sin_x = (abs_q == 1.0) ? cos_r : sin_r;
+        cos_x = (abs_q == 1.0) ? sin_r : cos_r;
+        sin_x = ((q < -0.5) || (q > 1.5)) ? -sin_x : sin_x;
+        cos_x = ((q > 0.5) || (q < -1.5)) ? -cos_x : cos_x;
+
+        ker_re[n] =  w_func[n]*cos_x;
+        ker_im[n] = -w_func[n]*sin_x;
+    }
+
+    /*  Very large arguments, and NaN, fall back to the scalar routines.      */
+    for (n = 0; n < n_pts; ++n)
+    {
+        if (!(fabs(psi[n]) < REDUCTION_LIMIT))
+        {
+            rssringoccs_Double_SinCos(psi[n], &sin_psi, &cos_psi);
+            ker_re[n] =  w_func[n]*cos_psi;
+            ker_im[n] = -w_func[n]*sin_psi;
+        }
+    }
+
+    /*  Add the kernel to the normalization, if requested.                    */
+    if (norm != NULL)
+    {
+        norm_re = 0.0;
+        norm_im = 0.0;
+
+        for (n = 0; n < n_pts; ++n)
+        {
+            norm_re += ker_re[n];
+            norm_im += ker_im[n];
+        }
+
+        *norm = rssringoccs_CDouble_Add(*norm,
+                                        rssringoccs_CDouble_Rect(norm_re,
+                                                                 norm_im));
+    }
+}
+/*  End of rssringoccs_Fresnel_Kernel_Block.                                  */
@@ -0,0 +1,173 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                  rss_ringoccs_fresnel_kernel_block_float                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the weighted Fresnel kernel w exp(-i psi) for a block of     *
+ *      points of the window, in single precision.                            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Fresnel_Kernel_Block_Float:                               *
+ *  Purpose:                                                                  *
+ *      Computes ker[n] = w_func[n] exp(-i psi[n]) for 0 <= n < n_pts.        *
+ *  Arguments:                                                                *
+ *      psi (const double *):                                                 *
+ *          The Fresnel kernel at each point of the block.                    *
+ *      w_func (const double *):                                              *
+ *          The window function at each point of the block.                   *
+ *      ker_re (float *):                                                     *
+ *          The real part of the output, w_func[n] cos(psi[n]).               *
+ *      ker_im (float *):                                                     *
+ *          The imaginary part of the output, -w_func[n] sin(psi[n]).         *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the block.                                *
+ *      norm (rssringoccs_ComplexDouble *):                                   *
+ *          If not NULL, the sum of the ker[n] is added to this.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Same as rssringoccs_Fresnel_Kernel_Block, but sin(r) and cos(r) are   *
+ *      computed in single precision with the shorter minimax polynomials     *
+ *      from fdlibm's k_sinf and k_cosf. psi is often thousands of radians,   *
+ *      so the reduction to [-pi/4, pi/4] is still done in double precision, *
+ *      where it is exact. Only the reduced argument is rounded to float.     *
+ *                                                                            *
+ *      Half as many bytes are written, and twice as many points fit in a     *
+ *      SIMD register, as for the double precision kernel.                    *
+ *  NOTES:                                                                    *
+ *      1.) The relative error is a few times the float epsilon, about 1e-7.  *
+ *      2.) The normalization is summed in double precision.                  *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  3.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing sine and cosine.                           *
+ *  4.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex addition.                          *
+ *  5.) rss_ringoccs_fresnel_transform.h:                                     *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
+
+/*  Constants for the Cody-Waite reduction, pi/2 = P1 + P2 + P3.              */
+#define TWO_BY_PI  6.36619772367581382433e-01
+#define PIO2_1     1.57079632673412561417e+00
+#define PIO2_2     6.07710050630396597660e-11
+#define PIO2_3     2.02226624879595063154e-21
+
+/*  The reduction is exact for |x| < 2^20 pi/2. Larger values use libm.       */
+#define REDUCTION_LIMIT 1.6470993291652855e+06
+
+/*  1.5 * 2^52. Adding and subtracting this rounds to the nearest integer.    */
+#define ROUND_MAGIC 6755399441055744.0
+
+/*  Coefficients for sin(r) = r + r^3 (S1 + r^2 S2 + ...) on [-pi/4, pi/4].   */
+#define S1 -0.166666666416265235595F
+#define S2  0.0083333293858894631756F
+#define S3 -0.000198393348360966317347F
+#define S4  0.0000027183114939898219064F
+
+/*  Coefficients for cos(r) = 1 + r^2 (C0 + r^2 C1 + ...).                    */
+#define C0 -0.499999997251031003120F
+#define C1  0.0416666233237390631894F
+#define C2 -0.00138867637746099294692F
+#define C3  0.0000243904487962774090654F
+
+/*  Function for computing w exp(-i psi) across a block, in single precision. */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Fresnel_Kernel_Block_Float(const double *psi, const double *w_func,
+                                       float *ker_re, float *ker_im,
+                                       unsigned long n_pts,
+                                       rssringoccs_ComplexDouble *norm)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long n;
+    double x, y, q;
+    float r, z, w, abs_q, sin_r, cos_r, sin_x, cos_x;
+    double norm_re, norm_im, sin_psi, cos_psi;
+
+    for (n = 0; n < n_pts; ++n)
+    {
+        /*  Round 2x/pi to the nearest integer y, and compute q = y mod 4 in  *
+         *  the range [-2, 2]. See rssringoccs_Fresnel_Kernel_Block.          */
+        x = psi[n];
+        y = (x*TWO_BY_PI + ROUND_MAGIC) - ROUND_MAGIC;
+        q = y - 4.0*((0.25*y + ROUND_MAGIC) - ROUND_MAGIC);
+
+        /*  Reduce x to [-pi/4, pi/4] in double, then round to float.         */
+        r = (float)(((x - y*PIO2_1) - y*PIO2_2) - y*PIO2_3);
+        z = r*r;
+
+        /*  Compute sin(r) and cos(r) using Horner's method.                  */
+        sin_r = r + r*z*(S1 + z*(S2 + z*(S3 + z*S4)));
+        cos_r = 1.0F + z*(C0 + z*(C1 + z*(C2 + z*C3)));
+
+        /*  Select the sign and the role of sine and cosine by the quadrant.  */
+        abs_q = (float)fabs(q);
+        sin_x = (abs_q == 1.0F) ? cos_r : sin_r;
+        cos_x = (abs_q == 1.0F) ? sin_r : cos_r;
+        sin_x = ((q < -0.5) || (q > 1.5)) ? -sin_x : sin_x;
+        cos_x = ((q > 0.5) || (q < -1.5)) ? -cos_x : cos_x;
+
+        w = (float)w_func[n];
+        ker_re[n] =  w*cos_x;
+        ker_im[n] = -w*sin_x;
+    }
+
+    /*  Very large arguments, and NaN, fall back to the scalar routines.      */
+    for (n = 0; n < n_pts; ++n)
+    {
+        if (!(fabs(psi[n]) < REDUCTION_LIMIT))
+        {
+            rssringoccs_Double_SinCos(psi[n], &sin_psi, &cos_psi);
+            ker_re[n] = (float)( w_func[n]*cos_psi);
+            ker_im[n] = (float)(-w_func[n]*sin_psi);
+        }
+    }
+
+    /*  Add the kernel to the normalization, if requested.                    */
+    if (norm != NULL)
+    {
+        norm_re = 0.0;
+        norm_im = 0.0;
+
+        for (n = 0; n < n_pts; ++n)
+        {
+            norm_re += (double)ker_re[n];
+            norm_im += (double)ker_im[n];
+        }
+
+        *norm = rssringoccs_CDouble_Add(*norm,
+                                        rssringoccs_CDouble_Rect(norm_re,
+                                                                 norm_im));
+    }
+}
+/*  End of rssringoccs_Fresnel_Kernel_Block_Float.                            */
@@ -0,0 +1,185 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                 rss_ringoccs_fresnel_quadratic_kernel_block                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the weighted quadratic Fresnel kernel w exp(-i a j^2) for a  *
+ *      block of points of the window, with few calls to sine and cosine.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Fresnel_Quadratic_Kernel_Block:                           *
+ *  Purpose:                                                                  *
+ *      Computes ker[n] = w_func[n] exp(-i a (j0 - n)^2) for 0 <= n < n_pts.  *
+ *  Arguments:                                                                *
+ *      a (double):                                                           *
+ *          The phase of the point one sample from the center, pi/2 (dx/F)^2. *
+ *      j0 (unsigned long):                                                   *
+ *          The distance, in samples, of the first point from the center.     *
+ *      w_func (const double *):                                              *
+ *          The window function at each point of the block.                   *
+ *      ker_re (double *):                                                    *
+ *          The real part of the output.                                      *
+ *      ker_im (double *):                                                    *
+ *          The imaginary part of the output.                                 *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the block.                                *
+ *      norm (rssringoccs_ComplexDouble *):                                   *
+ *          If not NULL, the sum of the ker[n] is added to this.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      With theta_j = a j^2, the phase changes by a fixed amount between     *
+ *      points L samples apart, plus a term that is the same for all points:  *
+ *                                                                            *
+ *          theta_(j-L) - theta_j = a L (L - 2j)                              *
+ *                                                                            *
+ *      and this difference changes by 2 a L^2 from one step to the next. So  *
+ *      exp(-i theta) at every L-th point follows from two complex products:  *
+ *                                                                            *
+ *          z_(n+L) = z_n r_n,      r_(n+L) = r_n d,      d = exp(-2i a L^2)  *
+ *                                                                            *
+ *      The block is split into L interleaved chains, which are independent   *
+ *      and may be vectorized. z, r, and d are computed exactly for the first *
+ *      L points of each block with rssringoccs_Fresnel_Kernel_Block, which   *
+ *      is 2L+1 sines and cosines instead of one for every point.             *
+ *  NOTES:                                                                    *
+ *      1.) The products add a rounding error of a few ULP at every step.     *
+ *          The chains are started again from exact values for every block,   *
+ *          so the error does not grow with the size of the window.           *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  3.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex addition.                          *
+ *  4.) rss_ringoccs_fresnel_transform.h:                                     *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
+
+/*  The number of interleaved chains of the recurrence.                       */
+#define RSSRINGOCCS_QUADRATIC_CHAINS 8
+
+/*  Function for computing w exp(-i a j^2) across a block of the window.      */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Fresnel_Quadratic_Kernel_Block(double a, unsigned long j0,
+                                           const double *w_func,
+                                           double *ker_re, double *ker_im,
+                                           unsigned long n_pts,
+                                           rssringoccs_ComplexDouble *norm)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long n, l, n_chains;
+    double j, L, tmp, norm_re, norm_im;
+
+    /*  The phases of the first points, the step of each chain, and the       *
+     *  change in the step, and ones to use as the window.                    */
+    double phase[2*RSSRINGOCCS_QUADRATIC_CHAINS + 1];
+    double ones[2*RSSRINGOCCS_QUADRATIC_CHAINS + 1];
+    double e_re[2*RSSRINGOCCS_QUADRATIC_CHAINS + 1];
+    double e_im[2*RSSRINGOCCS_QUADRATIC_CHAINS + 1];
+
+    /*  The current value z and step r of each chain, and the step change d.  */
+    double z_re[RSSRINGOCCS_QUADRATIC_CHAINS];
+    double z_im[RSSRINGOCCS_QUADRATIC_CHAINS];
+    double r_re[RSSRINGOCCS_QUADRATIC_CHAINS];
+    double r_im[RSSRINGOCCS_QUADRATIC_CHAINS];
+    double d_re, d_im;
+
+    L = (double)RSSRINGOCCS_QUADRATIC_CHAINS;
+
+    for (l = 0; l < RSSRINGOCCS_QUADRATIC_CHAINS; ++l)
+    {
+        j = (double)j0 - (double)l;
+        phase[l] = a*j*j;
+        phase[RSSRINGOCCS_QUADRATIC_CHAINS + l] = a*L*(L - 2.0*j);
+    }
+    phase[2*RSSRINGOCCS_QUADRATIC_CHAINS] = 2.0*a*L*L;
+
+    for (l = 0; l < 2*RSSRINGOCCS_QUADRATIC_CHAINS + 1; ++l)
+        ones[l] = 1.0;
+
+    /*  Compute the starting values exactly.                                  */
+    rssringoccs_Fresnel_Kernel_Block(phase, ones, e_re, e_im,
+                                     2*RSSRINGOCCS_QUADRATIC_CHAINS + 1, NULL);
+
+    for (l = 0; l < RSSRINGOCCS_QUADRATIC_CHAINS; ++l)
+    {
+        z_re[l] = e_re[l];
+        z_im[l] = e_im[l];
+        r_re[l] = e_re[RSSRINGOCCS_QUADRATIC_CHAINS + l];
+        r_im[l] = e_im[RSSRINGOCCS_QUADRATIC_CHAINS + l];
+    }
+
+    d_re = e_re[2*RSSRINGOCCS_QUADRATIC_CHAINS];
+    d_im = e_im[2*RSSRINGOCCS_QUADRATIC_CHAINS];
+
+    /*  Step every chain forward L points at a time.                          */
+    for (n = 0; n < n_pts; n += RSSRINGOCCS_QUADRATIC_CHAINS)
+    {
+        n_chains = n_pts - n;
+        if (n_chains > RSSRINGOCCS_QUADRATIC_CHAINS)
+            n_chains = RSSRINGOCCS_QUADRATIC_CHAINS;
+
+        for (l = 0; l < n_chains; ++l)
+        {
+            ker_re[n+l] = w_func[n+l]*z_re[l];
+            ker_im[n+l] = w_func[n+l]*z_im[l];
+        }
+
+        for (l = 0; l < RSSRINGOCCS_QUADRATIC_CHAINS; ++l)
+        {
+            tmp     = z_re[l]*r_re[l] - z_im[l]*r_im[l];
+            z_im[l] = z_re[l]*r_im[l] + z_im[l]*r_re[l];
+            z_re[l] = tmp;
+
+            tmp     = r_re[l]*d_re - r_im[l]*d_im;
+            r_im[l] = r_re[l]*d_im + r_im[l]*d_re;
+            r_re[l] = tmp;
+        }
+    }
+
+    /*  Add the kernel to the normalization, if requested.                    */
+    if (norm != NULL)
+    {
+        norm_re = 0.0;
+        norm_im = 0.0;
+
+        for (n = 0; n < n_pts; ++n)
+        {
+            norm_re += ker_re[n];
+            norm_im += ker_im[n];
+        }
+
+        *norm = rssringoccs_CDouble_Add(*norm,
+                                        rssringoccs_CDouble_Rect(norm_re,
+                                                                 norm_im));
+    }
+}
+/*  End of rssringoccs_Fresnel_Quadratic_Kernel_Block.                        */
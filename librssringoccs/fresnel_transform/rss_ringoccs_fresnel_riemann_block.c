@@ -0,0 +1,159 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                     rss_ringoccs_fresnel_riemann_block                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds a block of the Riemann sum of the Fresnel transform to T_out.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Fresnel_Riemann_Block:                                    *
+ *  Purpose:                                                                  *
+ *      Computes the sum of ker[n] T_in[first + n*T_step] for 0 <= n < n_pts  *
+ *      and adds it to T_out[center].                                         *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *      ker_re (const double *):                                              *
+ *          The real part of the kernel, w exp(-i psi).                       *
+ *      ker_im (const double *):                                              *
+ *          The imaginary part of the kernel.                                 *
+ *      first (unsigned long):                                                *
+ *          The index of T_in paired with ker[0].                             *
+ *      T_step (long):                                                        *
+ *          The step between points of T_in. This is 1 when walking the       *
+ *          window left to right, and -1 when walking it right to left.       *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the block.                                *
+ *      center (unsigned long):                                               *
+ *          The index of T_out the sum is added to.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      If rssringoccs_Tau_Build_View has split T_in into T_in_re and         *
+ *      T_in_im, those arrays are read, and every load is contiguous.         *
+ *      Otherwise T_in is read directly. rssringoccs_ComplexDouble is two     *
+ *      contiguous doubles in either implementation of the complex type, so   *
+ *      T_in is read as an array of doubles with twice the step. In both      *
+ *      cases the complex product is written out in real arithmetic.          *
+ *                                                                            *
+ *      If tau->use_fwd is set, the sum is of conj(ker[n]) T_in. This is the  *
+ *      forward model, since the forward transform has psi replaced by -psi.  *
+ *      The same kernel serves both transforms, with ker_im negated.          *
+ *                                                                            *
+ *      The sum is split across four partial sums. This lets the compiler     *
+ *      vectorize the loop without having to reorder the floating point       *
+ *      additions itself, which it is not allowed to do.                      *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  3.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex addition.                          *
+ *  4.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file containing the rssringoccs_TAUObj typedef.            *
+ *  5.) rss_ringoccs_fresnel_transform.h:                                     *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
+
+/*  Number of partial sums used for the Riemann sum.                          */
+#define N_LANES 4
+
+/*  Function for adding a block of the Riemann sum to T_out.                  */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Fresnel_Riemann_Block(rssringoccs_TAUObj *tau,
+                                  const double *ker_re, const double *ker_im,
+                                  unsigned long first, long T_step,
+                                  unsigned long n_pts, unsigned long center)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long n, k;
+    long step;
+    double sum_re[N_LANES], sum_im[N_LANES];
+    double re, im, t_re, t_im, k_im, im_sign;
+    const double *T_re, *T_im;
+
+    /*  Use the split arrays if they exist. Otherwise T_in is read as pairs   *
+     *  of doubles, so double the step.                                       */
+    if ((tau->T_in_re != NULL) && (tau->T_in_im != NULL))
+    {
+        T_re = tau->T_in_re + first;
+        T_im = tau->T_in_im + first;
+        step = T_step;
+    }
+    else
+    {
+        T_re = (const double *)(tau->T_in + first);
+        T_im = T_re + 1;
+        step = 2*T_step;
+    }
+
+    /*  The forward model uses the complex conjugate of the kernel.           */
+    if (tau->use_fwd)
+        im_sign = -1.0;
+    else
+        im_sign = 1.0;
+
+    for (k = 0; k < N_LANES; ++k)
+    {
+        sum_re[k] = 0.0;
+        sum_im[k] = 0.0;
+    }
+
+    /*  Main loop, N_LANES points at a time.                                  */
+    for (n = 0; n + N_LANES <= n_pts; n += N_LANES)
+    {
+        for (k = 0; k < N_LANES; ++k)
+        {
+            t_re = T_re[(long)(n+k)*step];
+            t_im = T_im[(long)(n+k)*step];
+            k_im = im_sign*ker_im[n+k];
+            sum_re[k] += ker_re[n+k]*t_re - k_im*t_im;
+            sum_im[k] += ker_re[n+k]*t_im + k_im*t_re;
+        }
+    }
+
+    /*  Add the points left over into the first partial sum.                  */
+    for (; n < n_pts; ++n)
+    {
+        t_re = T_re[(long)n*step];
+        t_im = T_im[(long)n*step];
+        k_im = im_sign*ker_im[n];
+        sum_re[0] += ker_re[n]*t_re - k_im*t_im;
+        sum_im[0] += ker_re[n]*t_im + k_im*t_re;
+    }
+
+    re = (sum_re[0] + sum_re[1]) + (sum_re[2] + sum_re[3]);
+    im = (sum_im[0] + sum_im[1]) + (sum_im[2] + sum_im[3]);
+    tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
+                                                 rssringoccs_CDouble_Rect(re,
+                                                                          im));
+}
+/*  End of rssringoccs_Fresnel_Riemann_Block.                                 */
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                  rss_ringoccs_fresnel_riemann_block_float                  *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds a block of the Riemann sum of the Fresnel transform to T_out,    *
+ *      computed in single precision.                                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Fresnel_Riemann_Block_Float:                              *
+ *  Purpose:                                                                  *
+ *      Computes the sum of ker[n] T_in[first + n*T_step] for 0 <= n < n_pts  *
+ *      and adds it to T_out[center].                                         *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *      ker_re (const float *):                                               *
+ *          The real part of the kernel, w exp(-i psi).                       *
+ *      ker_im (const float *):                                               *
+ *          The imaginary part of the kernel.                                 *
+ *      first (unsigned long):                                                *
+ *          The index of T_in paired with ker[0].                             *
+ *      T_step (long):                                                        *
+ *          The step between points of T_in, 1 or -1.                         *
+ *      n_pts (unsigned long):                                                *
+ *          The number of points in the block.                                *
+ *      center (unsigned long):                                               *
+ *          The index of T_out the sum is added to.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Same as rssringoccs_Fresnel_Riemann_Block, but the products are       *
+ *      summed in single precision, reading T_in from T_in_re_f and           *
+ *      T_in_im_f, which rssringoccs_Tau_Build_View fills if tau->use_float   *
+ *      is set. Eight partial sums are used, since twice as many floats fit   *
+ *      in a SIMD register as doubles. A block is at most                     *
+ *      RSSRINGOCCS_FRESNEL_BLOCK_SIZE points, so each partial sum has only a *
+ *      few terms, and the block sums are added to T_out in double            *
+ *      precision. If tau->use_fwd is set, the conjugate kernel is used.      *
+ *  NOTES:                                                                    *
+ *      1.) If the float arrays have not been built, T_in is read directly    *
+ *          and rounded to float.                                             *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for the NULL macro.               *
+ *  2.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  3.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing complex addition.                          *
+ *  4.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file containing the rssringoccs_TAUObj typedef.            *
+ *  5.) rss_ringoccs_fresnel_transform.h:                                     *
+ *          Header file where this function is declared.                      *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
+
+/*  Number of partial sums used for the Riemann sum.                          */
+#define N_LANES 8
+
+/*  Function for adding a block of the Riemann sum to T_out, in float.        */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Fresnel_Riemann_Block_Float(rssringoccs_TAUObj *tau,
+                                        const float *ker_re,
+                                        const float *ker_im,
+                                        unsigned long first, long T_step,
+                                        unsigned long n_pts,
+                                        unsigned long center)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long n, k;
+    float sum_re[N_LANES], sum_im[N_LANES];
+    float t_re, t_im, k_im, im_sign;
+    double re, im;
+    const float *T_re, *T_im;
+    const double *T_in;
+
+    /*  The forward model uses the complex conjugate of the kernel.           */
+    if (tau->use_fwd)
+        im_sign = -1.0F;
+    else
+        im_sign = 1.0F;
+
+    for (k = 0; k < N_LANES; ++k)
+    {
+        sum_re[k] = 0.0F;
+        sum_im[k] = 0.0F;
+    }
+
+    if ((tau->T_in_re_f != NULL) && (tau->T_in_im_f != NULL))
+    {
+        T_re = tau->T_in_re_f + first;
+        T_im = tau->T_in_im_f + first;
+
+        /*  Main loop, N_LANES points at a time.                              */
+        for (n = 0; n + N_LANES <= n_pts; n += N_LANES)
+        {
+            for (k = 0; k < N_LANES; ++k)
+            {
+                t_re = T_re[(long)(n+k)*T_step];
+                t_im = T_im[(long)(n+k)*T_step];
+                k_im = im_sign*ker_im[n+k];
+                sum_re[k] += ker_re[n+k]*t_re - k_im*t_im;
+                sum_im[k] += ker_re[n+k]*t_im + k_im*t_re;
+            }
+        }
+
+        /*  Add the points left over into the first partial sum.              */
+        for (; n < n_pts; ++n)
+        {
+            t_re = T_re[(long)n*T_step];
+            t_im = T_im[(long)n*T_step];
+            k_im = im_sign*ker_im[n];
+            sum_re[0] += ker_re[n]*t_re - k_im*t_im;
+            sum_im[0] += ker_re[n]*t_im + k_im*t_re;
+        }
+    }
+
+    /*  No float arrays. Read T_in as pairs of doubles and round to float.    */
+    else
+    {
+        T_in = (const double *)(tau->T_in + first);
+
+        for (n = 0; n < n_pts; ++n)
+        {
+            t_re = (float)T_in[2L*(long)n*T_step];
+            t_im = (float)T_in[2L*(long)n*T_step + 1L];
+            k_im = im_sign*ker_im[n];
+            sum_re[n % N_LANES] += ker_re[n]*t_re - k_im*t_im;
+            sum_im[n % N_LANES] += ker_re[n]*t_im + k_im*t_re;
+        }
+    }
+
+    re = 0.0;
+    im = 0.0;
+    for (k = 0; k < N_LANES; ++k)
+    {
+        re += (double)sum_re[k];
+        im += (double)sum_im[k];
+    }
+
+    tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
+                                                 rssringoccs_CDouble_Rect(re,
+                                                                          im));
+}
+/*  End of rssringoccs_Fresnel_Riemann_Block_Float.                           */
@@ -17,6 +17,7 @@
  *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
  ******************************************************************************/
 
+#include <stdlib.h>
 #include <rss_ringoccs/include/rss_ringoccs_math.h>
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 #include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
@@ -59,18 +60,27 @@
  *          The diffraction corrected profile.                                *
  ******************************************************************************/
 RSS_RINGOCCS_EXPORT void
-Fresnel_Transform_Double(rssringoccs_TAUObj *tau, double *x_arr, double *w_func,
-                         unsigned long n_pts, unsigned long center)
+Fresnel_Transform_Double(rssringoccs_TAUObj *tau, double *x_arr,
+                         const double *w_func, unsigned long n_pts,
+                         unsigned long center)
 {
     /*  Declare all necessary variables. i and j are used for indexing.       */
-    unsigned long m, n;
+    unsigned long m, n, l, n_blk;
 
     /*  rcpr_F and rcpr_F2 are the reciprocal of the Fresnel scale, and the   *
-     *  square of this. x is used as the argument of the Fresnel kernel.      */
-    double x, rcpr_F, rcpr_F2, cos_x, sin_x, factor;
+     *  square of this. a is the argument of the Fresnel kernel one sample    *
+     *  from the center, which is pi/2 (dx/F)^2.                              */
+    double rcpr_F, rcpr_F2, a, factor;
 
-    /*  exp_negative_ix is used for the Fresnel kernel.                       */
-    rssringoccs_ComplexDouble exp_negative_ix, integrand, arg;
+    /*  The Fresnel kernel scaled by the window for a block of points.        */
+    double ker_re[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_im[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    rssringoccs_ComplexDouble arg;
+
+    /*  psi, and the kernel in single precision, if tau->use_float is set.    */
+    double psi_blk[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    float ker_re_f[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    float ker_im_f[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
 
     /*  Start with the central point in the Riemann sum. This is center of    *
      *  window function. That is, where w_func = 1. This is just T_in at      *
@@ -84,30 +94,59 @@ Fresnel_Transform_Double(rssringoccs_TAUObj *tau, double *x_arr, double *w_func,
      *  reciprocal of F as a variable and compute with that.                  */
     rcpr_F  = 1.0/tau->F_km_vals[center];
     rcpr_F2 = rcpr_F*rcpr_F;
+    a       = x_arr[n_pts-1]*rcpr_F2;
     factor  = 0.5*tau->dx_km*rcpr_F;
 
     /*  Use a Riemann Sum to approximate the Fresnel Inverse Integral.        */
-    for (m = 0; m<n_pts; ++m)
+    for (m = 0; m < n_pts; m += n_blk)
     {
-        x = x_arr[m]*rcpr_F2;
+        /*  The sum is done in blocks so the kernel can be vectorized.        */
+        n_blk = n_pts - m;
+        if (n_blk > RSSRINGOCCS_FRESNEL_BLOCK_SIZE)
+            n_blk = RSSRINGOCCS_FRESNEL_BLOCK_SIZE;
+
+        /*  Compute exp(-i a j^2) scaled by the window function, for the      *
+         *  points j = n, n-1, ..., n-n_blk+1 samples from the center.        */
+        if (tau->use_float)
+        {
+            /*  psi = a j^2 is exact in double, and the single precision      *
+             *  kernel reduces it in double before rounding to float.         */
+            for (l = 0; l < n_blk; ++l)
+                psi_blk[l] = a*(double)(n - l)*(double)(n - l);
 
-        /*  Use Euler's Theorem to compute exp(-ix). Scale by window function.*/
-        cos_x = rssringoccs_Double_Cos(x);
-        sin_x = rssringoccs_Double_Sin(x);
-        arg = rssringoccs_CDouble_Rect(cos_x, -sin_x);
-        exp_negative_ix = rssringoccs_CDouble_Multiply_Real(w_func[m], arg);
+            rssringoccs_Fresnel_Kernel_Block_Float(psi_blk, w_func + m,
+                                                   ker_re_f, ker_im_f, n_blk,
+                                                   NULL);
+        }
+        else
+            rssringoccs_Fresnel_Quadratic_Kernel_Block(a, n, w_func + m,
+                                                       ker_re, ker_im, n_blk,
+                                                       NULL);
 
         /*  Take advantage of the symmetry of the quadratic approximation.    *
-         *  This cuts the number of computations roughly in half. If the T_in *
-         *  pointer does not contain at least 2*n_pts+1 points, n_pts to the  *
-         *  left and n_pts to the right of the center, then this will create  *
-         *  a segmentation fault, crashing the program.                       */
-        integrand = rssringoccs_CDouble_Add(tau->T_in[center - n],
-                                            tau->T_in[center + n]);
-        integrand = rssringoccs_CDouble_Multiply(exp_negative_ix, integrand);
-        tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
-                                                     integrand);
-        n -= 1;
+         *  This cuts the number of computations roughly in half. The left    *
+         *  half is summed from center - n, and the right half is summed      *
+         *  backwards from center + n. If the T_in pointer does not contain   *
+         *  at least 2*n_pts+1 points, n_pts to the left and n_pts to the     *
+         *  right of the center, then this will create a segmentation fault,  *
+         *  crashing the program.                                             */
+        if (tau->use_float)
+        {
+            rssringoccs_Fresnel_Riemann_Block_Float(tau, ker_re_f, ker_im_f,
+                                                    center - n, 1, n_blk,
+                                                    center);
+            rssringoccs_Fresnel_Riemann_Block_Float(tau, ker_re_f, ker_im_f,
+                                                    center + n, -1, n_blk,
+                                                    center);
+        }
+        else
+        {
+            rssringoccs_Fresnel_Riemann_Block(tau, ker_re, ker_im,
+                                              center - n, 1, n_blk, center);
+            rssringoccs_Fresnel_Riemann_Block(tau, ker_re, ker_im,
+                                              center + n, -1, n_blk, center);
+        }
+        n -= n_blk;
     }
 
     /*  Multiply result by the coefficient found in the Fresnel inverse.      */
@@ -17,6 +17,7 @@
  *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
  ******************************************************************************/
 
+#include <stdlib.h>
 #include <rss_ringoccs/include/rss_ringoccs_math.h>
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 #include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
@@ -74,18 +75,32 @@
  ******************************************************************************/
 RSS_RINGOCCS_EXPORT void
 Fresnel_Transform_Legendre_Odd_Double(rssringoccs_TAUObj *tau, double *x_arr,
-                                      double *w_func, double *coeffs,
+                                      const double *w_func, double *coeffs,
                                       unsigned long n_pts,
                                       unsigned long center)
 {
     /*  Declare all necessary variables. i, j, and k are used for indexing.   */
-    unsigned long i, j;
+    unsigned long i, j, n, n_blk;
     unsigned char k;
 
     /*  Variables for the Fresnel kernel and ring radii.                      */
-    double x, x2, psi, sin_psi, cos_psi;
+    double x, x2;
     double psi_even, psi_odd, rcpr_D, factor;
-    rssringoccs_ComplexDouble exp_negative_psi, exp_positive_psi, integrand;
+    rssringoccs_ComplexDouble integrand;
+
+    /*  psi and w exp(-ipsi) on the left and right sides for a block.         */
+    double psi_left[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double psi_right[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double left_re[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double left_im[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double right_re[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double right_im[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+
+    /*  The same, in single precision, if tau->use_float is set.              */
+    float left_re_f[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    float left_im_f[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    float right_re_f[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    float right_im_f[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
 
     /*  Division is more expension than division, so store the reciprocal     *
      *  of D as a variable and compute with that.                             */
@@ -97,48 +112,68 @@ Fresnel_Transform_Legendre_Odd_Double(rssringoccs_TAUObj *tau, double *x_arr,
     j = n_pts;
 
     /*  Use a Riemann Sum to approximate the Fresnel Inverse Integral.        */
-    for (i = 0; i<n_pts; ++i)
+    for (i = 0; i < n_pts; i += n_blk)
     {
-        x  = x_arr[i]*rcpr_D;
-        x2 = x*x;
+        /*  The sum is done in blocks so the kernel can be vectorized.        */
+        n_blk = n_pts - i;
+        if (n_blk > RSSRINGOCCS_FRESNEL_BLOCK_SIZE)
+            n_blk = RSSRINGOCCS_FRESNEL_BLOCK_SIZE;
 
-        /*  Compute psi using Horner's Method for Polynomial Computation.     */
-        psi_odd  = coeffs[tau->order - 1];
-        psi_even = coeffs[tau->order - 2];
-        for (k=2; k<tau->order-1; k += 2)
+        for (n = 0; n < n_blk; ++n)
         {
-            psi_odd  = psi_odd*x2  + coeffs[tau->order - k - 1];
-            psi_even = psi_even*x2 + coeffs[tau->order - k - 2];
-        }
+            x  = x_arr[i+n]*rcpr_D;
+            x2 = x*x;
 
-        /*  The leading term is x^2, so multiply by this and kD.              */
-        psi_even *= tau->k_vals[center]*tau->D_km_vals[center] * x2;
-        psi_odd  *= tau->k_vals[center]*tau->D_km_vals[center] * x2 * x;
+            /*  Compute psi using Horner's Method for Polynomial Computation. */
+            psi_odd  = coeffs[tau->order - 1];
+            psi_even = coeffs[tau->order - 2];
+            for (k=2; k<tau->order-1; k += 2)
+            {
+                psi_odd  = psi_odd*x2  + coeffs[tau->order - k - 1];
+                psi_even = psi_even*x2 + coeffs[tau->order - k - 2];
+            }
 
-        /*  Compute the left side of exp(-ipsi) using Euler's Formula.        */
-        psi = psi_even - psi_odd;
-        cos_psi = w_func[i]*rssringoccs_Double_Cos(psi);
-        sin_psi = w_func[i]*rssringoccs_Double_Sin(psi);
-        exp_negative_psi = rssringoccs_CDouble_Rect(cos_psi, -sin_psi);
+            /*  The leading term is x^2, so multiply by this and kD.          */
+            psi_even *= tau->k_vals[center]*tau->D_km_vals[center] * x2;
+            psi_odd  *= tau->k_vals[center]*tau->D_km_vals[center] * x2 * x;
 
-        /*  Compute the right side of exp(-ipsi) using Euler's Formula.       */
-        psi = psi_even + psi_odd;
-        cos_psi = w_func[i]*rssringoccs_Double_Cos(psi);
-        sin_psi = w_func[i]*rssringoccs_Double_Sin(psi);
-        exp_positive_psi = rssringoccs_CDouble_Rect(cos_psi, -sin_psi);
+            /*  psi on the left and right sides of the window.                */
+            psi_left[n]  = psi_even - psi_odd;
+            psi_right[n] = psi_even + psi_odd;
+        }
 
-        /*  Compute the transform with a Riemann sum. If the T_in pointer     *
-         *  does not contain at least 2*n_pts+1 points, n_pts to the left and *
-         *  right of the center, then this will create a segmentation fault.  */
-        integrand = rssringoccs_CDouble_Multiply(exp_negative_psi,
-                                                 tau->T_in[center-j]);
-        tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
-                                                     integrand);
-        integrand = rssringoccs_CDouble_Multiply(exp_positive_psi,
-                                                 tau->T_in[center+j]);
-        tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
-                                                     integrand);
-        j -= 1;
+        /*  Compute w exp(-ipsi) on both sides of the window, and the         *
+         *  transform with a Riemann sum. The right side is summed backwards  *
+         *  from center + j. If the T_in pointer does not contain at least    *
+         *  2*n_pts+1 points, n_pts to the left and right of the center, then *
+         *  this will create a segmentation fault.                            */
+        if (tau->use_float)
+        {
+            rssringoccs_Fresnel_Kernel_Block_Float(psi_left, w_func + i,
+                                                   left_re_f, left_im_f,
+                                                   n_blk, NULL);
+            rssringoccs_Fresnel_Kernel_Block_Float(psi_right, w_func + i,
+                                                   right_re_f, right_im_f,
+                                                   n_blk, NULL);
+            rssringoccs_Fresnel_Riemann_Block_Float(tau, left_re_f, left_im_f,
+                                                    center - j, 1, n_blk,
+                                                    center);
+            rssringoccs_Fresnel_Riemann_Block_Float(tau, right_re_f,
+                                                    right_im_f, center + j,
+                                                    -1, n_blk, center);
+        }
+        else
+        {
+            rssringoccs_Fresnel_Kernel_Block(psi_left, w_func + i, left_re,
+                                             left_im, n_blk, NULL);
+            rssringoccs_Fresnel_Kernel_Block(psi_right, w_func + i, right_re,
+                                             right_im, n_blk, NULL);
+            rssringoccs_Fresnel_Riemann_Block(tau, left_re, left_im,
+                                              center - j, 1, n_blk, center);
+            rssringoccs_Fresnel_Riemann_Block(tau, right_re, right_im,
+                                              center + j, -1, n_blk, center);
+        }
+        j -= n_blk;
     }
 
     /*  Add the central point in the Riemann sum. This is center of the       *
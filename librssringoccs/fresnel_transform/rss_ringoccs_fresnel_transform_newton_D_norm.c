@@ -23,18 +23,23 @@
 #include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
 RSS_RINGOCCS_EXPORT void
 Fresnel_Transform_Newton_D_Norm_Double(rssringoccs_TAUObj *tau,
-                                       double *w_func,
+                                       const double *w_func,
                                        unsigned long n_pts,
                                        unsigned long center)
 {
 
     /*  Declare all necessary variables. i and j are used for indexing.       */
-    unsigned long m, offset;
+    unsigned long m, k, n_blk, offset;
 
-    /*  The Fresnel kernel and the stationary ring azimuth angle.             */
-    double psi, phi, x, y, z, dx, dy, D;
-    double exp_psi_re, exp_psi_im, abs_norm, real_norm;
-    rssringoccs_ComplexDouble exp_psi, norm, integrand;
+    /*  The normalization of the window.                                      */
+    double abs_norm, real_norm;
+    rssringoccs_ComplexDouble norm, integrand;
+
+    /*  Stationary phi, Fresnel kernel, and w exp(-ipsi) for a block.         */
+    double phi_blk[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double psi_blk[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_re[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_im[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
 
     /*  Initialize T_out and norm to zero so we can loop over later.          */
     tau->T_out[center] = rssringoccs_CDouble_Zero;
@@ -45,55 +50,43 @@ Fresnel_Transform_Newton_D_Norm_Double(rssringoccs_TAUObj *tau,
     offset = center-(unsigned long)((n_pts-1)/2);
 
     /*  Use a Riemann Sum to approximate the Fresnel Inverse Integral.        */
-    for (m = 0; m<n_pts; ++m)
+    for (m = 0; m < n_pts; m += n_blk)
     {
-        /*  Calculate the stationary value of psi with respect to phi.        */
-        phi = Newton_Raphson_Fresnel_Psi_D(
+        /*  The sum is done in blocks so the kernel can be vectorized.        */
+        n_blk = n_pts - m;
+        if (n_blk > RSSRINGOCCS_FRESNEL_BLOCK_SIZE)
+            n_blk = RSSRINGOCCS_FRESNEL_BLOCK_SIZE;
+
+        /*  Calculate the stationary value of phi for the whole block,        *
+         *  starting from phi_rad_vals, and the Fresnel kernel there.         */
+        for (k = 0; k < n_blk; ++k)
+            phi_blk[k] = tau->phi_rad_vals[offset+k];
+
+        rssringoccs_Double_Newton_Raphson_Fresnel_Psi_D_Array(
             tau->k_vals[center],
             tau->rho_km_vals[center],
-            tau->rho_km_vals[offset],
-            tau->phi_rad_vals[offset],
-            tau->phi_rad_vals[offset],
+            tau->rho_km_vals + offset,
+            tau->phi_rad_vals + offset,
             tau->B_rad_vals[center],
             tau->EPS,
             tau->toler,
             tau->rx_km_vals[center],
             tau->ry_km_vals[center],
-            tau->rz_km_vals[center]
+            tau->rz_km_vals[center],
+            phi_blk,
+            psi_blk,
+            n_blk
         );
 
-        x = tau->rho_km_vals[offset] * cos(phi);
-        y = tau->rho_km_vals[offset] * sin(phi);
-        z = tau->rz_km_vals[center];
-        dx = x - tau->rx_km_vals[center];
-        dy = y - tau->ry_km_vals[center];
-        D = sqrt(dx*dx + dy*dy + z*z);
-
-        /*  Compute the left side of exp(-ipsi) using Euler's Formula.        */
-        psi = rssringoccs_Double_Fresnel_Psi(
-            tau->k_vals[center],
-            tau->rho_km_vals[center],
-            tau->rho_km_vals[offset],
-            phi,
-            tau->phi_rad_vals[offset],
-            tau->B_rad_vals[center],
-            D
-        );
-
-        exp_psi_re = cos(psi)*w_func[m];
-        exp_psi_im = -sin(psi)*w_func[m];
-        exp_psi = rssringoccs_CDouble_Rect(exp_psi_re, exp_psi_im);
-
-        /*  Compute the norm using a Riemann sum as well.                     */
-        norm = rssringoccs_CDouble_Add(norm, exp_psi);
-
-        /*  Compute the transform with a Riemann sum. If the T_in pointer     *
-         *  does not contain at least 2*n_pts+1 points, n_pts to the left and *
-         *  right of the center, then this will create a segmentation fault.  */
-        integrand = rssringoccs_CDouble_Multiply(exp_psi, tau->T_in[offset]);
-        tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
-                                                     integrand);
-        offset += 1;
+        /*  Compute w exp(-ipsi) and add the block to the Riemann sum. If     *
+         *  the T_in pointer does not contain at least 2*n_pts+1 points,      *
+         *  n_pts to the left and right of the center, then this will create  *
+         *  a segmentation fault.                                             */
+        rssringoccs_Fresnel_Kernel_Block(psi_blk, w_func + m, ker_re, ker_im,
+                                         n_blk, &norm);
+        rssringoccs_Fresnel_Riemann_Block(tau, ker_re, ker_im, offset, 1,
+                                          n_blk, center);
+        offset += n_blk;
     }
 
     /*  The integral in the numerator of norm evaluates to F sqrt(2). Use     *
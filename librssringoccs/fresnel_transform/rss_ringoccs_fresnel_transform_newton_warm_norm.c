@@ -0,0 +1,100 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_kernel.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
+
+/*  Normalized version of Fresnel_Transform_Newton_Warm_Double.               */
+RSS_RINGOCCS_EXPORT void
+Fresnel_Transform_Newton_Warm_Norm_Double(rssringoccs_TAUObj *tau,
+                                          const double *w_func,
+                                          unsigned long n_pts,
+                                          unsigned long center,
+                                          double *phi_warm)
+{
+    /*  Declare all necessary variables. i and j are used for indexing.       */
+    unsigned long m, n_blk, offset;
+
+    /*  The normalization of the window.                                      */
+    double real_norm, abs_norm;
+    rssringoccs_ComplexDouble norm, integrand;
+
+    /*  Fresnel kernel and w exp(-ipsi) for a block of the window.            */
+    double psi_blk[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_re[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_im[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+
+    /*  Initialize T_out and norm to zero so we can loop over later.          */
+    tau->T_out[center] = rssringoccs_CDouble_Zero;
+    norm = rssringoccs_CDouble_Zero;
+
+    /*  Symmetry is lost without the Legendre polynomials, or Fresnel         *
+     *  quadratic. Must compute everything from -W/2 to W/2.                  */
+    offset = center - (long)((n_pts-1)/2);
+
+    /*  Use a Riemann Sum to approximate the Fresnel Inverse Integral.        */
+    for (m = 0; m < n_pts; m += n_blk)
+    {
+        /*  The sum is done in blocks so the kernel can be vectorized.        */
+        n_blk = n_pts - m;
+        if (n_blk > RSSRINGOCCS_FRESNEL_BLOCK_SIZE)
+            n_blk = RSSRINGOCCS_FRESNEL_BLOCK_SIZE;
+
+        /*  Calculate the stationary value of phi for the whole block,        *
+         *  starting from the values found at the previous center, and the    *
+         *  Fresnel kernel there. phi_warm is updated in place.               */
+        rssringoccs_Double_Newton_Raphson_Fresnel_Psi_Array(
+            tau->k_vals[center],
+            tau->rho_km_vals[center],
+            tau->rho_km_vals + offset,
+            tau->phi_rad_vals + offset,
+            tau->B_rad_vals[center],
+            tau->D_km_vals[center],
+            tau->EPS,
+            tau->toler,
+            phi_warm + m,
+            psi_blk,
+            n_blk
+        );
+
+        /*  Compute w exp(-ipsi) and add the block to the Riemann sum. If     *
+         *  the T_in pointer does not contain at least 2*n_pts+1 points,      *
+         *  n_pts to the left and right of the center, then this will create  *
+         *  a segmentation fault.                                             */
+        rssringoccs_Fresnel_Kernel_Block(psi_blk, w_func + m, ker_re, ker_im,
+                                         n_blk, &norm);
+        rssringoccs_Fresnel_Riemann_Block(tau, ker_re, ker_im, offset, 1,
+                                          n_blk, center);
+        offset += n_blk;
+    }
+
+    /*  The integral in the numerator of norm evaluates to F sqrt(2). Use     *
+     *  this in the calculation of the normalization. The cabs function       *
+     *  computes the absolute value of complex number (defined in complex.h). */
+    abs_norm = rssringoccs_CDouble_Abs(norm);
+    real_norm = rssringoccs_Sqrt_Two / abs_norm;
+
+    /*  Multiply result by the coefficient found in the Fresnel inverse.      *
+     *  The 1/F term is omitted, since the F in the norm cancels this.        */
+    integrand = rssringoccs_CDouble_Rect(0.5*real_norm, 0.5*real_norm);
+    tau->T_out[center] = rssringoccs_CDouble_Multiply(integrand,
+                                                      tau->T_out[center]);
+}
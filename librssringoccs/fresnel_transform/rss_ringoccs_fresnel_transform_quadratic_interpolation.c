@@ -68,19 +68,24 @@
  ******************************************************************************/
 RSS_RINGOCCS_EXPORT void
 Fresnel_Transform_Quadratic_Double(rssringoccs_TAUObj *tau,
-                                   double *w_func,
+                                   const double *w_func,
                                    unsigned long n_pts,
                                    unsigned long center)
 {
     /*  Declare all necessary variables. i and j are used for indexing.       */
-    unsigned long i, ind[4], offset;
+    unsigned long i, k, n_blk, ind[4], offset;
 
     /*  The Fresnel kernel and ring azimuth angle.                            */
     double C[2], factor, rcpr_w, rcpr_w_sq, psi_n[4], x;
-    double psi, phi, sin_psi, cos_psi;
+    double psi, phi;
     double psi_half_mean, psi_half_diff;
     double psi_full_mean, psi_full_diff;
-    rssringoccs_ComplexDouble exp_psi, integrand;
+    rssringoccs_ComplexDouble integrand;
+
+    /*  Fresnel kernel and w exp(-ipsi) for a block of the window.            */
+    double psi_blk[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_re[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
+    double ker_im[RSSRINGOCCS_FRESNEL_BLOCK_SIZE];
 
     rcpr_w = 1.0 / tau->w_km_vals[center];
     rcpr_w_sq = rcpr_w * rcpr_w;
@@ -133,19 +138,30 @@ Fresnel_Transform_Quadratic_Double(rssringoccs_TAUObj *tau,
     C[0] = (8*psi_half_diff - psi_full_diff) * rcpr_w * 0.333333333333333333333;
     C[1] = (16*psi_half_mean-psi_full_mean)*rcpr_w_sq*1.33333333333333333333333;
 
-    for (i = 0; i<n_pts; ++i)
+    for (i = 0; i < n_pts; i += n_blk)
     {
-        x = tau->rho_km_vals[center] - tau->rho_km_vals[offset];
-        psi = C[1]*x + C[0];
-        psi = psi*x;
-
-        cos_psi = w_func[i]*rssringoccs_Double_Cos(psi);
-        sin_psi = w_func[i]*rssringoccs_Double_Sin(psi);
-        exp_psi = rssringoccs_CDouble_Rect(cos_psi, -sin_psi);
-        integrand = rssringoccs_CDouble_Multiply(exp_psi, tau->T_in[offset]);
-        tau->T_out[center] = rssringoccs_CDouble_Add(tau->T_out[center],
-                                                     integrand);
-        offset += 1;
+        /*  The sum is done in blocks so the kernel can be vectorized.        */
+        n_blk = n_pts - i;
+        if (n_blk > RSSRINGOCCS_FRESNEL_BLOCK_SIZE)
+            n_blk = RSSRINGOCCS_FRESNEL_BLOCK_SIZE;
+
+        for (k = 0; k < n_blk; ++k)
+        {
+            x = tau->rho_km_vals[center] - tau->rho_km_vals[offset+k];
+            psi = C[1]*x + C[0];
+            psi = psi*x;
+            psi_blk[k] = psi;
+        }
+
+        /*  Compute w exp(-ipsi) and add the block to the Riemann sum. If     *
+         *  the T_in pointer does not contain at least 2*n_pts+1 points,      *
+         *  n_pts to the left and right of the center, then this will create  *
+         *  a segmentation fault.                                             */
+        rssringoccs_Fresnel_Kernel_Block(psi_blk, w_func + i, ker_re, ker_im,
+                                         n_blk, NULL);
+        rssringoccs_Fresnel_Riemann_Block(tau, ker_re, ker_im, offset, 1,
+                                          n_blk, center);
+        offset += n_blk;
     }
 
     /*  Multiply result by the coefficient found in the Fresnel inverse.      */
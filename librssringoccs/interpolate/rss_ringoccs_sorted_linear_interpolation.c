@@ -56,6 +56,8 @@
  *          y_new[m] = y[n-1] + --------------- * (x_new[m] - x[n-1])         *
  *                               x[n] - x[n-1]                                *
  *                                                                            *
+ *      The search for n starts from the n of the previous point, so sorted   *
+ *      x_new costs O(N + N_new). Otherwise n is found by bisection.          *
  *  NOTES:                                                                    *
  *      No error checks are made on whether or not the pointers are NULL or   *
  *      if there are N and N_new elements to x, y, and x_new, y_new,          *
@@ -110,18 +112,18 @@ rssringoccs_Float_Sorted_Interp1d(float *x,
                                   float *y_new,
                                   unsigned long N_new)
 {
-    /*  Declare two variables for indexing the interpolated and raw data.     */
-    unsigned long m, n;
+    /*  Declare variables for indexing the interpolated and raw data.         */
+    unsigned long m, n, low, high, mid;
 
     /*  And declare a variable for computing the slope for the interpolation. */
     float slope;
 
+    /*  n is kept between the points of x_new, see the general case below.    */
+    n = 0;
+
     /*  Loop over the entries of the interpolated pointers and compute.       */
     for (m=0; m<N_new; ++m)
     {
-        /*  Reset n to zero.                                                  */
-        n = 0;
-
         /*  If x_new[m] falls outside of the bounds of x, return NaN.         */
         if ((x_new[m] < x[0]) || (x_new[m] > x[N-1]))
             y_new[m] = rssringoccs_NaN_F;
@@ -137,7 +139,25 @@ rssringoccs_Float_Sorted_Interp1d(float *x,
         /*  And finally, handle the general case.                             */
         else
         {
-            /*  Find the smallest index n such that x[n] > x_new[m].          */
+            /*  Find the smallest index n such that x[n] > x_new[m]. If this  *
+             *  is not before the index for the previous point, as it is not  *
+             *  when x_new is increasing, search forward from there. If not,  *
+             *  bisect, keeping x[low] <= x_new[m] < x[high].                 */
+            if ((n == 0) || (x[n-1] > x_new[m]))
+            {
+                low = 0;
+                high = N-1;
+                while (high - low > 1)
+                {
+                    mid = low + (high - low)/2;
+                    if (x[mid] <= x_new[m])
+                        low = mid;
+                    else
+                        high = mid;
+                }
+                n = high;
+            }
+
             while (x[n] <= x_new[m])
                 n++;
 
@@ -159,18 +179,18 @@ rssringoccs_Double_Sorted_Interp1d(double *x,
                                    double *y_new,
                                    unsigned long N_new)
 {
-    /*  Declare two variables for indexing the interpolated and raw data.     */
-    unsigned long m, n;
+    /*  Declare variables for indexing the interpolated and raw data.         */
+    unsigned long m, n, low, high, mid;
 
     /*  And declare a variable for computing the slope for the interpolation. */
     double slope;
 
+    /*  n is kept between the points of x_new, see the general case below.    */
+    n = 0;
+
     /*  Loop over the entries of the interpolated pointers and compute.       */
     for (m=0; m<N_new; ++m)
     {
-        /*  Reset n to zero.                                                  */
-        n = 0;
-
         /*  If x_new[m] falls outside of the bounds of x, return NaN.         */
         if ((x_new[m] < x[0]) || (x_new[m] > x[N-1]))
             y_new[m] = rssringoccs_NaN;
@@ -186,7 +206,25 @@ rssringoccs_Double_Sorted_Interp1d(double *x,
         /*  And finally, handle the general case.                             */
         else
         {
-            /*  Find the smallest index n such that x[n] > x_new[m].          */
+            /*  Find the smallest index n such that x[n] > x_new[m]. If this  *
+             *  is not before the index for the previous point, as it is not  *
+             *  when x_new is increasing, search forward from there. If not,  *
+             *  bisect, keeping x[low] <= x_new[m] < x[high].                 */
+            if ((n == 0) || (x[n-1] > x_new[m]))
+            {
+                low = 0;
+                high = N-1;
+                while (high - low > 1)
+                {
+                    mid = low + (high - low)/2;
+                    if (x[mid] <= x_new[m])
+                        low = mid;
+                    else
+                        high = mid;
+                }
+                n = high;
+            }
+
             while (x[n] <= x_new[m])
                 n++;
 
@@ -208,18 +246,18 @@ rssringoccs_LDouble_Sorted_Interp1d(long double *x,
                                     long double *y_new,
                                     unsigned long N_new)
 {
-    /*  Declare two variables for indexing the interpolated and raw data.     */
-    unsigned long m, n;
+    /*  Declare variables for indexing the interpolated and raw data.         */
+    unsigned long m, n, low, high, mid;
 
     /*  And declare a variable for computing the slope for the interpolation. */
     long double slope;
 
+    /*  n is kept between the points of x_new, see the general case below.    */
+    n = 0;
+
     /*  Loop over the entries of the interpolated pointers and compute.       */
     for (m=0; m<N_new; ++m)
     {
-        /*  Reset n to zero.                                                  */
-        n = 0;
-
         /*  If x_new[m] falls outside of the bounds of x, return NaN.         */
         if ((x_new[m] < x[0]) || (x_new[m] > x[N-1]))
             y_new[m] = rssringoccs_NaN_L;
@@ -235,7 +273,25 @@ rssringoccs_LDouble_Sorted_Interp1d(long double *x,
         /*  And finally, handle the general case.                             */
         else
         {
-            /*  Find the smallest index n such that x[n] > x_new[m].          */
+            /*  Find the smallest index n such that x[n] > x_new[m]. If this  *
+             *  is not before the index for the previous point, as it is not  *
+             *  when x_new is increasing, search forward from there. If not,  *
+             *  bisect, keeping x[low] <= x_new[m] < x[high].                 */
+            if ((n == 0) || (x[n-1] > x_new[m]))
+            {
+                low = 0;
+                high = N-1;
+                while (high - low > 1)
+                {
+                    mid = low + (high - low)/2;
+                    if (x[mid] <= x_new[m])
+                        low = mid;
+                    else
+                        high = mid;
+                }
+                n = high;
+            }
+
             while (x[n] <= x_new[m])
                 n++;
 
@@ -0,0 +1,174 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                           rss_ringoccs_log_array                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the natural log of every element of an array.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Double_Log_Array:                                         *
+ *  Purpose:                                                                  *
+ *      Sets y[n] = log(x[n]) for 0 <= n < len.                               *
+ *  Arguments:                                                                *
+ *      x (const double *):                                                   *
+ *          The input array.                                                  *
+ *      y (double *):                                                         *
+ *          The output array. This may be x itself.                           *
+ *      len (unsigned long):                                                  *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Double_Log_Array_Strided:                                 *
+ *  Purpose:                                                                  *
+ *      Sets y[n*y_step] = log(x[n*x_step]) for 0 <= n < len.                 *
+ *  Arguments:                                                                *
+ *      x (const double *):                                                   *
+ *          The input array.                                                  *
+ *      x_step (long):                                                        *
+ *          The step between elements of x. This may be negative.             *
+ *      y (double *):                                                         *
+ *          The output array. This may be x itself, with the same step.       *
+ *      y_step (long):                                                        *
+ *          The step between elements of y.                                   *
+ *      len (unsigned long):                                                  *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      The elements are copied into a contiguous block, computed as in       *
+ *      rssringoccs_Double_Log_Array, and copied back out.                    *
+ ******************************************************************************
+ *  Method:                                                                   *
+ *      The array is worked through in blocks. Every element of a block is    *
+ *      written as x = 2^k m with sqrt(2)/2 <= m < sqrt(2), and log(x) = k    *
+ *      log(2) + log(m) is found from a polynomial in s = (m - 1)/(m + 1). k  *
+ *      and m are found by scaling x by powers of two, not from the bits of   *
+ *      x. This loop has no branches, so it is vectorized. Elements that are  *
+ *      not positive normal numbers are then recomputed with the standard     *
+ *      library.                                                              *
+ *                                                                            *
+ *      The file is built with -fno-trapping-math and -fno-math-errno, where  *
+ *      the compiler has them, so that the compiler may vectorize the loop.   *
+ *      With RSSRINGOCCS_TARGET_CLONES, AVX2 and AVX-512 versions are also    *
+ *      built, and the best one for the CPU is used.                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) float.h:                                                              *
+ *          C standard library header. Used for DBL_MAX.                      *
+ *  2.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  3.) rss_ringoccs_math.h:                                                  *
+ *          Header file where these functions are declared.                   *
+ *  4.) rss_ringoccs_math_private.h:                                          *
+ *          Private header file containing the kernels.                       *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <float.h>
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include "rss_ringoccs_math_private.h"
+
+/*  Computes log(x[n]) for n < len <= RSSRINGOCCS_ARRAY_BLOCK. x and y may    *
+ *  be the same array.                                                        */
+static RSSRINGOCCS_TARGET_CLONES void
+__log_block(const double *x, double *y, unsigned int len)
+{
+    double out[RSSRINGOCCS_ARRAY_BLOCK];
+    double val;
+    int in_range;
+    unsigned int n;
+
+    /*  Zero, negative numbers, subnormals, infinity, and NaN are replaced    *
+     *  with one. They are recomputed below.                                  */
+    for (n = 0U; n < len; ++n)
+    {
+        in_range = (x[n] >= RSSRINGOCCS_LOG_KERNEL_MIN) & (x[n] <= DBL_MAX);
+        val = in_range ? x[n] : 1.0;
+        __RSSRINGOCCS_LOG_KERNEL__(val, out[n]);
+    }
+
+    /*  Recompute the elements outside of the range of the kernel.            */
+    for (n = 0U; n < len; ++n)
+        if (!((x[n] >= RSSRINGOCCS_LOG_KERNEL_MIN) && (x[n] <= DBL_MAX)))
+            out[n] = log(x[n]);
+
+    for (n = 0U; n < len; ++n)
+        y[n] = out[n];
+}
+/*  End of __log_block.                                                       */
+
+/*  Function for computing log of every element of an array.                  */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_Log_Array(const double *x, double *y, unsigned long len)
+{
+    unsigned long n;
+    unsigned int block;
+
+    for (n = 0UL; n < len; n += block)
+    {
+        if (len - n < RSSRINGOCCS_ARRAY_BLOCK)
+            block = (unsigned int)(len - n);
+        else
+            block = RSSRINGOCCS_ARRAY_BLOCK;
+
+        __log_block(x + n, y + n, block);
+    }
+}
+/*  End of rssringoccs_Double_Log_Array.                                      */
+
+/*  Same as rssringoccs_Double_Log_Array, for arrays with a step between      *
+ *  elements.                                                                 */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_Log_Array_Strided(const double *x, long x_step,
+                                     double *y, long y_step,
+                                     unsigned long len)
+{
+    double buffer[RSSRINGOCCS_ARRAY_BLOCK];
+    unsigned long n;
+    unsigned int k, block;
+
+    if ((x_step == 1L) && (y_step == 1L))
+    {
+        rssringoccs_Double_Log_Array(x, y, len);
+        return;
+    }
+
+    for (n = 0UL; n < len; n += block)
+    {
+        if (len - n < RSSRINGOCCS_ARRAY_BLOCK)
+            block = (unsigned int)(len - n);
+        else
+            block = RSSRINGOCCS_ARRAY_BLOCK;
+
+        for (k = 0U; k < block; ++k)
+            buffer[k] = x[(long)(n + k)*x_step];
+
+        __log_block(buffer, buffer, block);
+
+        for (k = 0U; k < block; ++k)
+            y[(long)(n + k)*y_step] = buffer[k];
+    }
+}
+/*  End of rssringoccs_Double_Log_Array_Strided.                              */
@@ -18,4 +18,171 @@ extern float rssringoccs_cosf_table(unsigned int n);
 extern double rssringoccs_cos_table(unsigned int n);
 extern long double rssringoccs_cosl_table(unsigned int n);
 
+/******************************************************************************
+ *  Kernels for the array functions (rssringoccs_Double_Sin_Array, etc.).     *
+ *  These have no branches, table lookups, or library calls, only ?: between  *
+ *  values, so that a loop over them can be vectorized. Each is only valid    *
+ *  on a range of x. The array functions compute every element with the       *
+ *  kernel, with x replaced by a dummy value outside of this range, and then  *
+ *  recompute the elements outside of the range with the standard library.    *
+ *  The coefficients are those of fdlibm, and the results are within an ulp   *
+ *  or two of the standard library.                                           *
+ ******************************************************************************/
+
+/*  The array functions work on blocks of this many elements at a time.       */
+#define RSSRINGOCCS_ARRAY_BLOCK 256
+
+/*  Adding and subtracting 1.5 * 2^52 rounds |x| < 2^51 to an integer.        */
+#define RSSRINGOCCS_ROUND_MAGIC 6755399441055744.0
+
+/*  Largest |x| for the sine and cosine kernels. Beyond this, n pi/2 can not  *
+ *  be subtracted from x exactly with the three part splitting of pi/2.       */
+#define RSSRINGOCCS_TRIG_KERNEL_MAX 5.0E5
+
+/*  Largest |x| for the exp kernel. 2^k is then a normal number.              */
+#define RSSRINGOCCS_EXP_KERNEL_MAX 708.0
+
+/*  Smallest positive normal double. log is computed with the kernel for      *
+ *  finite x greater than or equal to this.                                   */
+#define RSSRINGOCCS_LOG_KERNEL_MIN 2.2250738585072014E-308
+
+/*  Reduces x to r = x - q pi/2 with |r| <= pi/4, where q is an unsigned int. *
+ *  pi/2 is split into three parts of 33 bits, and a tail. For |x| no larger  *
+ *  than RSSRINGOCCS_TRIG_KERNEL_MAX each product q*part is exact.            */
+#define __RSSRINGOCCS_REDUCE_PIO2__(x, r, q)                                   \
+    do {                                                                       \
+        double __fn = ((x)*6.36619772367581382433E-01                          \
+                       + RSSRINGOCCS_ROUND_MAGIC) - RSSRINGOCCS_ROUND_MAGIC;   \
+        (q) = (unsigned int)(int)__fn;                                         \
+        (r) = (x) - __fn*1.57079632673412561417E+00;                           \
+        (r) = (r) - __fn*6.07710050630396597660E-11;                           \
+        (r) = (r) - __fn*2.02226624871116645580E-21;                           \
+        (r) = (r) - __fn*8.47842766036889956997E-32;                           \
+    } while(0)
+
+/*  sin(r) for |r| <= pi/4, with z = r*r.                                     */
+#define __RSSRINGOCCS_SIN_KERNEL__(r, z)                                       \
+    ((r) + (z)*(r)*(-1.66666666666666324348E-01 +                              \
+     (z)*(8.33333333332248946124E-03 +                                         \
+     (z)*(-1.98412698298579493134E-04 +                                        \
+     (z)*(2.75573137070700676789E-06 +                                         \
+     (z)*(-2.50507602534068634195E-08 +                                        \
+     (z)*1.58969099521155010221E-10))))))
+
+/*  cos(r) for |r| <= pi/4, with z = r*r. This is evaluated as                *
+ *  (1 - z/2) + z^2 P(z), adding back the rounding error in 1 - z/2.          */
+#define __RSSRINGOCCS_COS_KERNEL__(z, c)                                       \
+    do {                                                                       \
+        double __hz = 0.5*(z);                                                 \
+        double __w = 1.0 - __hz;                                               \
+        double __p = (z)*(4.16666666666666019037E-02 +                         \
+                     (z)*(-1.38888888888741095749E-03 +                        \
+                     (z)*(2.48015872894767294178E-05 +                         \
+                     (z)*(-2.75573143513906633035E-07 +                        \
+                     (z)*(2.08757232129817482790E-09 +                         \
+                     (z)*-1.13596475577881948265E-11)))));                     \
+        (c) = __w + (((1.0 - __w) - __hz) + (z)*__p);                          \
+    } while(0)
+
+/*  Given the kernels s = sin(r) and c = cos(r), with r = x - q pi/2, sets    *
+ *  sin_x and cos_x to sin(x) and cos(x).                                     */
+#define __RSSRINGOCCS_SINCOS_QUADRANT__(q, s, c, sin_x, cos_x)                 \
+    do {                                                                       \
+        double __ts = ((q) & 1U) ? (c) : (s);                                  \
+        double __tc = ((q) & 1U) ? (s) : (c);                                  \
+        (sin_x) = ((q) & 2U) ? -__ts : __ts;                                   \
+        (cos_x) = (((q) + 1U) & 2U) ? -__tc : __tc;                            \
+    } while(0)
+
+/*  Sets y to exp(x) for |x| <= RSSRINGOCCS_EXP_KERNEL_MAX. x = k ln(2) + r   *
+ *  with |r| <= ln(2)/2, and exp(x) = 2^k exp(r). 2^k is built by squaring,   *
+ *  rather than from the bits of a double, so that it stays portable.         */
+#define __RSSRINGOCCS_EXP_KERNEL__(x, y)                                       \
+    do {                                                                       \
+        double __kd = ((x)*1.44269504088896338700E+00                          \
+                       + RSSRINGOCCS_ROUND_MAGIC) - RSSRINGOCCS_ROUND_MAGIC;   \
+        double __hi = (x) - __kd*6.93147180369123816490E-01;                   \
+        double __lo = __kd*1.90821492927058770002E-10;                         \
+        double __r = __hi - __lo;                                              \
+        double __t = __r*__r;                                                  \
+        double __c = __r - __t*(1.66666666666666019037E-01 +                   \
+                     __t*(-2.77777777770155933842E-03 +                        \
+                     __t*(6.61375632143793436117E-05 +                         \
+                     __t*(-1.65339022054652515390E-06 +                        \
+                     __t*4.13813679705723846039E-08))));                       \
+        double __base = (__kd < 0.0) ? 0.5 : 2.0;                              \
+        double __scale = 1.0;                                                  \
+        unsigned int __m = (unsigned int)(int)fabs(__kd);                      \
+        unsigned int __j;                                                      \
+        for (__j = 0U; __j < 10U; ++__j)                                       \
+        {                                                                      \
+            __scale = (__m & 1U) ? __scale*__base : __scale;                   \
+            __base *= __base;                                                  \
+            __m >>= 1;                                                         \
+        }                                                                      \
+        (y) = __scale*(1.0 - ((__lo - (__r*__c)/(2.0 - __c)) - __hi));         \
+    } while(0)
+
+/*  One step of the kernel for log. If m >= up = 2^e, m is multiplied by      *
+ *  down = 2^-e and e is added to k.                                          */
+#define __RSSRINGOCCS_LOG_STEP__(m, k, e, up, down)                            \
+    do {                                                                       \
+        int __ge = ((m) >= (up));                                              \
+        (k) += __ge ? (e) : 0.0;                                               \
+        (m) = __ge ? (m)*(down) : (m);                                         \
+    } while(0)
+
+/*  Sets y to log(x) for finite x >= RSSRINGOCCS_LOG_KERNEL_MIN. x = 2^k m,   *
+ *  with sqrt(2)/2 <= m < sqrt(2), and log(x) = k log(2) + log(m). If x < 1   *
+ *  it is first multiplied by 2^1022, so that x >= 1. m and k are then found  *
+ *  by dividing by 2^(2^j), from j = 9 down to j = 0, which leaves            *
+ *  1 <= m < 2. The steps are written out since the compiler does not unroll  *
+ *  a loop over j, and the outer loop is then not vectorized.                 */
+#define __RSSRINGOCCS_LOG_KERNEL__(x, y)                                       \
+    do {                                                                       \
+        int __small = ((x) < 1.0);                                             \
+        double __m = __small ? (x)*4.49423283715579E+307 : (x);                \
+        double __k = __small ? -1022.0 : 0.0;                                  \
+        double __f, __s, __z, __w, __hfsq, __R;                                \
+        int __big;                                                             \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 512.0,                              \
+            1.3407807929942597E+154, 7.458340731200207E-155);                  \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 256.0,                              \
+            1.157920892373162E+77, 8.636168555094445E-78);                     \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 128.0,                              \
+            3.402823669209385E+38, 2.938735877055719E-39);                     \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 64.0,                               \
+            1.8446744073709552E+19, 5.421010862427522E-20);                    \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 32.0,                               \
+            4294967296.0, 2.3283064365386963E-10);                             \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 16.0,                               \
+            65536.0, 1.52587890625E-05);                                       \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 8.0,                                \
+            256.0, 0.00390625);                                                \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 4.0,                                \
+            16.0, 0.0625);                                                     \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 2.0,                                \
+            4.0, 0.25);                                                        \
+        __RSSRINGOCCS_LOG_STEP__(__m, __k, 1.0,                                \
+            2.0, 0.5);                                                         \
+        __big = (__m > 1.41421356237309504880);                                \
+        __k += __big ? 1.0 : 0.0;                                              \
+        __m = __big ? 0.5*__m : __m;                                           \
+        __f = __m - 1.0;                                                       \
+        __s = __f/(2.0 + __f);                                                 \
+        __z = __s*__s;                                                         \
+        __w = __z*__z;                                                         \
+        __R = __w*(3.999999999940941908E-01 +                                  \
+              __w*(2.222219843214978396E-01 +                                  \
+              __w*1.531383769920937332E-01)) +                                 \
+              __z*(6.666666666666735130E-01 +                                  \
+              __w*(2.857142874366239149E-01 +                                  \
+              __w*(1.818357216161805012E-01 +                                  \
+              __w*1.479819860511658591E-01)));                                 \
+        __hfsq = 0.5*__f*__f;                                                  \
+        (y) = __k*6.93147180369123816490E-01 -                                 \
+              ((__hfsq - (__s*(__hfsq + __R)                                   \
+                + __k*1.90821492927058770002E-10)) - __f);                     \
+    } while(0)
+
 #endif
@@ -1,5 +1,6 @@
 /*  Header file where the prototypes for these functions are defined.         */
 #include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
 #include "rss_ringoccs_math_private.h"
 
 /*  Only compile if the user requested these algorithms.                      */
@@ -331,3 +332,28 @@ RSS_RINGOCCS_EXPORT long double rssringoccs_do_cosl(long double x)
 
 #endif
 /*  End of #if __RSS_RINGOCCS_USE_TRIG_ALGORITHMS__ != 0.                     */
+
+/*  Computes sin(x) and cos(x) together, reducing x modulo pi/2 only once.    *
+ *  This uses the same kernels as rssringoccs_Double_SinCos_Array, so the two *
+ *  agree bit for bit. Large x, infinity, NaN, and zero (the kernel would     *
+ *  give +0 for sin(-0)) are passed on to the standard library.               */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_SinCos(double x, double *sin_x, double *cos_x)
+{
+    double r, z, s, c;
+    unsigned int q;
+
+    if (!(fabs(x) <= RSSRINGOCCS_TRIG_KERNEL_MAX) || (x == 0.0))
+    {
+        *sin_x = sin(x);
+        *cos_x = cos(x);
+        return;
+    }
+
+    __RSSRINGOCCS_REDUCE_PIO2__(x, r, q);
+    z = r*r;
+    s = __RSSRINGOCCS_SIN_KERNEL__(r, z);
+    __RSSRINGOCCS_COS_KERNEL__(z, c);
+    __RSSRINGOCCS_SINCOS_QUADRANT__(q, s, c, *sin_x, *cos_x);
+}
+/*  End of rssringoccs_Double_SinCos.                                         */
@@ -0,0 +1,191 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_sincos_array                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the sine and cosine of every element of an array.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Double_SinCos_Array:                                      *
+ *  Purpose:                                                                  *
+ *      Sets sin_x[n] = sin(x[n]) and cos_x[n] = cos(x[n]) for 0 <= n < len.  *
+ *  Arguments:                                                                *
+ *      x (const double *):                                                   *
+ *          The input array.                                                  *
+ *      sin_x (double *):                                                     *
+ *          The array for sin(x). This may be x itself.                       *
+ *      cos_x (double *):                                                     *
+ *          The array for cos(x). This may be x itself, but not sin_x.        *
+ *      len (unsigned long):                                                  *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Double_SinCos_Array_Strided:                              *
+ *  Purpose:                                                                  *
+ *      Sets sin_x[n*sin_step] = sin(x[n*x_step]) and cos_x[n*cos_step] =     *
+ *      cos(x[n*x_step]) for 0 <= n < len.                                    *
+ *  Arguments:                                                                *
+ *      x (const double *):                                                   *
+ *          The input array.                                                  *
+ *      x_step (long):                                                        *
+ *          The step between elements of x. This may be negative.             *
+ *      sin_x (double *):                                                     *
+ *          The array for sin(x).                                             *
+ *      sin_step (long):                                                      *
+ *          The step between elements of sin_x.                               *
+ *      cos_x (double *):                                                     *
+ *          The array for cos(x).                                             *
+ *      cos_step (long):                                                      *
+ *          The step between elements of cos_x.                               *
+ *      len (unsigned long):                                                  *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      The elements are copied into a contiguous block, computed as in       *
+ *      rssringoccs_Double_SinCos_Array, and copied back out.                 *
+ ******************************************************************************
+ *  Method:                                                                   *
+ *      As for rssringoccs_Double_Sin_Array. x is reduced once, and both      *
+ *      sin(x) and cos(x) are found from the same polynomials for sin(r) and  *
+ *      cos(r).                                                               *
+ *                                                                            *
+ *      The file is built with -fno-trapping-math and -fno-math-errno, where  *
+ *      the compiler has them, so that the compiler may vectorize the loop.   *
+ *      With RSSRINGOCCS_TARGET_CLONES, AVX2 and AVX-512 versions are also    *
+ *      built, and the best one for the CPU is used.                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  2.) rss_ringoccs_math.h:                                                  *
+ *          Header file where these functions are declared.                   *
+ *  3.) rss_ringoccs_math_private.h:                                          *
+ *          Private header file containing the kernels.                       *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include "rss_ringoccs_math_private.h"
+
+/*  Computes sin(x[n]) and cos(x[n]) for n < len <= RSSRINGOCCS_ARRAY_BLOCK.  *
+ *  x may be the same array as sin_x or cos_x.                                */
+static RSSRINGOCCS_TARGET_CLONES void
+__sincos_block(const double *x, double *sin_x, double *cos_x, unsigned int len)
+{
+    double out_sin[RSSRINGOCCS_ARRAY_BLOCK];
+    double out_cos[RSSRINGOCCS_ARRAY_BLOCK];
+    double val, r, z, s, c;
+    unsigned int n, q;
+
+    /*  The comparison is false for NaN, so NaN is replaced with zero too.    */
+    for (n = 0U; n < len; ++n)
+    {
+        val = (fabs(x[n]) <= RSSRINGOCCS_TRIG_KERNEL_MAX) ? x[n] : 0.0;
+        __RSSRINGOCCS_REDUCE_PIO2__(val, r, q);
+        z = r*r;
+        s = __RSSRINGOCCS_SIN_KERNEL__(r, z);
+        __RSSRINGOCCS_COS_KERNEL__(z, c);
+        __RSSRINGOCCS_SINCOS_QUADRANT__(q, s, c, out_sin[n], out_cos[n]);
+    }
+
+    /*  Recompute the elements outside of the range of the kernel. Zero is    *
+     *  recomputed as well, since the kernel returns +0 for sin(-0).          */
+    for (n = 0U; n < len; ++n)
+    {
+        if (!(fabs(x[n]) <= RSSRINGOCCS_TRIG_KERNEL_MAX) || (x[n] == 0.0))
+        {
+            out_sin[n] = sin(x[n]);
+            out_cos[n] = cos(x[n]);
+        }
+    }
+
+    for (n = 0U; n < len; ++n)
+    {
+        sin_x[n] = out_sin[n];
+        cos_x[n] = out_cos[n];
+    }
+}
+/*  End of __sincos_block.                                                    */
+
+/*  Function for computing sin and cos of every element of an array.          */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_SinCos_Array(const double *x, double *sin_x, double *cos_x,
+                                unsigned long len)
+{
+    unsigned long n;
+    unsigned int block;
+
+    for (n = 0UL; n < len; n += block)
+    {
+        if (len - n < RSSRINGOCCS_ARRAY_BLOCK)
+            block = (unsigned int)(len - n);
+        else
+            block = RSSRINGOCCS_ARRAY_BLOCK;
+
+        __sincos_block(x + n, sin_x + n, cos_x + n, block);
+    }
+}
+/*  End of rssringoccs_Double_SinCos_Array.                                   */
+
+/*  Same as rssringoccs_Double_SinCos_Array, for arrays with a step between   *
+ *  elements.                                                                 */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Double_SinCos_Array_Strided(const double *x, long x_step,
+                                        double *sin_x, long sin_step,
+                                        double *cos_x, long cos_step,
+                                        unsigned long len)
+{
+    double sin_buffer[RSSRINGOCCS_ARRAY_BLOCK];
+    double cos_buffer[RSSRINGOCCS_ARRAY_BLOCK];
+    unsigned long n;
+    unsigned int k, block;
+
+    if ((x_step == 1L) && (sin_step == 1L) && (cos_step == 1L))
+    {
+        rssringoccs_Double_SinCos_Array(x, sin_x, cos_x, len);
+        return;
+    }
+
+    for (n = 0UL; n < len; n += block)
+    {
+        if (len - n < RSSRINGOCCS_ARRAY_BLOCK)
+            block = (unsigned int)(len - n);
+        else
+            block = RSSRINGOCCS_ARRAY_BLOCK;
+
+        for (k = 0U; k < block; ++k)
+            sin_buffer[k] = x[(long)(n + k)*x_step];
+
+        __sincos_block(sin_buffer, sin_buffer, cos_buffer, block);
+
+        for (k = 0U; k < block; ++k)
+        {
+            sin_x[(long)(n + k)*sin_step] = sin_buffer[k];
+            cos_x[(long)(n + k)*cos_step] = cos_buffer[k];
+        }
+    }
+}
+/*  End of rssringoccs_Double_SinCos_Array_Strided.                           */
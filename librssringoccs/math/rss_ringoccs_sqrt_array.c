@@ -0,0 +1,102 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                          rss_ringoccs_sqrt_array                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the square root of every element of an array.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Double_Sqrt_Array:                                        *
+ *  Purpose:                                                                  *
+ *      Sets y[n] = sqrt(x[n]) for 0 <= n < len.                              *
+ *  Arguments:                                                                *
+ *      x (const double *):                                                   *
+ *          The input array.                                                  *
+ *      y (double *):                                                         *
+ *          The output array. This may be x itself.                           *
+ *      len (unsigned long):                                                  *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Double_Sqrt_Array_Strided:                                *
+ *  Purpose:                                                                  *
+ *      Sets y[n*y_step] = sqrt(x[n*x_step]) for 0 <= n < len.                *
+ *  Arguments:                                                                *
+ *      x (const double *):                                                   *
+ *          The input array.                                                  *
+ *      x_step (long):                                                        *
+ *          The step between elements of x. This may be negative.             *
+ *      y (double *):                                                         *
+ *          The output array. This may be x itself, with the same step.       *
+ *      y_step (long):                                                        *
+ *          The step between elements of y.                                   *
+ *      len (unsigned long):                                                  *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *  Method:                                                                   *
+ *      The square root is a single instruction on most CPUs, and a loop over *
+ *      it is vectorized directly. The file is built with -fno-math-errno,    *
+ *      where the compiler has it, since otherwise sqrt of a negative number  *
+ *      must set errno and the loop can not be vectorized. sqrt of a negative *
+ *      number is NaN, as usual, but errno is not set. With                   *
+ *      RSSRINGOCCS_TARGET_CLONES, AVX2 and AVX-512 versions are also built,  *
+ *      and the best one for the CPU is used.                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) rss_ringoccs_config.h:                                                *
+ *          Header file containing RSSRINGOCCS_TARGET_CLONES.                 *
+ *  2.) rss_ringoccs_math.h:                                                  *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <rss_ringoccs/include/rss_ringoccs_config.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+
+/*  Function for computing sqrt of every element of an array.                 */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Double_Sqrt_Array(const double *x, double *y, unsigned long len)
+{
+    unsigned long n;
+
+    for (n = 0UL; n < len; ++n)
+        y[n] = sqrt(x[n]);
+}
+/*  End of rssringoccs_Double_Sqrt_Array.                                     */
+
+/*  Same as rssringoccs_Double_Sqrt_Array, for arrays with a step between     *
+ *  elements.                                                                 */
+RSS_RINGOCCS_EXPORT RSSRINGOCCS_TARGET_CLONES void
+rssringoccs_Double_Sqrt_Array_Strided(const double *x, long x_step,
+                                      double *y, long y_step,
+                                      unsigned long len)
+{
+    unsigned long n;
+
+    for (n = 0UL; n < len; ++n)
+        y[(long)n*y_step] = sqrt(x[(long)n*x_step]);
+}
+/*  End of rssringoccs_Double_Sqrt_Array_Strided.                             */
@@ -20,7 +20,8 @@
  ******************************************************************************
  *  Purpose:                                                                  *
  *      Provides the code needed for copying all relevant data from a         *
- *      rssringoccs_DLPObj pointer into a rssringoccs_TAUObj pointer.         *
+ *      rssringoccs_DLPObj pointer into a rssringoccs_TAUObj pointer, or for  *
+ *      pointing the tau object at the data of the DLP without a copy.        *
  ******************************************************************************
  *                             DEFINED FUNCTIONS                              *
  ******************************************************************************
@@ -50,6 +51,30 @@
  *          the dlp pointer. Destroying the tau object does NOT free the      *
  *          memory in the dlp object, and vice-versa. To avoid memory leaks   *
  *          one must destroy both the dlp and tau objects when done with them.*
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Borrow_DLP_Data_To_Tau:                                   *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Copy_DLP_Data_To_Tau, but the members of tau      *
+ *      point at the arrays of the DLP, except for phase_rad_vals, which is   *
+ *      negated and so always copied.                                         *
+ *  Arguments:                                                                *
+ *      dlp (rssringoccs_DLPObj *):                                           *
+ *          A pointer to a rssringoccs_DLPObj.                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  NOTES:                                                                    *
+ *      1.) The borrowed arrays are recorded in tau->borrowed. They are never *
+ *          written to or freed by tau. An array that must be changed, like   *
+ *          rho_dot_kms_vals for an ingress occultation, is first copied with *
+ *          rssringoccs_Tau_Own_Array.                                        *
+ *      2.) The arrays of the DLP must stay valid until rssringoccs_Tau_Finish*
+ *          has been called, which copies the part of them that is used, or   *
+ *          until tau is destroyed, whichever is first.                       *
+ *      3.) For large data sets this saves a copy of the input, and the time  *
+ *          taken to make it.                                                 *
  ******************************************************************************
  *                               DEPENDENCIES                                 *
  ******************************************************************************
@@ -124,7 +149,9 @@
     }                                                                          \
                                                                                \
     /*  Allocate memory for the variable.                                    */\
-    tau->var = (double *)malloc(sizeof(*tau->var) * tau->arr_size);            \
+    tau->var = (double *)rssringoccs_Tau_Arena_Alloc(                          \
+        tau, sizeof(*tau->var) * tau->arr_size                                 \
+    );                                                                         \
                                                                                \
     /*  Check if malloc failed.                                              */\
     if (tau->var == NULL)                                                      \
@@ -139,6 +166,27 @@
     }
 /*  End of the __MALLOC_TAU_VAR__ macro.                                      */
 
+/*  Same as __MALLOC_TAU_VAR__, but points tau->var at the array of the dlp,  *
+ *  and records it as borrowed.                                               */
+#define __BORROW_TAU_VAR__(var)                                                \
+    /*  Check if the variable is not NULL. It should be at the start.        */\
+    if (tau->var != NULL)                                                      \
+    {                                                                          \
+        tau->error_occurred = rssringoccs_True;                                \
+        tau->error_message = rssringoccs_strdup(                               \
+            "\n\rError Encountered: rss_ringoccs\n"                            \
+            "\r\trssringoccs_Borrow_DLP_Data_To_Tau\n\n"                       \
+            "\r"#var" is not NULL. It is likely you've already set the data\n" \
+            "\rfor this tau object. Returning.\n"                              \
+        );                                                                     \
+        return;                                                                \
+    }                                                                          \
+                                                                               \
+    tau->var = dlp->var;                                                       \
+    tau->borrowed[tau->n_borrowed] = tau->var;                                 \
+    ++tau->n_borrowed;
+/*  End of the __BORROW_TAU_VAR__ macro.                                      */
+
 /*  Use this macro to save on repetitive code. It is for checking that all of *
  *  of the values of a given member in the tau object are non-negative.       */
 #define __TAU_CHECK_NON_NEGATIVE__(var)                                        \
@@ -178,9 +226,11 @@
     }
 /*  End of the __TAU_CHECK_TWO_PI__ macro.                                    */
 
-/*  Function for copying the relevant DLP data to a tau object.               */
-RSS_RINGOCCS_EXPORT void rssringoccs_Copy_DLP_Data_To_Tau(rssringoccs_DLPObj *dlp,
-                                      rssringoccs_TAUObj *tau)
+/*  Copies the relevant DLP data to a tau object, or points tau at it if      *
+ *  borrow is true.                                                           */
+static void
+__get_dlp_data(rssringoccs_DLPObj *dlp, rssringoccs_TAUObj *tau,
+               rssringoccs_Bool borrow)
 {
     /*  Declare necessary variables. C89 requires this at the top.            */
     unsigned long n;
@@ -239,55 +289,92 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Copy_DLP_Data_To_Tau(rssringoccs_DLPObj *dl
         return;
     }
 
-    /*  The __MALLOC_TAU_VAR__ macro ends with an if statement and so has     *
-     *  braces {}. Because of this, we do not need a semi-colon at the end.   *
-     *  This macro allocates memory for the members of the tau object and     *
-     *  checks for errors.                                                    */
-    __MALLOC_TAU_VAR__(rho_km_vals)
-    __MALLOC_TAU_VAR__(phi_rad_vals)
-    __MALLOC_TAU_VAR__(f_sky_hz_vals)
-    __MALLOC_TAU_VAR__(rho_dot_kms_vals)
-    __MALLOC_TAU_VAR__(raw_tau_threshold_vals)
-    __MALLOC_TAU_VAR__(B_rad_vals)
-    __MALLOC_TAU_VAR__(D_km_vals)
-    __MALLOC_TAU_VAR__(t_oet_spm_vals)
-    __MALLOC_TAU_VAR__(t_ret_spm_vals)
-    __MALLOC_TAU_VAR__(t_set_spm_vals)
-    __MALLOC_TAU_VAR__(rho_corr_pole_km_vals)
-    __MALLOC_TAU_VAR__(rho_corr_timing_km_vals)
-    __MALLOC_TAU_VAR__(phi_rl_rad_vals)
-    __MALLOC_TAU_VAR__(p_norm_vals)
-    __MALLOC_TAU_VAR__(phase_rad_vals)
-    __MALLOC_TAU_VAR__(rx_km_vals)
-    __MALLOC_TAU_VAR__(ry_km_vals)
-    __MALLOC_TAU_VAR__(rz_km_vals)
+    /*  One slab holds these arrays and the ones the reconstruction adds      *
+     *  later, T_in, T_out, the outputs, and so on. Each array is padded to   *
+     *  the alignment of the arena.                                           */
+    rssringoccs_Tau_Arena_Init(
+        tau,
+        RSSRINGOCCS_TAU_ARENA_ARRAYS *
+        (sizeof(double) * tau->arr_size + RSSRINGOCCS_TAU_ARENA_ALIGN)
+    );
 
-    /*  Loop through the entries of all of the pointers and set the nth value *
-     *  of a tau member to the nth value of the corresponding dlp member.     */
-    for (n=0; n<dlp->arr_size; ++n)
+    /*  The __BORROW_TAU_VAR__ macro has no side effects on the dlp. The      *
+     *  arrays are only read until rssringoccs_Tau_Own_Array copies them.     */
+    if (borrow)
     {
-        tau->rho_km_vals[n] = dlp->rho_km_vals[n];
-        tau->phi_rad_vals[n] = dlp->phi_rad_vals[n];
-        tau->B_rad_vals[n] = dlp->B_rad_vals[n];
-        tau->D_km_vals[n] = dlp->D_km_vals[n];
-        tau->f_sky_hz_vals[n] = dlp->f_sky_hz_vals[n];
-        tau->rho_dot_kms_vals[n] = dlp->rho_dot_kms_vals[n];
-        tau->t_oet_spm_vals[n] = dlp->t_oet_spm_vals[n];
-        tau->t_ret_spm_vals[n] = dlp->t_ret_spm_vals[n];
-        tau->t_set_spm_vals[n] = dlp->t_set_spm_vals[n];
-        tau->rho_corr_pole_km_vals[n] = dlp->rho_corr_pole_km_vals[n];
-        tau->rho_corr_timing_km_vals[n] = dlp->rho_corr_timing_km_vals[n];
-        tau->phi_rl_rad_vals[n] = dlp->phi_rl_rad_vals[n];
-        tau->p_norm_vals[n] = dlp->p_norm_vals[n];
-        tau->raw_tau_threshold_vals[n] = dlp->raw_tau_threshold_vals[n];
-        tau->rx_km_vals[n] = dlp->rx_km_vals[n];
-        tau->ry_km_vals[n] = dlp->ry_km_vals[n];
-        tau->rz_km_vals[n] = dlp->rz_km_vals[n];
+        __BORROW_TAU_VAR__(rho_km_vals)
+        __BORROW_TAU_VAR__(phi_rad_vals)
+        __BORROW_TAU_VAR__(f_sky_hz_vals)
+        __BORROW_TAU_VAR__(rho_dot_kms_vals)
+        __BORROW_TAU_VAR__(raw_tau_threshold_vals)
+        __BORROW_TAU_VAR__(B_rad_vals)
+        __BORROW_TAU_VAR__(D_km_vals)
+        __BORROW_TAU_VAR__(t_oet_spm_vals)
+        __BORROW_TAU_VAR__(t_ret_spm_vals)
+        __BORROW_TAU_VAR__(t_set_spm_vals)
+        __BORROW_TAU_VAR__(rho_corr_pole_km_vals)
+        __BORROW_TAU_VAR__(rho_corr_timing_km_vals)
+        __BORROW_TAU_VAR__(phi_rl_rad_vals)
+        __BORROW_TAU_VAR__(p_norm_vals)
+        __BORROW_TAU_VAR__(rx_km_vals)
+        __BORROW_TAU_VAR__(ry_km_vals)
+        __BORROW_TAU_VAR__(rz_km_vals)
+    }
+    else
+    {
+        /*  The __MALLOC_TAU_VAR__ macro ends with an if statement and so has *
+         *  braces {}. Because of this, we do not need a semi-colon at the    *
+         *  end. This macro allocates memory for the members of the tau       *
+         *  object and checks for errors.                                     */
+        __MALLOC_TAU_VAR__(rho_km_vals)
+        __MALLOC_TAU_VAR__(phi_rad_vals)
+        __MALLOC_TAU_VAR__(f_sky_hz_vals)
+        __MALLOC_TAU_VAR__(rho_dot_kms_vals)
+        __MALLOC_TAU_VAR__(raw_tau_threshold_vals)
+        __MALLOC_TAU_VAR__(B_rad_vals)
+        __MALLOC_TAU_VAR__(D_km_vals)
+        __MALLOC_TAU_VAR__(t_oet_spm_vals)
+        __MALLOC_TAU_VAR__(t_ret_spm_vals)
+        __MALLOC_TAU_VAR__(t_set_spm_vals)
+        __MALLOC_TAU_VAR__(rho_corr_pole_km_vals)
+        __MALLOC_TAU_VAR__(rho_corr_timing_km_vals)
+        __MALLOC_TAU_VAR__(phi_rl_rad_vals)
+        __MALLOC_TAU_VAR__(p_norm_vals)
+        __MALLOC_TAU_VAR__(rx_km_vals)
+        __MALLOC_TAU_VAR__(ry_km_vals)
+        __MALLOC_TAU_VAR__(rz_km_vals)
 
-        /*  The phase needs to be negated due to mathematical conventions.    */
-        tau->phase_rad_vals[n] = -dlp->phase_rad_vals[n];
+        /*  Loop through the entries of all of the pointers and set the nth   *
+         *  value of a tau member to the nth value of the dlp member.         */
+        for (n=0; n<dlp->arr_size; ++n)
+        {
+            tau->rho_km_vals[n] = dlp->rho_km_vals[n];
+            tau->phi_rad_vals[n] = dlp->phi_rad_vals[n];
+            tau->B_rad_vals[n] = dlp->B_rad_vals[n];
+            tau->D_km_vals[n] = dlp->D_km_vals[n];
+            tau->f_sky_hz_vals[n] = dlp->f_sky_hz_vals[n];
+            tau->rho_dot_kms_vals[n] = dlp->rho_dot_kms_vals[n];
+            tau->t_oet_spm_vals[n] = dlp->t_oet_spm_vals[n];
+            tau->t_ret_spm_vals[n] = dlp->t_ret_spm_vals[n];
+            tau->t_set_spm_vals[n] = dlp->t_set_spm_vals[n];
+            tau->rho_corr_pole_km_vals[n] = dlp->rho_corr_pole_km_vals[n];
+            tau->rho_corr_timing_km_vals[n] = dlp->rho_corr_timing_km_vals[n];
+            tau->phi_rl_rad_vals[n] = dlp->phi_rl_rad_vals[n];
+            tau->p_norm_vals[n] = dlp->p_norm_vals[n];
+            tau->raw_tau_threshold_vals[n] = dlp->raw_tau_threshold_vals[n];
+            tau->rx_km_vals[n] = dlp->rx_km_vals[n];
+            tau->ry_km_vals[n] = dlp->ry_km_vals[n];
+            tau->rz_km_vals[n] = dlp->rz_km_vals[n];
+        }
     }
 
+    /*  The phase needs to be negated due to mathematical conventions, so it  *
+     *  is always copied.                                                     */
+    __MALLOC_TAU_VAR__(phase_rad_vals)
+
+    for (n=0; n<dlp->arr_size; ++n)
+        tau->phase_rad_vals[n] = -dlp->phase_rad_vals[n];
+
     /*  Compute dx_km from the first and zeroth entries of rho_km_vals.       */
     tau->dx_km = tau->rho_km_vals[1] - tau->rho_km_vals[0];
 
@@ -334,4 +421,22 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Copy_DLP_Data_To_Tau(rssringoccs_DLPObj *dl
     __TAU_CHECK_TWO_PI__(phi_rad_vals)
     __TAU_CHECK_TWO_PI__(phase_rad_vals)
 }
+/*  End of __get_dlp_data.                                                    */
+
+/*  Function for copying the relevant DLP data to a tau object.               */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Copy_DLP_Data_To_Tau(rssringoccs_DLPObj *dlp,
+                                 rssringoccs_TAUObj *tau)
+{
+    __get_dlp_data(dlp, tau, rssringoccs_False);
+}
 /*  End of rssringoccs_Copy_DLP_Data_To_Tau.                                  */
+
+/*  Function for pointing a tau object at the relevant DLP data.              */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Borrow_DLP_Data_To_Tau(rssringoccs_DLPObj *dlp,
+                                   rssringoccs_TAUObj *tau)
+{
+    __get_dlp_data(dlp, tau, rssringoccs_True);
+}
+/*  End of rssringoccs_Borrow_DLP_Data_To_Tau.                                */
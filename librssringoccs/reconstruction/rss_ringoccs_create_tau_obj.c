@@ -47,6 +47,17 @@
  *          the dlp pointer. Destroying the tau object does NOT free the      *
  *          memory in the dlp object, and vice-versa. To avoid memory leaks   *
  *          one must destroy both the dlp and tau objects when done with them.*
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Create_TAUObj_Borrowed:                                   *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Create_TAUObj, but the tau object points at the   *
+ *      arrays of the dlp instead of copying them, with                       *
+ *      rssringoccs_Borrow_DLP_Data_To_Tau.                                   *
+ *  NOTES:                                                                    *
+ *      1.) The tau object does not free the arrays of the dlp, but they must *
+ *          stay valid until rssringoccs_Reconstruction has returned, or the  *
+ *          tau object has been destroyed.                                    *
  ******************************************************************************
  *                               DEPENDENCIES                                 *
  ******************************************************************************
@@ -97,8 +108,10 @@
 #include <stdlib.h>
 
 /*  Function for allocating memory for a Tau object and setting the default   *
- *  values for all of the keywords.                                           */
-RSS_RINGOCCS_EXPORT rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DLPObj *dlp, double res)
+ *  values for all of the keywords. The data of the dlp is borrowed if borrow *
+ *  is true, and copied otherwise.                                            */
+static rssringoccs_TAUObj *
+__create_tau(rssringoccs_DLPObj *dlp, double res, rssringoccs_Bool borrow)
 {
     /*  Declare necessary variables. C89 requires this at the top.            */
     rssringoccs_TAUObj *tau;
@@ -119,6 +132,10 @@ RSS_RINGOCCS_EXPORT rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DL
     tau->T_in = NULL;
     tau->T_out = NULL;
     tau->T_fwd = NULL;
+    tau->T_in_re = NULL;
+    tau->T_in_im = NULL;
+    tau->T_in_re_f = NULL;
+    tau->T_in_im_f = NULL;
     tau->rho_km_vals = NULL;
     tau->F_km_vals = NULL;
     tau->phi_rad_vals = NULL;
@@ -150,6 +167,14 @@ RSS_RINGOCCS_EXPORT rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DL
     tau->ry_km_vals = NULL;
     tau->rz_km_vals = NULL;
 
+    /*  The arena is allocated in rssringoccs_Copy_DLP_Data_To_Tau.           */
+    tau->arena = NULL;
+    tau->arena_size = 0;
+    tau->arena_used = 0;
+
+    /*  No arrays are borrowed from the dlp yet.                              */
+    tau->n_borrowed = 0U;
+
     /*  Set the error_occurred member to false and the error_message to NULL. *
      *  If no errors occur during processing, these variables will remain     *
      *  unchanged. Check them throughout to ensure no illegal actions happen. */
@@ -199,6 +224,20 @@ RSS_RINGOCCS_EXPORT rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DL
     tau->use_norm = rssringoccs_True;
     tau->use_fwd  = rssringoccs_False;
 
+    /*  Store T_in as separate real and imaginary arrays for the transforms.  */
+    tau->use_view = rssringoccs_True;
+
+    /*  Start each Newton-Raphson search from phi_rad_vals. Starting from the *
+     *  root found at the previous point is opt-in, it was no faster on the   *
+     *  Rev007 test data and changes the output within tau->EPS.              */
+    tau->use_warm_start = rssringoccs_False;
+
+    /*  Compute the Riemann sums in double precision by default.              */
+    tau->use_float = rssringoccs_False;
+
+    /*  Run on a single thread unless the user asks for more.                 */
+    tau->num_threads = 1U;
+
     /*  The default window is the modified Kaiser-Bessel with 2.0 alpha.      */
     tau->wtype = rssringoccs_strdup("kbmd20");
 
@@ -267,6 +306,12 @@ RSS_RINGOCCS_EXPORT rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DL
     tau->EPS = 1.0e-4;
     tau->toler = 4U;
 
+    /*  Compute the Legendre coefficients at every point. A positive value    *
+     *  lets them be interpolated between points if the estimated change in   *
+     *  psi is less than it, 1.0e-6 radians is a good choice.                 */
+    tau->legendre_tol = 0.0;
+    tau->legendre_err = 0.0;
+
     /**************************************************************************
      *  Grab the data from the DLP and compute some extra variables. This     *
      *  function computes the following for tau:                              *
@@ -292,7 +337,27 @@ RSS_RINGOCCS_EXPORT rssringoccs_TAUObj* rssringoccs_Create_TAUObj(rssringoccs_DL
      *      rz_km_vals                                                        *
      *  This function also checks that the arrays have valid entries.         *
      **************************************************************************/
-    rssringoccs_Copy_DLP_Data_To_Tau(dlp, tau);
+    if (borrow)
+        rssringoccs_Borrow_DLP_Data_To_Tau(dlp, tau);
+    else
+        rssringoccs_Copy_DLP_Data_To_Tau(dlp, tau);
+
     return tau;
 }
-/*  rssringoccs_Create_TAUObj.                                                */
+/*  End of __create_tau.                                                      */
+
+/*  Function for creating a tau object with a copy of the data of a dlp.      */
+RSS_RINGOCCS_EXPORT rssringoccs_TAUObj *
+rssringoccs_Create_TAUObj(rssringoccs_DLPObj *dlp, double res)
+{
+    return __create_tau(dlp, res, rssringoccs_False);
+}
+/*  End of rssringoccs_Create_TAUObj.                                         */
+
+/*  Function for creating a tau object that borrows the data of a dlp.        */
+RSS_RINGOCCS_EXPORT rssringoccs_TAUObj *
+rssringoccs_Create_TAUObj_Borrowed(rssringoccs_DLPObj *dlp, double res)
+{
+    return __create_tau(dlp, res, rssringoccs_True);
+}
+/*  End of rssringoccs_Create_TAUObj_Borrowed.                                */
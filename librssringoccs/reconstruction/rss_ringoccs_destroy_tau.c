@@ -30,6 +30,7 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_Tau(rssringoccs_TAUObj **tau)
         return;
 
     rssringoccs_Destroy_Tau_Members(tau_inst);
+    rssringoccs_Tau_Arena_Destroy(tau_inst);
 
     if (tau_inst->error_message != NULL)
     {
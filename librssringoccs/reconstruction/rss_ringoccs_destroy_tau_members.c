@@ -23,10 +23,17 @@
 #include <stdlib.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
-/*  Macro for freeing and nullifying the members of the geo CSV structs.      */
-#define DESTROY_TAU_VAR(var) if (var != NULL){free(var); var = NULL;}
+/*  Macro for freeing and nullifying the members of the tau object. Arrays in *
+ *  the arena are not freed one at a time, the arena is reset at the end.     */
+#define DESTROY_TAU_VAR(var)                                                   \
+    if (var != NULL)                                                           \
+    {                                                                          \
+        rssringoccs_Tau_Arena_Free(tau, var);                                  \
+        var = NULL;                                                            \
+    }
 
-/*  Function for freeing all member of a tau object except the error message. */
+/*  Function for freeing all member of a tau object except the error message. *
+ *  The arena is kept, and is freed by rssringoccs_Destroy_Tau.               */
 RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_Tau_Members(rssringoccs_TAUObj *tau)
 {
     /*  If the input pointer is NULL, do not try to access it. Just return.   */
@@ -67,5 +74,16 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Destroy_Tau_Members(rssringoccs_TAUObj *tau
     DESTROY_TAU_VAR(tau->T_in);
     DESTROY_TAU_VAR(tau->T_out);
     DESTROY_TAU_VAR(tau->T_fwd);
+    DESTROY_TAU_VAR(tau->T_in_re);
+    DESTROY_TAU_VAR(tau->T_in_im);
+    DESTROY_TAU_VAR(tau->T_in_re_f);
+    DESTROY_TAU_VAR(tau->T_in_im_f);
+
+    /*  The borrowed arrays were skipped above, and tau no longer points at   *
+     *  them.                                                                 */
+    tau->n_borrowed = 0U;
+
+    /*  Nothing points into the arena now. Keep it for the next data set.     */
+    rssringoccs_Tau_Arena_Reset(tau);
 }
 /*  End of rssringoccs_Destroy_Tau_Members.                                   */
@@ -0,0 +1,305 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *               rss_ringoccs_diffraction_correction_block_fft                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Reconstruct a data set with FFTs, using a Fresnel kernel computed     *
+ *      from the local geometry of each block of the data.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Diffraction_Correction_BlockFFT:                          *
+ *  Purpose:                                                                  *
+ *      Computes the Fresnel inversion of tau->T_in for the n_used points     *
+ *      starting at tau->start, and stores the result in tau->T_out.          *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      The Newton-Raphson transform computes, for every point rho,           *
+ *                                                                            *
+ *          T_out(rho) = sum_m w(rho - rho_m) exp(-i psi(rho, rho_m)) T_in_m  *
+ *                                                                            *
+ *      solving for the stationary azimuth angle at every rho_m. This is      *
+ *      O(N W) in time, W the number of points in the window. The kernel      *
+ *      depends on rho mostly through rho - rho_m, and the geometry (k, B,    *
+ *      D, and phi) changes slowly across the data set. So over a short       *
+ *      block of points the kernel may be replaced by the kernel at the       *
+ *      center of the block, rho_c. The sum is then a correlation:            *
+ *                                                                            *
+ *          T_out_j = sum_d K_d T_in_{j+d}                                    *
+ *                                                                            *
+ *      with K_d = w(rho_c - rho_{c+d}) exp(-i psi(rho_c, rho_{c+d})).        *
+ *      which is computed with FFTs using overlap-save. A block of L output   *
+ *      points needs the L + 2 nw input points around it, nw the half width   *
+ *      of the window, and these are transformed together with the kernel in  *
+ *      an FFT of size M >= L + 2 nw. M is the power of two at least four     *
+ *      times the window size, so most of each FFT produces output. The       *
+ *      blocks are computed one after the other, so the window and the        *
+ *      kernel follow the geometry across the occultation. This is unlike     *
+ *      SimpleFFT, which uses one kernel from the center of the data set.     *
+ *                                                                            *
+ *      The cost is O(N log W), and the accuracy approaches the Newton        *
+ *      method when the geometry changes little over M points.                *
+ *  NOTES:                                                                    *
+ *      1.) If tau->use_norm is set, each block is normalized by the          *
+ *          magnitude of the sum of its kernel, as the norm transforms do.    *
+ *      2.) This function sets the tau->error_occured Boolean to true on      *
+ *          error, and sets the tau->error_message to the error.              *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing fabs and sqrt(2).                          *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_fresnel_kernel.h:                                        *
+ *          Header file containing the Fresnel kernel and Newton-Raphson.     *
+ *  5.) rss_ringoccs_fft.h:                                                   *
+ *          Header file containing the FFT plans.                             *
+ *  6.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file containing the rssringoccs_TAUObj typedef.            *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_fresnel_kernel.h>
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  The FFT size is the smallest power of two that is at least this many      *
+ *  times the number of points in the window.                                 */
+#define RSSRINGOCCS_BLOCK_FFT_FACTOR 4UL
+
+/*  Function for reconstructing the data with an FFT per block.               */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Diffraction_Correction_BlockFFT(rssringoccs_TAUObj *tau)
+{
+    /*  Variables for indexing, and for the size and location of the block.   */
+    unsigned long n, j, first, last, block_start, block_len, block_center;
+    unsigned long fft_size, plan_size, nw_pts, nw_center;
+
+    /*  Signed indices for points to the left of the block.                   */
+    long d, ind;
+
+    /*  Variables for the Fresnel kernel.                                     */
+    double dx, psi, phi, x, w, scale, abs_norm;
+    rssringoccs_ComplexDouble norm, arg;
+
+    /*  The input data and the kernel for a block, and their transforms.      */
+    rssringoccs_ComplexDouble *T_seg, *ker, *tmp;
+
+    /*  Plans for the FFTs. These are reused while the FFT size is the same.  */
+    rssringoccs_FFT_Plan *fwd_plan, *inv_plan;
+
+    /*  Check that the pointers to the data are not NULL.                     */
+    rssringoccs_Tau_Check_Data(tau);
+    if (tau->error_occurred)
+        return;
+
+    /* Check to ensure you have enough data to the left.                      */
+    rssringoccs_Tau_Check_Data_Range(tau);
+    if (tau->error_occurred)
+        return;
+
+    first = tau->start;
+    last  = tau->start + tau->n_used;
+    dx    = tau->rho_km_vals[first+1] - tau->rho_km_vals[first];
+
+    T_seg     = NULL;
+    ker       = NULL;
+    fwd_plan  = NULL;
+    inv_plan  = NULL;
+    plan_size = 0;
+
+    for (block_start = first; block_start < last; block_start += block_len)
+    {
+        /*  Pick the FFT size from the window at the start of the block. The  *
+         *  window may get wider across the block, so use the widest window   *
+         *  in the block, and shrink the block until it fits.                 */
+        nw_pts = (unsigned long)(tau->w_km_vals[block_start] / (2.0*dx));
+        fft_size = 1;
+        while (fft_size < RSSRINGOCCS_BLOCK_FFT_FACTOR*(2*nw_pts + 1))
+            fft_size <<= 1;
+
+        for (;;)
+        {
+            block_len = fft_size - 2*nw_pts;
+            if (block_len > last - block_start)
+                block_len = last - block_start;
+
+            for (n = block_start; n < block_start + block_len; ++n)
+            {
+                j = (unsigned long)(tau->w_km_vals[n] / (2.0*dx));
+                if (j > nw_pts)
+                    nw_pts = j;
+            }
+
+            if (block_len + 2*nw_pts <= fft_size)
+                break;
+
+            fft_size <<= 1;
+        }
+
+        /*  The plans and arrays only change when the FFT size does.          */
+        if (fft_size != plan_size)
+        {
+            rssringoccs_FFT_Plan_Destroy(fwd_plan);
+            rssringoccs_FFT_Plan_Destroy(inv_plan);
+            fwd_plan = rssringoccs_FFT_Plan_Create(fft_size, rssringoccs_False,
+                                                   RSSRINGOCCS_FFT_DEFAULT);
+            inv_plan = rssringoccs_FFT_Plan_Create(fft_size, rssringoccs_True,
+                                                   RSSRINGOCCS_FFT_DEFAULT);
+
+            tmp = (rssringoccs_ComplexDouble *)
+                    realloc(T_seg, sizeof(*T_seg) * fft_size);
+            if (tmp != NULL)
+            {
+                T_seg = tmp;
+                tmp = (rssringoccs_ComplexDouble *)
+                        realloc(ker, sizeof(*ker) * fft_size);
+                if (tmp != NULL)
+                    ker = tmp;
+            }
+
+            if ((fwd_plan == NULL) || (inv_plan == NULL) || (tmp == NULL))
+            {
+                tau->error_occurred = rssringoccs_True;
+                tau->error_message = rssringoccs_strdup(
+                    "\n\rError Encountered: rss_ringoccs:\n"
+                    "\r\trssringoccs_Diffraction_Correction_BlockFFT\n"
+                    "\rMalloc failed and returned NULL. Aborting.\n\n"
+                );
+                break;
+            }
+
+            plan_size = fft_size;
+        }
+
+        /*  The input for the block, padded with zeros to the FFT size.       */
+        for (j = 0; j < fft_size; ++j)
+        {
+            ind = (long)block_start - (long)nw_pts + (long)j;
+            if ((j < block_len + 2*nw_pts) &&
+                (ind >= 0) && (ind < (long)tau->arr_size))
+                T_seg[j] = tau->T_in[ind];
+            else
+                T_seg[j] = rssringoccs_CDouble_Zero;
+        }
+
+        /*  The kernel from the geometry at the center of the block. The      *
+         *  correlation with K_d is a convolution with K_{-d}, so K_d is      *
+         *  stored at index -d mod fft_size.                                  */
+        block_center = block_start + block_len/2;
+        w = tau->w_km_vals[block_center];
+        nw_center = (unsigned long)(w / (2.0*dx));
+        norm = rssringoccs_CDouble_Zero;
+
+        for (j = 0; j < fft_size; ++j)
+            ker[j] = rssringoccs_CDouble_Zero;
+
+        for (d = -(long)nw_center; d <= (long)nw_center; ++d)
+        {
+            ind = (long)block_center + d;
+            if ((ind < 0) || (ind >= (long)tau->arr_size))
+                continue;
+
+            x = tau->rho_km_vals[block_center] - tau->rho_km_vals[ind];
+            if (fabs(x) > 0.5*w)
+                continue;
+
+            /*  Calculate the stationary value of psi with respect to phi.    */
+            phi = Newton_Raphson_Fresnel_Psi(
+                tau->k_vals[block_center],
+                tau->rho_km_vals[block_center],
+                tau->rho_km_vals[ind],
+                tau->phi_rad_vals[ind],
+                tau->phi_rad_vals[ind],
+                tau->B_rad_vals[block_center],
+                tau->D_km_vals[block_center],
+                tau->EPS,
+                tau->toler
+            );
+
+            psi = rssringoccs_Double_Fresnel_Psi(
+                tau->k_vals[block_center],
+                tau->rho_km_vals[block_center],
+                tau->rho_km_vals[ind],
+                phi,
+                tau->phi_rad_vals[ind],
+                tau->B_rad_vals[block_center],
+                tau->D_km_vals[block_center]
+            );
+
+            /*  The forward model has psi in place of -psi.                   */
+            if (!tau->use_fwd)
+                psi = -psi;
+
+            arg = rssringoccs_CDouble_Polar(tau->window_func(x, w), psi);
+            norm = rssringoccs_CDouble_Add(norm, arg);
+
+            if (d > 0)
+                ker[fft_size - (unsigned long)d] = arg;
+            else
+                ker[(unsigned long)(-d)] = arg;
+        }
+
+        /*  Convolve the kernel with the data.                                */
+        rssringoccs_FFT_Plan_Execute(fwd_plan, T_seg, T_seg);
+        rssringoccs_FFT_Plan_Execute(fwd_plan, ker, ker);
+
+        for (j = 0; j < fft_size; ++j)
+            T_seg[j] = rssringoccs_CDouble_Multiply(T_seg[j], ker[j]);
+
+        rssringoccs_FFT_Plan_Execute(inv_plan, T_seg, T_seg);
+
+        /*  Output j of the block is at index j + nw_pts of the convolution.  *
+         *  Multiply by the coefficient found in the Fresnel inverse.         */
+        abs_norm = rssringoccs_CDouble_Abs(norm);
+        for (j = 0; j < block_len; ++j)
+        {
+            n = block_start + j;
+
+            if (tau->use_norm)
+                scale = 0.5 * rssringoccs_Sqrt_Two / abs_norm;
+            else
+                scale = 0.5 * dx / tau->F_km_vals[n];
+
+            arg = rssringoccs_CDouble_Rect(scale, scale);
+            tau->T_out[n] = rssringoccs_CDouble_Multiply(arg,
+                                                         T_seg[j + nw_pts]);
+        }
+    }
+
+    /*  Free variables allocated by malloc.                                   */
+    free(T_seg);
+    free(ker);
+    rssringoccs_FFT_Plan_Destroy(fwd_plan);
+    rssringoccs_FFT_Plan_Destroy(inv_plan);
+}
+/*  End of rssringoccs_Diffraction_Correction_BlockFFT.                       */
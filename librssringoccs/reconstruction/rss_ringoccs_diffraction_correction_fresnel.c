@@ -188,33 +188,12 @@
 #include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
-/******************************************************************************
- *  Function:                                                                 *
- *      DiffractionCorrectionFresnel                                          *
- *  Purpose:                                                                  *
- *      Compute the Fresnel transform using the classic Fresnel quadratic     *
- *      approximation to the Fresnel kernel.                                  *
- *  Arguments:                                                                *
- *      dlp (DLPObj *):                                                       *
- *          An instance of the DLPObj structure defined in                    *
- *          rss_ringoccs_diffraction_correction.h. This contains all of the   *
- *          necessary data for diffraction correction, including the geometry *
- *          of the occultation and actual power and phase data.               *
- *  Output:                                                                   *
- *      Nothing (void):                                                       *
- *          This is a void function, so no actual output is provided. However *
- *          the T_out pointer within the dlp structure will be changed at the *
- *          end, containing the diffraction corrected data.                   *
- *  Notes:                                                                    *
- *      1.) This code uses the Fresnel approximation which has been known to  *
- *          fail for several different occultations, especially ones of very  *
- *          low angle (small B values). Take this into consideration when     *
- *          performing any analysis.                                          *
- *      2.) While this may be inaccurate for certain occultations, it is      *
- *          immensely fast, capable of processing the entire Rev007 E         *
- *          occultation accurately in less than a second at 1km resolution.   *
- ******************************************************************************/
-RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Fresnel(rssringoccs_TAUObj *tau)
+/*  Computes the Fresnel transform at count points starting at first. This    *
+ *  may be called from several threads at once, so all scratch memory is      *
+ *  allocated here and only T_out[first] to T_out[first+count-1] is written.  */
+static rssringoccs_Bool
+__fresnel_range(rssringoccs_TAUObj *tau, unsigned long first,
+                unsigned long count, unsigned long w_center)
 {
     /*  m and n used for indexing, nw_pts is number of points in window.      */
     unsigned long m, n, nw_pts, center;
@@ -224,147 +203,151 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Fresnel(rssringoccs_
 
     /*  Pointers for the independent variable and the window function.        */
     double *x_arr;
-    double *w_func;
-    double fwd_factor;
+    const double *w_func;
+    double *w_buffer;
+    double *tmp;
 
-    /*  Declare the window function pointer and allocate memory for it. The   *
-     *  type rssringoccs_window_func was declared at the start of this file.  *
-     *  Be sure to free this at the end!                                      */
+    /*  Declare the window function pointer and the Fresnel transform.        */
     rssringoccs_window_func fw = tau->window_func;
-    void (*FresT)(rssringoccs_TAUObj *, double *, double *,
+    void (*FresT)(rssringoccs_TAUObj *, double *, const double *,
                   unsigned long, unsigned long);
 
-    /*  This should remain at false.                                          */
-    tau->error_occurred = rssringoccs_False;
-
     if (tau->use_norm)
         FresT = Fresnel_Transform_Norm_Double;
     else
         FresT = Fresnel_Transform_Double;
 
-    if (tau->use_fwd)
-        fwd_factor = -1.0;
-    else
-        fwd_factor = 1.0;
-
-    /*  Check that the pointers to the data are not NULL.                     */
-    rssringoccs_Tau_Check_Data(tau);
-    if (tau->error_occurred)
-        return;
-
-    /*  Retrieve the starting point from the TAUObj instance.                 */
-    center = tau->start;
-
-    /*  Compute some extra necessary variables. At this point it is assumed   *
-     *  that tau->w_km_vals, tau->rho_km_vals, and others are pointers, most  *
-     *  likely created with malloc or calloc, that point to a memory block    *
-     *  that is tau->arr_size in size, that tau->start >= 0, and that         *
-     *  tau->start+tau->n_used <= tau->arr_size. No error checks for this     *
-     *  are performed here, but rather the caller of this function has that   *
-     *  responsibility. Such checks are performed in the                      *
-     *  DiffractionCorrection Python class, so if you're only using that then *
-     *  there's no problem. If not, this next step may cause a segmentation   *
-     *  fault.                                                                */
-    w_init = tau->w_km_vals[center];
-
-    /*  It is also assumed these pointers have at least two elements of       *
-     *  doubles being pointed to. Again, DiffractionCorrection checks this.   *
-     *  Hence dlp->rho_km_vals[center] and dlp->rho_km_vals[center+1] should  *
-     *  be initialized. If not, you will get a segmentation fault.            */
-    dx = tau->dx_km;
-
-    /*  And now, some more variables we'll be using.                          */
+    /*  The window function in effect at first was computed at w_center.      */
+    w_init = tau->w_km_vals[w_center];
+    dx     = tau->dx_km;
     two_dx = 2.0*dx;
     nw_pts = ((long)(w_init / two_dx)) + 1;
 
-    /* Check to ensure you have enough data to the left.                      */
-    rssringoccs_Tau_Check_Data_Range(tau);
-    if (tau->error_occurred)
-        return;
-
-    /*  Reserve some memory for two arrays, the ring radius and the window    *
-     *  function. This will need to be reallocated later if the window width  *
-     *  changes by more than two_dx. Per C99 recommendations, we do not cast  *
-     *  malloc since void will safely be promoted to a double pointer.        */
-    x_arr  = (double *)malloc(sizeof(*x_arr)  * nw_pts);
-    w_func = (double *)malloc(sizeof(*w_func) * nw_pts);
-
-    /*  Check that malloc was successfull then pass the x_arr array           *
-     *  (ring radius) to the void function reset_window. This alters x_arr so *
-     *  that it's values range from -W/2 to zero, W begin the window width.   */
-    if (!(x_arr))
-    {
-        tau->error_occurred = rssringoccs_True;
-        tau->error_message = rssringoccs_strdup(
-            "\n\rError Encountered: rss_ringoccs\n\n"
-            "\r\tDiffractionCorrectionFresnel\n\n"
-            "\rMalloc failed and returned NULL for x_arr. Returning.\n\n"
-        );
-        return;
-    }
+    /*  Reserve some memory for the ring radius. This will need to be         *
+     *  reallocated later if the window width changes by more than two_dx.    */
+    x_arr = (double *)malloc(sizeof(*x_arr) * nw_pts);
+    if (x_arr == NULL)
+        return rssringoccs_False;
 
-    if (!(w_func))
+    /*  The left half of the window of 2*nw_pts - 1 points, from the cache.   */
+    w_buffer = NULL;
+    w_func = rssringoccs_Window_Cache_Get(fw, 2*nw_pts - 1, &w_buffer);
+    if (w_func == NULL)
     {
-        tau->error_occurred = rssringoccs_True;
-        tau->error_message = rssringoccs_strdup(
-            "\n\rError Encountered: rss_ringoccs\n\n"
-            "\r\tDiffractionCorrectionFresnel\n\n"
-            "\rMalloc failed and returned NULL for w_func. Returning.\n\n"
-        );
-        return;
+        free(x_arr);
+        return rssringoccs_False;
     }
 
-    rssringoccs_Tau_Reset_Window(x_arr, w_func, dx, w_init, nw_pts, fw);
-
-    /* Compute Window Functions, and compute pi/2 * x^2                       */
+    /*  Set x_arr so that its values range from -W/2 to zero, W being the     *
+     *  window width, and compute pi/2 * x^2.                                 */
     for(m=0; m<nw_pts; ++m)
     {
+        x_arr[m] = ((double)m - (double)nw_pts)*dx;
+
         /*  The independent variable is pi/2 * ((rho-rho0)/F)^2. Compute      *
          *  part of this. The 1/F^2 part is introduced later.                 */
         x_arr[m] *= rssringoccs_Pi_By_Two*x_arr[m];
-
-        /*  Use the fwd_factor to computer forward or inverse transform.      */
-        x_arr[m] *= fwd_factor;
     }
 
-    /*  Compute the Fresnel transform across the input data.              */
-    for (m=0; m<=tau->n_used; ++m)
+    /*  Compute the Fresnel transform across the input data.                  */
+    center = first;
+    for (m=0; m<count; ++m)
     {
-        /*  If the window width has deviated more the 2*dx, reset         *
-         *  variables. fabs is the absolute value function for double     *
-         *  precision variables and is defined in the built-in math.h.    */
+        /*  If the window width has deviated more the 2*dx, reset             *
+         *  variables. fabs is the absolute value function for double         *
+         *  precision variables and is defined in the built-in math.h.        */
         if (fabs(w_init - tau->w_km_vals[center]) >= two_dx)
         {
-            /* Reset w_init and recompute window function.                */
+            /* Reset w_init and get the window function for the new size.     */
             w_init = tau->w_km_vals[center];
             nw_pts = ((long)(w_init / two_dx))+1;
 
-            /*  Reallocate memory, since the sizes of the arrays changed. */
-            w_func = (double *)realloc(w_func, sizeof(double)*nw_pts);
-            x_arr  = (double *)realloc(x_arr, sizeof(double)*nw_pts);
+            w_func = rssringoccs_Window_Cache_Get(fw, 2*nw_pts - 1, &w_buffer);
 
-            /*  Reset the x_arr array to range between -W/2 and zero.     */
-            rssringoccs_Tau_Reset_Window(x_arr, w_func, dx,
-                                         w_init, nw_pts, fw);
+            /*  Reallocate memory, since the size of x_arr changed.           */
+            tmp = (double *)realloc(x_arr, sizeof(*x_arr)*nw_pts);
+            if (tmp != NULL)
+                x_arr = tmp;
 
-            /* Compute Window Functions, and compute pi/2 * x^2.          */
+            if ((tmp == NULL) || (w_func == NULL))
+            {
+                free(w_buffer);
+                free(x_arr);
+                return rssringoccs_False;
+            }
+
+            /*  Reset the x_arr array to range between -W/2 and zero.         */
             for(n=0; n<nw_pts; ++n)
             {
+                x_arr[n] = ((double)n - (double)nw_pts)*dx;
                 x_arr[n] *= rssringoccs_Pi_By_Two*x_arr[n];
-
-                /*  Again, if forward calculation is set, negate x_arr.   */
-                x_arr[n] *= fwd_factor;
             }
         }
 
-        /*  Compute the Fresnel Transform about the current point.        */
+        /*  Compute the Fresnel Transform about the current point.            */
         FresT(tau, x_arr, w_func, nw_pts, center);
 
-        /*  Move the pointers to the next point.                          */
+        /*  Move the pointers to the next point.                              */
         center += 1;
     }
 
     /*  Free the variables allocated by malloc.                               */
     free(x_arr);
-    free(w_func);
+    free(w_buffer);
+    return rssringoccs_True;
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      DiffractionCorrectionFresnel                                          *
+ *  Purpose:                                                                  *
+ *      Compute the Fresnel transform using the classic Fresnel quadratic     *
+ *      approximation to the Fresnel kernel.                                  *
+ *  Arguments:                                                                *
+ *      dlp (DLPObj *):                                                       *
+ *          An instance of the DLPObj structure defined in                    *
+ *          rss_ringoccs_diffraction_correction.h. This contains all of the   *
+ *          necessary data for diffraction correction, including the geometry *
+ *          of the occultation and actual power and phase data.               *
+ *  Output:                                                                   *
+ *      Nothing (void):                                                       *
+ *          This is a void function, so no actual output is provided. However *
+ *          the T_out pointer within the dlp structure will be changed at the *
+ *          end, containing the diffraction corrected data.                   *
+ *  Notes:                                                                    *
+ *      1.) This code uses the Fresnel approximation which has been known to  *
+ *          fail for several different occultations, especially ones of very  *
+ *          low angle (small B values). Take this into consideration when     *
+ *          performing any analysis.                                          *
+ *      2.) While this may be inaccurate for certain occultations, it is      *
+ *          immensely fast, capable of processing the entire Rev007 E         *
+ *          occultation accurately in less than a second at 1km resolution.   *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Fresnel(rssringoccs_TAUObj *tau)
+{
+    /*  This should remain at false.                                          */
+    tau->error_occurred = rssringoccs_False;
+
+    /*  Check that the pointers to the data are not NULL.                     */
+    rssringoccs_Tau_Check_Data(tau);
+    if (tau->error_occurred)
+        return;
+
+    /*  It is assumed that tau->w_km_vals, tau->rho_km_vals, and others are   *
+     *  pointers, most likely created with malloc or calloc, that point to a  *
+     *  memory block that is tau->arr_size in size, that tau->start >= 0, and *
+     *  that tau->start+tau->n_used <= tau->arr_size. No error checks for     *
+     *  this are performed here, but rather the caller of this function has   *
+     *  that responsibility. Such checks are performed in the                 *
+     *  DiffractionCorrection Python class, so if you're only using that then *
+     *  there's no problem. If not, this next step may cause a segmentation   *
+     *  fault. Check to ensure you have enough data to the left.              */
+    rssringoccs_Tau_Check_Data_Range(tau);
+    if (tau->error_occurred)
+        return;
+
+    /*  Compute the Fresnel transform across the input data, splitting the    *
+     *  points across tau->num_threads threads.                               */
+    rssringoccs_Tau_Run_Range(tau, __fresnel_range, tau->n_used + 1,
+                              2.0*tau->dx_km);
 }
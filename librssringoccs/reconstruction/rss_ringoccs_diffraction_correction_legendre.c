@@ -5,40 +5,129 @@
 #include <rss_ringoccs/include/rss_ringoccs_special_functions.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
-/******************************************************************************
- *  Function:                                                                 *
- *      rssringoccs_Diffraction_Correction_Legendre                           *
- *  Purpose:                                                                  *
- *      Compute the Fresnel transform using Legendre polynomials to           *
- *      approximate the fresnel kernel.                                       *
- *  Arguments:                                                                *
- *      dlp (DLPObj *):                                                       *
- *          An instance of the DLPObj structure defined in                    *
- *          _diffraction_correction.h. This contains all of the necessary     *
- *          data for diffraction correction, including the geometry of the    *
- *          occultation and actual power and phase data.                      *
- *  Output:                                                                   *
- *      Nothing (void):                                                       *
- *          This is a void function, so no actual output is provided. However *
- *          the T_out pointer within the dlp structure will be changed at the *
- *          end, containing the diffraction correction data.                  *
- *  Notes:                                                                    *
- *      1.) This routine allows for any selection of polynomial of degree     *
- *          greater than or equal to 2, though for degree 2 it is better to   *
- *          use the Fresnel option since the symmetry nearly doubles the      *
- *          speed of the computation. For anything higher than degree 8 there *
- *          is no real change in the accuracy, even for low inclination       *
- *          occultation observations.                                         *
- *      2.) Like the Fresnel approximation, the Legendre approximation has    *
- *          issues reconstructing data at low B angles. This is because the   *
- *          Legendre approximation assumes the first iteration of the Newton  *
- *          Raphson method is good enough, whereas in reality 3-4 iterations  *
- *          may be needed, like in Rev133.                                    *
- ******************************************************************************/
-RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Legendre(rssringoccs_TAUObj *tau)
+/*  Computes the coefficients of the Legendre expansion of psi at center.     */
+static void
+__legendre_coeffs(rssringoccs_TAUObj *tau, unsigned long center,
+                  unsigned char poly_order, double *legendre_p,
+                  double *alt_legendre_p, double *coeffs)
 {
-    /*  i is used for indexing, nw_pts is the number of points in the window. */
-    unsigned long i, nw_pts, center;
+    double cosb, cosp, sinp, Legendre_Coeff;
+
+    /*  Compute some geometric information, and the scaling coefficient for   *
+     *  the Legendre polynomial expansion.                                    */
+    cosb            = cos(tau->B_rad_vals[center]);
+    cosp            = cos(tau->phi_rad_vals[center]);
+    sinp            = sin(tau->phi_rad_vals[center]);
+    Legendre_Coeff  = cosb*sinp;
+    Legendre_Coeff *= Legendre_Coeff;
+    Legendre_Coeff  = 0.5*Legendre_Coeff/(1.0-Legendre_Coeff);
+
+    /* Compute Legendre Polynomials,                                          */
+    rssringoccs_Legendre_Polynomials(legendre_p, cosb*cosp, poly_order+1);
+    rssringoccs_Alt_Legendre_Polynomials(alt_legendre_p,
+                                         legendre_p, poly_order);
+
+    /*  Compute the coefficients using Cauchy Products. First compute the     *
+     *  bottom triangle of the square in the product.                         */
+    rssringoccs_Fresnel_Kernel_Coefficients(coeffs, legendre_p,
+                                            alt_legendre_p, Legendre_Coeff,
+                                            poly_order);
+}
+
+/*  Fills rows a+1 to b-1 of the table with the coefficients between the      *
+ *  points a and b, where rows a and b are already computed. The table holds  *
+ *  poly_order coefficients per point, with row 0 at the point base. Returns  *
+ *  an estimate of the error in psi, in radians, of the interpolated rows,    *
+ *  taken from the midpoints only. It is not a bound.                         */
+static double
+__legendre_interval(rssringoccs_TAUObj *tau, unsigned long base,
+                    unsigned long a, unsigned long b, unsigned char poly_order,
+                    double *legendre_p, double *alt_legendre_p, double *table)
+{
+    unsigned long mid, j;
+    unsigned char n;
+    double *c_a, *c_b, *c_mid, *c_j;
+    double t, ratio, ratio_pow, kD, err, err_right;
+
+    if (b - a < 2)
+        return 0.0;
+
+    mid   = a + (b - a)/2;
+    c_a   = table + (a - base)*poly_order;
+    c_b   = table + (b - base)*poly_order;
+    c_mid = table + (mid - base)*poly_order;
+    __legendre_coeffs(tau, mid, poly_order, legendre_p, alt_legendre_p, c_mid);
+
+    /*  A tolerance of zero means every point is computed exactly.            */
+    if (tau->legendre_tol > 0.0)
+    {
+        /*  The n-th coefficient multiplies (x/D)^(n+2), and |x| <= W/2.      *
+         *  Estimate the error in psi at mid made by interpolating from a and *
+         *  b, at the edge of the window.                                     */
+        t         = (double)(mid - a) / (double)(b - a);
+        ratio     = 0.5*tau->w_km_vals[mid] / tau->D_km_vals[mid];
+        ratio_pow = ratio*ratio;
+        kD        = fabs(tau->k_vals[mid]*tau->D_km_vals[mid]);
+        err       = 0.0;
+
+        for (n = 0; n < poly_order; ++n)
+        {
+            err += fabs(c_a[n] + t*(c_b[n] - c_a[n]) - c_mid[n]) * ratio_pow;
+            ratio_pow *= ratio;
+        }
+        err *= kD;
+
+        /*  err is the residual at mid, the point furthest from a and b, so   *
+         *  it estimates the largest error between them. The coefficients are *
+         *  then interpolated from a, mid, and b, which for smooth geometry   *
+         *  is about four times better than from a and b alone. A sharp       *
+         *  change between the sampled points is not seen.                    */
+        if (err <= tau->legendre_tol)
+        {
+            for (j = a + 1; j < b; ++j)
+            {
+                if (j == mid)
+                    continue;
+
+                c_j = table + (j - base)*poly_order;
+                if (j < mid)
+                {
+                    t = (double)(j - a) / (double)(mid - a);
+                    for (n = 0; n < poly_order; ++n)
+                        c_j[n] = c_a[n] + t*(c_mid[n] - c_a[n]);
+                }
+                else
+                {
+                    t = (double)(j - mid) / (double)(b - mid);
+                    for (n = 0; n < poly_order; ++n)
+                        c_j[n] = c_mid[n] + t*(c_b[n] - c_mid[n]);
+                }
+            }
+            return err;
+        }
+    }
+
+    /*  The geometry changes too quickly. Split the interval in two.          */
+    err = __legendre_interval(tau, base, a, mid, poly_order,
+                              legendre_p, alt_legendre_p, table);
+    err_right = __legendre_interval(tau, base, mid, b, poly_order,
+                                    legendre_p, alt_legendre_p, table);
+
+    if (err_right > err)
+        return err_right;
+    else
+        return err;
+}
+
+/*  Computes the Legendre reconstruction at count points starting at first.   *
+ *  This may be called from several threads at once, so all scratch memory    *
+ *  is allocated here and only T_out at the given indices is written.         */
+static rssringoccs_Bool
+__legendre_range(rssringoccs_TAUObj *tau, unsigned long first,
+                 unsigned long count, unsigned long w_center)
+{
+    /*  i and j are for indexing, nw_pts is the number of points in window.   */
+    unsigned long i, j, nw_pts, center;
 
     /*  Variable for the number of Legendre coefficients to be computed.      */
     unsigned char poly_order;
@@ -46,24 +135,21 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Legendre(rssringoccs
     /*  IsEven is a boolean for determining the parity of the polynomial.     */
     rssringoccs_Bool IsEven;
 
+    /*  The block of points whose coefficients are in coeff_table.            */
+    unsigned long blk_start, blk_last, data_end;
+
     /*  Various other variables needed throughout.                            */
-    double w_init, dx, two_dx, cosb, sinp, cosp, Legendre_Coeff;
-    double *x_arr, *w_func, *legendre_p, *alt_legendre_p, *fresnel_ker_coeffs;
+    double w_init, dx, two_dx, err, max_err;
+    double *x_arr, *w_buffer, *legendre_p, *alt_legendre_p, *coeff_table;
+    const double *w_func;
+    double *tmp;
 
     /*  Create function pointers for window function and Fresnel transform.   */
     rssringoccs_window_func fw = tau->window_func;
 
-    void (*FresT)(rssringoccs_TAUObj *, double *, double *, double *,
+    void (*FresT)(rssringoccs_TAUObj *, double *, const double *, double *,
                   unsigned long, unsigned long);
 
-    /*  This should remain at false.                                          */
-    tau->error_occurred = rssringoccs_False;
-
-    /*  Check that the pointers to the data are not NULL.                     */
-    rssringoccs_Tau_Check_Data(tau);
-    if (tau->error_occurred)
-        return;
-
     /*  Set the IsEven boolean to the appropriate value. Since the linear and *
      *  constant term are zero, even polynomials will have an odd number of   *
      *  terms. For example, the quartic expansion has the quadratic, cubic,   *
@@ -96,102 +182,196 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Legendre(rssringoccs
             FresT = Fresnel_Transform_Legendre_Odd_Double;
     }
 
-    /* Compute first window width and window function. */
-    center = tau->start;
-
-    /*  If forward tranform is set, negate the k_vals variable. This has      *
-     *  the equivalent effect of computing the forward calculation later.     */
-    if (tau->use_fwd)
-    {
-        /*  Loop over all of k_vals and negate the value.                     */
-        for (i=0; i <= tau->n_used; ++i)
-            tau->k_vals[i] *= -1.0;
-    }
-
-    /*  Compute more necessary data.                                          */
-    w_init = tau->w_km_vals[center];
-    dx     = tau->rho_km_vals[center+1] - tau->rho_km_vals[center];
+    /*  The sample spacing is taken from the start of the data, and the       *
+     *  window function in effect at first was computed at w_center.          */
+    w_init = tau->w_km_vals[w_center];
+    dx     = tau->rho_km_vals[tau->start+1] - tau->rho_km_vals[tau->start];
     two_dx = 2.0*dx;
     nw_pts = (long)(w_init / two_dx)+1;
 
-    /* Check to ensure you have enough data to the left.                      */
-    rssringoccs_Tau_Check_Data_Range(tau);
-    if (tau->error_occurred)
-        return;
-
-    /*  Allocate memory for the independent variable and window function.     */
-    x_arr  = (double *)malloc(sizeof(*x_arr)*nw_pts);
-    w_func = (double *)malloc(sizeof(*w_func)*nw_pts);
+    /*  Allocate memory for the independent variable. The window function is  *
+     *  the left half of the cached window of 2*nw_pts - 1 points.            */
+    x_arr    = (double *)malloc(sizeof(*x_arr)*nw_pts);
+    w_buffer = NULL;
+    w_func   = rssringoccs_Window_Cache_Get(fw, 2*nw_pts - 1, &w_buffer);
 
     /*  Also for the two Legendre polynomials.                                */
     legendre_p     = (double *)malloc(sizeof(*legendre_p)*(poly_order+1));
     alt_legendre_p = (double *)malloc(sizeof(*alt_legendre_p)*poly_order);
 
-    /*  And finally for the coefficients of psi.                              */
-    fresnel_ker_coeffs = (double *)malloc(sizeof(*fresnel_ker_coeffs)*poly_order);
+    /*  And finally for the coefficients of psi, for a block of points.       */
+    coeff_table = (double *)malloc(sizeof(*coeff_table) * poly_order *
+                                   RSSRINGOCCS_TAU_BLOCK_LENGTH);
 
-    /*  Check that malloc was successfull then pass the x_arr array           *
-     *  (ring radius) to the void function reset_window. This alters x_arr so *
-     *  that it's values range from -W/2 to zero, W being the window width.   */
+    /*  Check that malloc was successfull then set the x_arr array (ring      *
+     *  radius) so that it's values range from -W/2 to zero, W being the      *
+     *  window width.                                                         */
     if (!(x_arr)    ||    !(w_func)            ||    !(legendre_p)
-                    ||    !(alt_legendre_p)    ||    !(fresnel_ker_coeffs))
+                    ||    !(alt_legendre_p)    ||    !(coeff_table))
     {
-        /*  Malloc failed, return to calling function.                        */
-        tau->error_occurred = rssringoccs_True;
-        return;
+        /*  Malloc failed, free what we have and return.                      */
+        free(x_arr);
+        free(w_buffer);
+        free(legendre_p);
+        free(alt_legendre_p);
+        free(coeff_table);
+        return rssringoccs_False;
     }
     else
-        rssringoccs_Tau_Reset_Window(x_arr, w_func, dx, w_init, nw_pts, fw);
+    {
+        for (i = 0; i < nw_pts; ++i)
+            x_arr[i] = ((double)i - (double)nw_pts)*dx;
+    }
 
     /* Loop through each point and begin the reconstruction.                  */
-    for (i = 0; i < tau->n_used; ++i)
+    center    = first;
+    data_end  = tau->start + tau->n_used;
+    blk_start = first;
+    max_err   = 0.0;
+    for (i = 0; i < count; ++i)
     {
-        /*  Compute some geometric information, and the scaling coefficient   *
-         *  for the Legendre polynomial expansion.                            */
-        cosb            = cos(tau->B_rad_vals[center]);
-        cosp            = cos(tau->phi_rad_vals[center]);
-        sinp            = sin(tau->phi_rad_vals[center]);
-        Legendre_Coeff  = cosb*sinp;
-        Legendre_Coeff *= Legendre_Coeff;
-        Legendre_Coeff  = 0.5*Legendre_Coeff/(1.0-Legendre_Coeff);
-
-        /* Compute Legendre Polynomials,                                      */
-        rssringoccs_Legendre_Polynomials(legendre_p, cosb*cosp, poly_order+1);
-        rssringoccs_Alt_Legendre_Polynomials(alt_legendre_p,
-                                             legendre_p, poly_order);
-
-        /*  Compute the coefficients using Cauchy Products. First compute     *
-         *  the bottom triangle of the square in the product.                 */
-        rssringoccs_Fresnel_Kernel_Coefficients(fresnel_ker_coeffs, legendre_p,
-                                                alt_legendre_p, Legendre_Coeff,
-                                                poly_order);
-
-        /*  If the window width changes significantly, recompute w_func.      */
+        /*  The coefficients are found a block of points at a time. Blocks    *
+         *  start at multiples of RSSRINGOCCS_TAU_BLOCK_LENGTH from           *
+         *  tau->start, so the result does not depend on the thread count.    */
+        if ((i == 0) ||
+            ((center - tau->start) % RSSRINGOCCS_TAU_BLOCK_LENGTH == 0))
+        {
+            blk_start = center - (center-tau->start) %
+                                 RSSRINGOCCS_TAU_BLOCK_LENGTH;
+            blk_last  = blk_start + RSSRINGOCCS_TAU_BLOCK_LENGTH - 1;
+            if (blk_last >= data_end)
+                blk_last = data_end - 1;
+
+            /*  The ends are computed exactly, and the rest interpolated      *
+             *  where the geometry allows it.                                 */
+            __legendre_coeffs(tau, blk_start, poly_order, legendre_p,
+                              alt_legendre_p, coeff_table);
+            __legendre_coeffs(tau, blk_last, poly_order, legendre_p,
+                              alt_legendre_p,
+                              coeff_table + (blk_last-blk_start)*poly_order);
+            err = __legendre_interval(tau, blk_start, blk_start, blk_last,
+                                      poly_order, legendre_p, alt_legendre_p,
+                                      coeff_table);
+
+            if (err > max_err)
+                max_err = err;
+        }
+
+        /*  If the window width changes significantly, get the new w_func.    */
         if (fabs(w_init - tau->w_km_vals[center]) >= two_dx)
         {
-            /* Reset w_init and recompute window function.                    */
+            /* Reset w_init and get the window function for the new size.     */
             w_init = tau->w_km_vals[center];
             nw_pts = ((long)(w_init / two_dx))+1;
+            w_func = rssringoccs_Window_Cache_Get(fw, 2*nw_pts - 1, &w_buffer);
+
+            /*  Reallocate x_arr since the size changed.                      */
+            tmp = (double *)realloc(x_arr, sizeof(*x_arr)*nw_pts);
+            if (tmp != NULL)
+                x_arr = tmp;
 
-            /*  Reallocate x_arr and w_func since the sizes changed.          */
-            x_arr  = (double *)realloc(x_arr, sizeof(double)*nw_pts);
-            w_func = (double *)realloc(w_func, sizeof(double)*nw_pts);
+            if ((tmp == NULL) || (w_func == NULL))
+            {
+                free(x_arr);
+                free(w_buffer);
+                free(legendre_p);
+                free(alt_legendre_p);
+                free(coeff_table);
+                return rssringoccs_False;
+            }
 
-            /*  Recompute x_arr and w_func for the new sizes.                 */
-            rssringoccs_Tau_Reset_Window(x_arr, w_func, dx, w_init, nw_pts, fw);
+            /*  Recompute x_arr for the new size.                             */
+            for (j = 0; j < nw_pts; ++j)
+                x_arr[j] = ((double)j - (double)nw_pts)*dx;
         }
 
         /*  Compute the fresnel tranform about the current point.             */
-        FresT(tau, x_arr, w_func, fresnel_ker_coeffs, nw_pts, center);
+        FresT(tau, x_arr, w_func,
+              coeff_table + (center - blk_start)*poly_order, nw_pts, center);
 
         /*  Increment T_in pointer using pointer arithmetic.                  */
         center += 1;
     }
 
+    /*  Record the largest error from interpolating the coefficients.         */
+#ifdef _OPENMP
+#pragma omp critical (rssringoccs_legendre_err)
+#endif
+    {
+        if (max_err > tau->legendre_err)
+            tau->legendre_err = max_err;
+    }
+
     /*  Free all variables allocated by malloc.                               */
     free(x_arr);
-    free(w_func);
+    free(w_buffer);
     free(legendre_p);
     free(alt_legendre_p);
-    free(fresnel_ker_coeffs);
+    free(coeff_table);
+    return rssringoccs_True;
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rssringoccs_Diffraction_Correction_Legendre                           *
+ *  Purpose:                                                                  *
+ *      Compute the Fresnel transform using Legendre polynomials to           *
+ *      approximate the fresnel kernel.                                       *
+ *  Arguments:                                                                *
+ *      dlp (DLPObj *):                                                       *
+ *          An instance of the DLPObj structure defined in                    *
+ *          _diffraction_correction.h. This contains all of the necessary     *
+ *          data for diffraction correction, including the geometry of the    *
+ *          occultation and actual power and phase data.                      *
+ *  Output:                                                                   *
+ *      Nothing (void):                                                       *
+ *          This is a void function, so no actual output is provided. However *
+ *          the T_out pointer within the dlp structure will be changed at the *
+ *          end, containing the diffraction correction data.                  *
+ *  Notes:                                                                    *
+ *      1.) This routine allows for any selection of polynomial of degree     *
+ *          greater than or equal to 2, though for degree 2 it is better to   *
+ *          use the Fresnel option since the symmetry nearly doubles the      *
+ *          speed of the computation. For anything higher than degree 8 there *
+ *          is no real change in the accuracy, even for low inclination       *
+ *          occultation observations.                                         *
+ *      2.) Like the Fresnel approximation, the Legendre approximation has    *
+ *          issues reconstructing data at low B angles. This is because the   *
+ *          Legendre approximation assumes the first iteration of the Newton  *
+ *          Raphson method is good enough, whereas in reality 3-4 iterations  *
+ *          may be needed, like in Rev133.                                    *
+ *      3.) The coefficients of the expansion depend only on B and phi, which *
+ *          change slowly. If tau->legendre_tol is positive, in each block of *
+ *          RSSRINGOCCS_TAU_BLOCK_LENGTH points they are computed at the ends *
+ *          and at the midpoint, and the rest are interpolated if the error   *
+ *          in psi at the edge of the window, estimated from the midpoint, is *
+ *          less than tau->legendre_tol radians. Otherwise the block is split *
+ *          in two and each half is tried again. The largest estimate is      *
+ *          stored in tau->legendre_err. It is an estimate, not a bound. The  *
+ *          default tolerance of zero computes every point exactly.           *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Legendre(rssringoccs_TAUObj *tau)
+{
+    /*  The sample spacing.                                                   */
+    double two_dx;
+
+    /*  This should remain at false.                                          */
+    tau->error_occurred = rssringoccs_False;
+
+    /*  Check that the pointers to the data are not NULL.                     */
+    rssringoccs_Tau_Check_Data(tau);
+    if (tau->error_occurred)
+        return;
+
+    /* Check to ensure you have enough data to the left.                      */
+    rssringoccs_Tau_Check_Data_Range(tau);
+    if (tau->error_occurred)
+        return;
+
+    /*  Compute the reconstruction across the input data, splitting the       *
+     *  points across tau->num_threads threads.                               */
+    two_dx = tau->rho_km_vals[tau->start+1] - tau->rho_km_vals[tau->start];
+    two_dx *= 2.0;
+    tau->legendre_err = 0.0;
+    rssringoccs_Tau_Run_Range(tau, __legendre_range, tau->n_used, two_dx);
 }
@@ -4,68 +4,32 @@
 #include <rss_ringoccs/include/rss_ringoccs_fresnel_transform.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
-/******************************************************************************
- *  Function:                                                                 *
- *      DiffractionCorrectionNewton                                           *
- *  Purpose:                                                                  *
- *      Compute the Fresnel transform using the Newton-Raphson method to      *
- *      compute the stationary value of the Fresnel-Kernel.                   *
- *  Arguments:                                                                *
- *      dlp (DLPObj *):                                                       *
- *          An instance of the DLPObj structure defined in                    *
- *          _diffraction_correction.h. This contains all of the necessary     *
- *          data for diffraction correction, including the geometry of the    *
- *          occultation and actual power and phase data.                      *
- *  Output:                                                                   *
- *      Nothing (void):                                                       *
- *          This is a void function, so no actual output is provided. However *
- *          the T_out pointer within the dlp structure will be changed at the *
- *          end, containing the diffraction correction data.                  *
- *  Notes:                                                                    *
- *      1.) This method is the most accurate, but much slower than the        *
- *          Fresnel and Legendre options. It is accurate for every Rev of the *
- *          Cassini mission with the exception of the Rev133 occultation      *
- *          of which only the Ka band produces accurate results. For X and S  *
- *          bands one needs to use the Perturbed Newton method.               *
- *      2.) The polynomials from the MTR86 are available via the dlp.interp   *
- *          variable. These polynomials are slower and less accurate than the *
- *          normal Newton method since to compute the polynomials the         *
- *          Newton-Raphson method must be performed, and hence the            *
- *          polynomials increase the number of computations needed. The real  *
- *          use of them arises if one uses FFT methods. This routine does NOT *
- *          use FFTs, but rather ordinary integration.                        *
- ******************************************************************************/
-RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Newton(rssringoccs_TAUObj *tau)
+/*  Computes the Newton-Raphson reconstruction at count points starting at    *
+ *  first. This may be called from several threads at once, so all scratch    *
+ *  memory is allocated here and only T_out at the given indices is written.  */
+static rssringoccs_Bool
+__newton_range(rssringoccs_TAUObj *tau, unsigned long first,
+               unsigned long count, unsigned long w_center)
 {
     /*  Variables for indexing. nw_pts is the number of points in the window. */
-    unsigned long i, j, offset, nw_pts, center;
+    unsigned long i, j, nw_pts, center;
+
+    /*  Indices of the first point held in phi_warm and one past the last,    *
+     *  the end of a block's reset, and the largest half window in the range. */
+    unsigned long warm_first, warm_end, warm_last, max_half, half;
 
     /*  Some variables needed for reconstruction.                             */
     double w_init, dx, two_dx;
-    double *w_func;
-
-    /*  Declare a function pointer for the transform function.                */
-    rssringoccs_FresT FresT;
-
-    /*  Check that the pointers to the data are not NULL.                     */
-    rssringoccs_Tau_Check_Data(tau);
-    if (tau->error_occurred)
-        return;
+    const double *w_func;
+    double *w_buffer;
 
-    /* Compute first window width and window function. */
-    center = tau->start;
-
-    /*  Compute some more variables.                                          */
-    w_init = tau->w_km_vals[center];
-    dx     = tau->rho_km_vals[center+1] - tau->rho_km_vals[center];
-    two_dx = 2.0*dx;
-    nw_pts = 2*((long)(w_init / two_dx))+1;
-    offset = center - (long)((nw_pts-1)/2);
+    /*  Stationary azimuth angles from the previous center, for warm starts.  */
+    double *phi_warm;
 
-    /* Check to ensure you have enough data to the left.                      */
-    rssringoccs_Tau_Check_Data_Range(tau);
-    if (tau->error_occurred)
-        return;
+    /*  Declare function pointers for the transform functions.                */
+    rssringoccs_FresT FresT;
+    void (*WarmT)(rssringoccs_TAUObj *, const double *, unsigned long,
+                  unsigned long, double *);
 
     /*  Set the correct function pointer.                                     */
     if (tau->use_norm)
@@ -115,58 +79,175 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Newton(rssringoccs_T
             FresT = Fresnel_Transform_Newton_D_Old_Double;
     }
 
-    /*  Allocate memory for these required variables.                         */
-    w_func = (double *)malloc(sizeof(*w_func) * nw_pts);
+    /*  The sample spacing is taken from the start of the data, and the       *
+     *  window function in effect at first was computed at w_center.          */
+    w_init = tau->w_km_vals[w_center];
+    dx     = tau->rho_km_vals[tau->start+1] - tau->rho_km_vals[tau->start];
+    two_dx = 2.0*dx;
+    nw_pts = 2*((long)(w_init / two_dx))+1;
 
-    if (!(w_func))
+    /*  Get the window function from the cache. Entry 0 of the cached array   *
+     *  is the point left of the window, which Newton-Raphson does not use.   */
+    w_buffer = NULL;
+    w_func = rssringoccs_Window_Cache_Get(tau->window_func, nw_pts, &w_buffer);
+    if (w_func == NULL)
+        return rssringoccs_False;
+
+    /*  Warm starts are supported for the plain Newton-Raphson method. The    *
+     *  stationary value of phi for a point of the window is kept between     *
+     *  centers, indexed by the point, so phi_warm must hold every point any  *
+     *  window in the range reaches. Every RSSRINGOCCS_TAU_BLOCK_LENGTH       *
+     *  points the values are reset to phi0, same as for points not yet       *
+     *  seen, so the output does not depend on how the range is split.        */
+    phi_warm   = NULL;
+    warm_first = 0;
+    warm_end   = 0;
+    max_half   = 0;
+    WarmT      = NULL;
+
+    if ((tau->use_warm_start) && (tau->psinum == rssringoccs_DR_Newton))
     {
-        tau->error_occurred = rssringoccs_True;
-        tau->error_message = rssringoccs_strdup(
-            "\n\rError Encountered: rss_ringoccs\n\n"
-            "\r\tDiffractionCorrectionFresnel\n\n"
-            "\rMalloc failed and returned NULL for w_func. Returning.\n\n"
-        );
-        return;
-    }
+        if (tau->use_norm)
+            WarmT = Fresnel_Transform_Newton_Warm_Norm_Double;
+        else
+            WarmT = Fresnel_Transform_Newton_Warm_Double;
+
+        max_half = (nw_pts - 1) / 2;
+        for (i = 0; i < count; ++i)
+        {
+            half = (unsigned long)(tau->w_km_vals[first + i] / two_dx);
+            if (half > max_half)
+                max_half = half;
+        }
+
+        /*  max_half is the widest window anywhere in the range, so a point   *
+         *  with a narrower window may be closer to either end of the data    *
+         *  than max_half. Keep phi_warm inside the data.                     */
+        if (first > max_half)
+            warm_first = first - max_half;
+        else
+            warm_first = 0;
+
+        warm_end = first + count + max_half;
+        if (warm_end > tau->arr_size)
+            warm_end = tau->arr_size;
 
-    /*  Compute the rho and phi variables, and the window function.           */
-    for (j=0; j<nw_pts; ++j)
-        w_func[j] = tau->window_func(
-            tau->rho_km_vals[offset+j] - tau->rho_km_vals[center], w_init
-        );
+        phi_warm = (double *)malloc(sizeof(*phi_warm) *
+                                    (warm_end - warm_first));
+        if (phi_warm == NULL)
+        {
+            free(w_buffer);
+            return rssringoccs_False;
+        }
 
-    /*  Check tau->use_norm outside of the inner for loop to prevent          *
-     *  redundantly checking an if-then statement over and over again.        */
+    }
 
-    /*  Run diffraction correction point by point.                        */
-    for (i=0; i < tau->n_used; ++i)
+    /*  Run diffraction correction point by point.                            */
+    center = first;
+    for (i=0; i < count; ++i)
     {
-        /*  If the window width changes significantly, recompute w_func.  */
+        /*  If the window width changes significantly, get the new w_func.    */
         if (fabs(w_init - tau->w_km_vals[center]) >= two_dx)
         {
-            /* Reset w_init and recompute window function.                */
+            /* Reset w_init and get the window function for the new size.     */
             w_init = tau->w_km_vals[center];
-            nw_pts = 2*((int)(w_init / (2.0 * dx)))+1;
-            offset = center - (long)((nw_pts-1)/2);
-
-            /*  Reallocate memory since the sizes have changed.           */
-            w_func = (double *)realloc(w_func, sizeof(*w_func) * nw_pts);
-
-            /*  Recompute rho, phi, and the window function.              */
-            for (j=0; j<nw_pts; ++j)
-                w_func[j] = tau->window_func(
-                    tau->rho_km_vals[offset+j] - tau->rho_km_vals[center],
-                    w_init
-                );
+            nw_pts = 2*((long)(w_init / two_dx))+1;
+
+            w_func = rssringoccs_Window_Cache_Get(tau->window_func, nw_pts,
+                                                  &w_buffer);
+            if (w_func == NULL)
+            {
+                free(w_buffer);
+                free(phi_warm);
+                return rssringoccs_False;
+            }
         }
 
-        /*  Compute the fresnel tranform about the current point.         */
-        FresT(tau, w_func, nw_pts, center);
+        /*  Start a new block of warm starts from phi0. Only the points the   *
+         *  windows of this block can reach need to be reset.                 */
+        if ((phi_warm != NULL) &&
+            ((i == 0) ||
+             ((center - tau->start) % RSSRINGOCCS_TAU_BLOCK_LENGTH == 0)))
+        {
+            warm_last = center + RSSRINGOCCS_TAU_BLOCK_LENGTH + max_half;
+            if (warm_last > warm_end)
+                warm_last = warm_end;
+
+            if (center - warm_first > max_half)
+                j = center - max_half;
+            else
+                j = warm_first;
 
-        /*  Increment pointers using pointer arithmetic.                  */
+            for (; j < warm_last; ++j)
+                phi_warm[j - warm_first] = tau->phi_rad_vals[j];
+        }
+
+        /*  Compute the fresnel tranform about the current point.             */
+        if (phi_warm != NULL)
+            WarmT(tau, w_func + 1, nw_pts, center,
+                  phi_warm + (center - (nw_pts - 1)/2 - warm_first));
+        else
+            FresT(tau, w_func + 1, nw_pts, center);
+
+        /*  Increment pointers using pointer arithmetic.                      */
         center += 1;
     }
 
-    /*  Free variables allocated by malloc.                                   */
-    free(w_func);
+    /*  The buffer is only used if the window cache is full.                  */
+    free(w_buffer);
+    free(phi_warm);
+    return rssringoccs_True;
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      DiffractionCorrectionNewton                                           *
+ *  Purpose:                                                                  *
+ *      Compute the Fresnel transform using the Newton-Raphson method to      *
+ *      compute the stationary value of the Fresnel-Kernel.                   *
+ *  Arguments:                                                                *
+ *      dlp (DLPObj *):                                                       *
+ *          An instance of the DLPObj structure defined in                    *
+ *          _diffraction_correction.h. This contains all of the necessary     *
+ *          data for diffraction correction, including the geometry of the    *
+ *          occultation and actual power and phase data.                      *
+ *  Output:                                                                   *
+ *      Nothing (void):                                                       *
+ *          This is a void function, so no actual output is provided. However *
+ *          the T_out pointer within the dlp structure will be changed at the *
+ *          end, containing the diffraction correction data.                  *
+ *  Notes:                                                                    *
+ *      1.) This method is the most accurate, but much slower than the        *
+ *          Fresnel and Legendre options. It is accurate for every Rev of the *
+ *          Cassini mission with the exception of the Rev133 occultation      *
+ *          of which only the Ka band produces accurate results. For X and S  *
+ *          bands one needs to use the Perturbed Newton method.               *
+ *      2.) The polynomials from the MTR86 are available via the dlp.interp   *
+ *          variable. These polynomials are slower and less accurate than the *
+ *          normal Newton method since to compute the polynomials the         *
+ *          Newton-Raphson method must be performed, and hence the            *
+ *          polynomials increase the number of computations needed. The real  *
+ *          use of them arises if one uses FFT methods. This routine does NOT *
+ *          use FFTs, but rather ordinary integration.                        *
+ ******************************************************************************/
+RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_Newton(rssringoccs_TAUObj *tau)
+{
+    /*  Twice the sample spacing, used to check if the window width changed.  */
+    double two_dx;
+
+    /*  Check that the pointers to the data are not NULL.                     */
+    rssringoccs_Tau_Check_Data(tau);
+    if (tau->error_occurred)
+        return;
+
+    /* Check to ensure you have enough data to the left.                      */
+    rssringoccs_Tau_Check_Data_Range(tau);
+    if (tau->error_occurred)
+        return;
+
+    /*  Run diffraction correction point by point, splitting the points       *
+     *  across tau->num_threads threads.                                      */
+    two_dx = tau->rho_km_vals[tau->start+1] - tau->rho_km_vals[tau->start];
+    two_dx *= 2.0;
+    rssringoccs_Tau_Run_Range(tau, __newton_range, tau->n_used, two_dx);
 }
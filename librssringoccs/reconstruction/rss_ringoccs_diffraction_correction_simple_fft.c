@@ -43,12 +43,9 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_SimpleFFT(rssringocc
     double w_init, psi, phi, window_func_x, factor, rcpr_F;
     double w_thresh, arg_norm, D, x, y, z, dx, dy;
     rssringoccs_ComplexDouble *ker;
-    rssringoccs_ComplexDouble *fft_ker;
-    rssringoccs_ComplexDouble *fft_in;
-    rssringoccs_ComplexDouble *fft_out;
     rssringoccs_ComplexDouble *T_in;
-    rssringoccs_ComplexDouble *T_out;
     rssringoccs_ComplexDouble arg;
+    rssringoccs_FFT_Plan *fwd_plan, *inv_plan;
 
     /*  Check that the pointers to the data are not NULL.                     */
     rssringoccs_Tau_Check_Data(tau);
@@ -78,9 +75,22 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_SimpleFFT(rssringocc
 
     /*  Allocate memory for the Fresnel kernel and other variables.           */
     ker     = (rssringoccs_ComplexDouble *)malloc(sizeof(*ker)     * data_size);
-    fft_out = (rssringoccs_ComplexDouble *)malloc(sizeof(*fft_out) * data_size);
     T_in    = (rssringoccs_ComplexDouble *)malloc(sizeof(*T_in)    * data_size);
 
+    if ((ker == NULL) || (T_in == NULL))
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs:\n"
+            "\r\trssringoccs_Diffraction_Correction_SimpleFFT\n"
+            "\rMalloc failed and returned NULL for ker or T_in.\n"
+            "\rAborting.\n\n"
+        );
+        free(ker);
+        free(T_in);
+        return;
+    }
+
     w_thresh = 0.5*tau->w_km_vals[center];
 
     /*  Compute the windowing function and Psi.                               */
@@ -138,47 +148,35 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_SimpleFFT(rssringocc
         T_in[i] = tau->T_in[current_point];
     }
 
-    fft_ker = rssringoccs_Complex_FFT(ker,  data_size, rssringoccs_False);
-    if (fft_ker == NULL)
+    /*  The kernel and the data are transformed with the same plan, and the   *
+     *  transforms are done in place. Only the butterflies are repeated.      */
+    fwd_plan = rssringoccs_FFT_Plan_Create(data_size, rssringoccs_False,
+                                           RSSRINGOCCS_FFT_DEFAULT);
+    inv_plan = rssringoccs_FFT_Plan_Create(data_size, rssringoccs_True,
+                                           RSSRINGOCCS_FFT_DEFAULT);
+    if ((fwd_plan == NULL) || (inv_plan == NULL))
     {
         tau->error_occurred = rssringoccs_True;
         tau->error_message = rssringoccs_strdup(
             "\n\rError Encountered: rss_ringoccs:\n"
             "\r\trssringoccs_Diffraction_Correction_SimpleFFT\n"
-            "\rrssringoccs_Complex_FFT returned NULL for fft_ker.\n"
+            "\rrssringoccs_FFT_Plan_Create returned NULL.\n"
             "\rAborting.\n\n"
         );
+        rssringoccs_FFT_Plan_Destroy(fwd_plan);
+        rssringoccs_FFT_Plan_Destroy(inv_plan);
+        free(ker);
+        free(T_in);
         return;
     }
 
-    fft_in  = rssringoccs_Complex_FFT(T_in, data_size, rssringoccs_False);
-    if (fft_in == NULL)
-    {
-        tau->error_occurred = rssringoccs_True;
-        tau->error_message = rssringoccs_strdup(
-            "\n\rError Encountered: rss_ringoccs:\n"
-            "\r\trssringoccs_Diffraction_Correction_SimpleFFT\n"
-            "\rrssringoccs_Complex_FFT returned NULL for fft_in.\n"
-            "\rAborting.\n\n"
-        );
-        return;
-    }
+    rssringoccs_FFT_Plan_Execute(fwd_plan, ker, ker);
+    rssringoccs_FFT_Plan_Execute(fwd_plan, T_in, T_in);
 
     for (i = 0; i < data_size; ++i)
-        fft_out[i] = rssringoccs_CDouble_Multiply(fft_ker[i], fft_in[i]);
+        T_in[i] = rssringoccs_CDouble_Multiply(ker[i], T_in[i]);
 
-    T_out = rssringoccs_Complex_FFT(fft_out, data_size, rssringoccs_True);
-    if (T_out == NULL)
-    {
-        tau->error_occurred = rssringoccs_True;
-        tau->error_message = rssringoccs_strdup(
-            "\n\rError Encountered: rss_ringoccs:\n"
-            "\r\trssringoccs_Diffraction_Correction_SimpleFFT\n"
-            "\rrssringoccs_Complex_FFT returned NULL for T_out.\n"
-            "\rAborting.\n\n"
-        );
-        return;
-    }
+    rssringoccs_FFT_Plan_Execute(inv_plan, T_in, T_in);
 
     for(i = 0; i < tau->n_used; ++i)
     {
@@ -186,14 +184,12 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Diffraction_Correction_SimpleFFT(rssringocc
         rcpr_F        = 1.0/tau->F_km_vals[tau->start + i];
         arg           = rssringoccs_CDouble_Rect(factor*rcpr_F, factor*rcpr_F);
         tau->T_out[tau->start + i]
-            = rssringoccs_CDouble_Multiply(arg, T_out[i_shift]);
+            = rssringoccs_CDouble_Multiply(arg, T_in[i_shift]);
     }
 
     /*  Free variables allocated by malloc.                                   */
     free(ker);
-    free(fft_ker);
-    free(fft_in);
-    free(fft_out);
     free(T_in);
-    free(T_out);
+    rssringoccs_FFT_Plan_Destroy(fwd_plan);
+    rssringoccs_FFT_Plan_Destroy(inv_plan);
 }
@@ -1,14 +1,31 @@
-
 #include <stdlib.h>
 #include <rss_ringoccs/include/rss_ringoccs_bool.h>
 #include <rss_ringoccs/include/rss_ringoccs_string.h>
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  Runs the transform selected by tau->psinum over tau->start to             *
+ *  tau->start + tau->n_used. If tau->use_fwd is set, the transforms use the  *
+ *  conjugate kernel, exp(i psi), which computes the forward model.           */
+static void __diffraction_correction(rssringoccs_TAUObj *tau)
+{
+    if      (tau->psinum == rssringoccs_DR_Fresnel)
+        rssringoccs_Diffraction_Correction_Fresnel(tau);
+    else if (tau->psinum == rssringoccs_DR_Legendre)
+        rssringoccs_Diffraction_Correction_Legendre(tau);
+    else if (tau->psinum == rssringoccs_DR_SimpleFFT)
+        rssringoccs_Diffraction_Correction_SimpleFFT(tau);
+    else if (tau->psinum == rssringoccs_DR_BlockFFT)
+        rssringoccs_Diffraction_Correction_BlockFFT(tau);
+    else
+        rssringoccs_Diffraction_Correction_Newton(tau);
+}
+
 RSS_RINGOCCS_EXPORT void rssringoccs_Reconstruction(rssringoccs_TAUObj *tau)
 {
     rssringoccs_ComplexDouble *temp_T_in;
     rssringoccs_Bool temp_fwd;
-    unsigned long n, temp_start, temp_n_used, nw_pts;
+    unsigned long temp_start, temp_n_used, nw_pts;
     double w_left, w_right, w_max;
 
     if (tau == NULL)
@@ -18,38 +35,41 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Reconstruction(rssringoccs_TAUObj *tau)
         return;
 
     rssringoccs_Tau_Check_Keywords(tau);
-    rssringoccs_Tau_Check_Occ_Type(tau);
-    rssringoccs_Tau_Compute_Vars(tau);
+
+    /*  T_in, F_km_vals, and k_vals do not depend on the resolution. They may *
+     *  have been computed already, as rssringoccs_Reconstruction_Multi_Res   *
+     *  does, and are used as is if the object has not been reconstructed.    */
+    if ((tau->T_in == NULL) || (tau->F_km_vals == NULL) ||
+        (tau->k_vals == NULL) || (tau->T_out != NULL))
+    {
+        rssringoccs_Tau_Check_Occ_Type(tau);
+        rssringoccs_Tau_Compute_Vars(tau);
+    }
+
     rssringoccs_Tau_Get_Window_Width(tau);
     rssringoccs_Tau_Check_Data_Range(tau);
 
-    tau->T_out = (rssringoccs_ComplexDouble *)calloc(tau->arr_size, sizeof(*tau->T_out));
+    tau->T_out = (rssringoccs_ComplexDouble *)
+        rssringoccs_Tau_Arena_Calloc(tau, tau->arr_size, sizeof(*tau->T_out));
     rssringoccs_Tau_Check_Data(tau);
+    rssringoccs_Tau_Build_View(tau);
 
     temp_fwd = tau->use_fwd;
     tau->use_fwd = rssringoccs_False;
-
-    if      (tau->psinum == rssringoccs_DR_Fresnel)
-        rssringoccs_Diffraction_Correction_Fresnel(tau);
-    else if (tau->psinum == rssringoccs_DR_Legendre)
-        rssringoccs_Diffraction_Correction_Legendre(tau);
-    else if (tau->psinum == rssringoccs_DR_SimpleFFT)
-        rssringoccs_Diffraction_Correction_SimpleFFT(tau);
-    else
-        rssringoccs_Diffraction_Correction_Newton(tau);
-
+    __diffraction_correction(tau);
     tau->use_fwd = temp_fwd;
 
+    /*  The forward model is the transform of T_out with the kernel exp(i psi)*
+     *  in place of exp(-i psi). The geometry, k_vals included, is left as it *
+     *  is. Only the points a full window from either end of T_out are used.  */
     if (tau->use_fwd)
     {
         temp_T_in  = tau->T_in;
         tau->T_in  = tau->T_out;
-        tau->T_out = (rssringoccs_ComplexDouble *)calloc(tau->arr_size, sizeof(*tau->T_out));
-
-        /*  If forward tranform is set, negate the k_vals variable. This has  *
-         *  the equivalent effect of computing the forward calculation later. */
-        for (n = 0; n <= tau->n_used; ++n)
-            tau->k_vals[tau->start + n] *= -1.0;
+        tau->T_out = (rssringoccs_ComplexDouble *)
+            rssringoccs_Tau_Arena_Calloc(tau, tau->arr_size,
+                                         sizeof(*tau->T_out));
+        rssringoccs_Tau_Build_View(tau);
 
         w_left  = tau->w_km_vals[tau->start];
         w_right = tau->w_km_vals[tau->start + tau->n_used];
@@ -77,26 +97,15 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Reconstruction(rssringoccs_TAUObj *tau)
         {
             tau->start = tau->start + nw_pts;
             tau->n_used = tau->n_used - 2*nw_pts;
-            if      (tau->psinum == rssringoccs_DR_Fresnel)
-                rssringoccs_Diffraction_Correction_Fresnel(tau);
-            else if (tau->psinum == rssringoccs_DR_Legendre)
-                rssringoccs_Diffraction_Correction_Legendre(tau);
-            else if (tau->psinum == rssringoccs_DR_SimpleFFT)
-                rssringoccs_Diffraction_Correction_SimpleFFT(tau);
-            else
-                rssringoccs_Diffraction_Correction_Newton(tau);
-
+            __diffraction_correction(tau);
             tau->start = temp_start;
             tau->n_used = temp_n_used;
         }
 
-        /*  Unnegate k_vals to its original values.                           */
-        for (n = 0; n <= tau->n_used; ++n)
-            tau->k_vals[tau->start + n] *= -1.0;
-
         tau->T_fwd = tau->T_out;
-        tau->T_out = tau->T_in;;
+        tau->T_out = tau->T_in;
         tau->T_in  = temp_T_in;
+        rssringoccs_Tau_Build_View(tau);
     }
 
     rssringoccs_Tau_Finish(tau);
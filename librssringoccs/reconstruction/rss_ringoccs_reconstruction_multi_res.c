@@ -0,0 +1,267 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                   rss_ringoccs_reconstruction_multi_res                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Reconstruct one data set at several resolutions.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Reconstruction_Multi_Res:                                 *
+ *  Purpose:                                                                  *
+ *      Runs rssringoccs_Reconstruction on a new tau object that shares the   *
+ *      data of tau, for each of the resolutions in res.                      *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj, made by                        *
+ *          rssringoccs_Create_TAUObj, with the keywords for the              *
+ *          reconstruction set. Its resolution is not used.                   *
+ *      res (const double *):                                                 *
+ *          The resolutions, in kilometers.                                   *
+ *      n_res (unsigned long):                                                *
+ *          The number of elements of res.                                    *
+ *  Output:                                                                   *
+ *      tau_list (rssringoccs_TAUObj **):                                     *
+ *          An array of n_res pointers, the nth of which is the               *
+ *          reconstruction at resolution res[n]. Returns NULL if tau is NULL, *
+ *          if tau->error_occurred is set, or if malloc fails.                *
+ *  Method:                                                                   *
+ *      T_in, F_km_vals, and k_vals do not depend on the resolution, so they  *
+ *      are computed once, in tau, by rssringoccs_Tau_Check_Occ_Type and      *
+ *      rssringoccs_Tau_Compute_Vars. These are the only steps that change    *
+ *      the data in place, reversing the arrays and negating k_vals for an    *
+ *      ingress occultation. Every other step of a reconstruction only reads  *
+ *      the data, so each resolution borrows the arrays of tau, as            *
+ *      rssringoccs_Borrow_DLP_Data_To_Tau borrows those of a DLP, and        *
+ *      nothing is copied up front. The window width, the range of the data   *
+ *      used, and the transform depend on the resolution and are computed     *
+ *      for each object by rssringoccs_Reconstruction, and                    *
+ *      rssringoccs_Tau_Finish then copies only the range that was used.      *
+ *  NOTES:                                                                    *
+ *      1.) The caller destroys each of the tau objects with                  *
+ *          rssringoccs_Destroy_Tau, and then frees the array. An element of  *
+ *          the array is NULL if malloc failed for it. Otherwise, errors are  *
+ *          reported in the error_occurred and error_message members of that  *
+ *          element, and do not stop the other resolutions. The arrays of an  *
+ *          element with an error are freed, so that no element points at     *
+ *          the data of tau, and tau may be destroyed first.                  *
+ *      2.) tau is not reconstructed, but T_in, F_km_vals, and k_vals are     *
+ *          computed, and rho_dot_kms_vals is made positive for ingress       *
+ *          occultations. It may be passed to this function again.           *
+ *      3.) The resolutions are run in the order given, and the stationary    *
+ *          azimuth angles are not shared between them. With use_warm_start   *
+ *          set, Newton-Raphson is already warm started from the previous     *
+ *          point's solutions, and only starts from phi_rad_vals every        *
+ *          RSSRINGOCCS_TAU_BLOCK_LENGTH points. The most a narrower window   *
+ *          could save is those restarts.                                     *
+ *          On the Rev007 test data, at 0.5, 1, and 2 km, removing them all   *
+ *          changed the time of the newton reconstruction by less than the    *
+ *          5% noise between runs, and so did turning warm starts off.        *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) rss_ringoccs_bool.h:                                                  *
+ *          Header file containing rssringoccs_Bool, and True and False.      *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file containing the rssringoccs_TAUObj typedef.            *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  Points the member var of out at the array of tau, and records it as       *
+ *  borrowed, so that out neither writes to it nor frees it.                  */
+#define __SHARE_TAU_VAR__(var)                                                 \
+    if (tau->var != NULL)                                                      \
+    {                                                                          \
+        out->var = tau->var;                                                   \
+        out->borrowed[out->n_borrowed] = (double *)out->var;                   \
+        ++out->n_borrowed;                                                     \
+    }
+
+/*  Copies tau, sharing the data in it that does not depend on the resolution.*/
+static rssringoccs_TAUObj *__copy_tau(const rssringoccs_TAUObj *tau)
+{
+    rssringoccs_TAUObj *out;
+
+    out = (rssringoccs_TAUObj *)malloc(sizeof(*out));
+    if (out == NULL)
+        return out;
+
+    /*  Copy the keywords, then set every pointer to NULL, so that the object *
+     *  may be destroyed at any point below.                                  */
+    *out = *tau;
+    out->T_in = NULL;
+    out->T_out = NULL;
+    out->T_fwd = NULL;
+    out->T_in_re = NULL;
+    out->T_in_im = NULL;
+    out->T_in_re_f = NULL;
+    out->T_in_im_f = NULL;
+    out->rho_km_vals = NULL;
+    out->F_km_vals = NULL;
+    out->phi_rad_vals = NULL;
+    out->k_vals = NULL;
+    out->f_sky_hz_vals = NULL;
+    out->rho_dot_kms_vals = NULL;
+    out->raw_tau_threshold_vals = NULL;
+    out->B_rad_vals = NULL;
+    out->D_km_vals = NULL;
+    out->w_km_vals = NULL;
+    out->t_oet_spm_vals = NULL;
+    out->t_ret_spm_vals = NULL;
+    out->t_set_spm_vals = NULL;
+    out->rho_corr_pole_km_vals = NULL;
+    out->rho_corr_timing_km_vals = NULL;
+    out->tau_threshold_vals = NULL;
+    out->phi_rl_rad_vals = NULL;
+    out->p_norm_vals = NULL;
+    out->p_norm_fwd_vals = NULL;
+    out->power_vals = NULL;
+    out->phase_rad_vals = NULL;
+    out->phase_fwd_vals = NULL;
+    out->phase_vals = NULL;
+    out->tau_fwd_vals = NULL;
+    out->tau_vals = NULL;
+    out->rx_km_vals = NULL;
+    out->ry_km_vals = NULL;
+    out->rz_km_vals = NULL;
+    out->error_message = NULL;
+    out->arena = NULL;
+    out->arena_size = 0;
+    out->arena_used = 0;
+    out->n_borrowed = 0U;
+    out->wtype = rssringoccs_strdup(tau->wtype);
+    out->psitype = rssringoccs_strdup(tau->psitype);
+
+    if ((out->wtype == NULL) || (out->psitype == NULL))
+    {
+        out->error_occurred = rssringoccs_True;
+        out->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\trssringoccs_Reconstruction_Multi_Res\n\n"
+            "\rrssringoccs_strdup failed to copy wtype or psitype.\n"
+            "\rReturning.\n\n"
+        );
+        return out;
+    }
+
+    /*  The copy gets its own arena, sized as in Copy_DLP_Data_To_Tau, for    *
+     *  the arrays the reconstruction adds and the copies Tau_Finish makes.   */
+    rssringoccs_Tau_Arena_Init(
+        out,
+        RSSRINGOCCS_TAU_ARENA_ARRAYS *
+        (sizeof(double) * out->arr_size + RSSRINGOCCS_TAU_ARENA_ALIGN)
+    );
+
+    /*  The data from the DLP, and the variables from Tau_Compute_Vars. This  *
+     *  is RSSRINGOCCS_TAU_BORROWED_ARRAYS arrays, so the list has room.      */
+    __SHARE_TAU_VAR__(T_in)
+    __SHARE_TAU_VAR__(rho_km_vals)
+    __SHARE_TAU_VAR__(F_km_vals)
+    __SHARE_TAU_VAR__(phi_rad_vals)
+    __SHARE_TAU_VAR__(k_vals)
+    __SHARE_TAU_VAR__(f_sky_hz_vals)
+    __SHARE_TAU_VAR__(rho_dot_kms_vals)
+    __SHARE_TAU_VAR__(raw_tau_threshold_vals)
+    __SHARE_TAU_VAR__(B_rad_vals)
+    __SHARE_TAU_VAR__(D_km_vals)
+    __SHARE_TAU_VAR__(t_oet_spm_vals)
+    __SHARE_TAU_VAR__(t_ret_spm_vals)
+    __SHARE_TAU_VAR__(t_set_spm_vals)
+    __SHARE_TAU_VAR__(rho_corr_pole_km_vals)
+    __SHARE_TAU_VAR__(rho_corr_timing_km_vals)
+    __SHARE_TAU_VAR__(phi_rl_rad_vals)
+    __SHARE_TAU_VAR__(p_norm_vals)
+    __SHARE_TAU_VAR__(phase_rad_vals)
+    __SHARE_TAU_VAR__(rx_km_vals)
+    __SHARE_TAU_VAR__(ry_km_vals)
+    __SHARE_TAU_VAR__(rz_km_vals)
+
+    return out;
+}
+
+/*  Function for reconstructing a data set at several resolutions.            */
+RSS_RINGOCCS_EXPORT rssringoccs_TAUObj **
+rssringoccs_Reconstruction_Multi_Res(rssringoccs_TAUObj *tau,
+                                     const double *res, unsigned long n_res)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    rssringoccs_TAUObj **tau_list;
+    unsigned long n;
+
+    if ((tau == NULL) || (res == NULL))
+        return NULL;
+
+    if (tau->error_occurred)
+        return NULL;
+
+    /*  Compute the resolution independent variables once, if needed.         */
+    if ((tau->T_in == NULL) || (tau->F_km_vals == NULL) ||
+        (tau->k_vals == NULL))
+    {
+        rssringoccs_Tau_Check_Occ_Type(tau);
+        rssringoccs_Tau_Compute_Vars(tau);
+    }
+
+    /*  tau must not have been reconstructed, since rssringoccs_Tau_Finish    *
+     *  shrinks its arrays to the range that was used.                        */
+    if (tau->T_out != NULL)
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\trssringoccs_Reconstruction_Multi_Res\n\n"
+            "\rInput tau has already been reconstructed. Returning.\n\n"
+        );
+    }
+
+    if (tau->error_occurred)
+        return NULL;
+
+    tau_list = (rssringoccs_TAUObj **)malloc(sizeof(*tau_list) * n_res);
+    if (tau_list == NULL)
+        return NULL;
+
+    for (n = 0; n < n_res; ++n)
+    {
+        tau_list[n] = __copy_tau(tau);
+        if (tau_list[n] == NULL)
+            continue;
+
+        tau_list[n]->res = res[n];
+        rssringoccs_Reconstruction(tau_list[n]);
+
+        /*  On success rssringoccs_Tau_Finish has copied every borrowed       *
+         *  array. On failure the object may still point at the data of tau.  */
+        if (tau_list[n]->error_occurred)
+            rssringoccs_Destroy_Tau_Members(tau_list[n]);
+    }
+
+    return tau_list;
+}
+/*  End of rssringoccs_Reconstruction_Multi_Res.                              */
@@ -0,0 +1,385 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                          rss_ringoccs_tau_arena                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Allocate the member arrays of a tau object from one slab of memory,   *
+ *      the arena, so that a reconstruction calls malloc once for its data    *
+ *      instead of once per array, and keep track of the arrays borrowed from *
+ *      a DLP, or from another tau object, which tau does not own.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Init:                                           *
+ *  Purpose:                                                                  *
+ *      Makes sure tau has an empty arena that holds at least n_bytes.        *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *      n_bytes (unsigned long):                                              *
+ *          The number of bytes to hold.                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  NOTES:                                                                    *
+ *      1.) An arena that is large enough is reused. Nothing is done if the   *
+ *          arena is in use, that is, if anything has been allocated from it  *
+ *          since it was last reset.                                          *
+ *      2.) If malloc fails, tau is left without an arena and every           *
+ *          allocation falls back to malloc. This is not an error.            *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Alloc:                                          *
+ *  Purpose:                                                                  *
+ *      Allocates n_bytes from the arena of tau.                              *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *      n_bytes (unsigned long):                                              *
+ *          The number of bytes to allocate.                                  *
+ *  Output:                                                                   *
+ *      ptr (void *):                                                         *
+ *          A pointer to n_bytes of memory, aligned to                        *
+ *          RSSRINGOCCS_TAU_ARENA_ALIGN bytes. If the arena is missing or     *
+ *          full this is from malloc instead, and may be NULL.                *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Calloc:                                         *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Tau_Arena_Alloc, for n_elements elements of size  *
+ *      bytes each, with the memory set to zero, like calloc.                 *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Owns:                                           *
+ *  Purpose:                                                                  *
+ *      Returns true if ptr points into the arena of tau.                     *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Free:                                           *
+ *  Purpose:                                                                  *
+ *      Frees ptr if it came from malloc. Memory in the arena is released     *
+ *      all at once by rssringoccs_Tau_Arena_Reset, so this does nothing for  *
+ *      pointers into the arena. ptr may be NULL.                             *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Reset:                                          *
+ *  Purpose:                                                                  *
+ *      Marks the arena empty, keeping the memory for the next data set.      *
+ *  NOTES:                                                                    *
+ *      1.) Every pointer into the arena is invalid after this. It is called  *
+ *          by rssringoccs_Destroy_Tau_Members, after it has set the members  *
+ *          of tau to NULL, so that the same object may be given new data     *
+ *          with rssringoccs_Copy_DLP_Data_To_Tau without a new slab.         *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Arena_Destroy:                                        *
+ *  Purpose:                                                                  *
+ *      Frees the arena. Called by rssringoccs_Destroy_Tau.                   *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Is_Borrowed:                                          *
+ *  Purpose:                                                                  *
+ *      Returns true if ptr is an array of a DLP that tau points at, from     *
+ *      rssringoccs_Borrow_DLP_Data_To_Tau, or one of the input of            *
+ *      rssringoccs_Reconstruction_Multi_Res. tau may not write to or free    *
+ *      it.                                                                   *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Own_Array:                                            *
+ *  Purpose:                                                                  *
+ *      If *ptr is borrowed, replaces it with a copy of the len elements      *
+ *      starting at start, taken from the arena. Otherwise does nothing.      *
+ *  NOTES:                                                                    *
+ *      1.) This is called before a borrowed array is changed in place, as in *
+ *          rssringoccs_Tau_Check_Occ_Type, and by rssringoccs_Tau_Finish,    *
+ *          so that the outputs never point at the data of the DLP.           *
+ *      2.) On failure error_occurred is set and *ptr is left as it was.      *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Own_CArray:                                           *
+ *  Purpose:                                                                  *
+ *      Same as rssringoccs_Tau_Own_Array, for a complex array. Only T_in is  *
+ *      borrowed, by rssringoccs_Reconstruction_Multi_Res, and it is copied   *
+ *      by rssringoccs_Tau_Finish.                                            *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) string.h:                                                             *
+ *          C standard library header. Used for memset and memcpy.            *
+ *  3.) rss_ringoccs_bool.h:                                                  *
+ *          Header file containing rssringoccs_Bool, and True and False.      *
+ *  4.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  5.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <string.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  The number of bytes from the start of the slab to the first aligned       *
+ *  address. Only the low bits of the address are needed, so the conversion   *
+ *  to unsigned long is safe even where it is narrower than a pointer.        */
+static unsigned long __arena_offset(const rssringoccs_TAUObj *tau)
+{
+    unsigned long addr = (unsigned long)tau->arena;
+    return (RSSRINGOCCS_TAU_ARENA_ALIGN - addr % RSSRINGOCCS_TAU_ARENA_ALIGN) %
+           RSSRINGOCCS_TAU_ARENA_ALIGN;
+}
+
+/*  Function for making sure tau has an empty arena of at least n_bytes.      */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Tau_Arena_Init(rssringoccs_TAUObj *tau, unsigned long n_bytes)
+{
+    if (tau == NULL)
+        return;
+
+    /*  Pointers into the arena may still be in use.                          */
+    if (tau->arena_used != 0)
+        return;
+
+    /*  The slab is over-allocated so that there is room to align the start.  */
+    n_bytes += RSSRINGOCCS_TAU_ARENA_ALIGN;
+
+    if ((tau->arena != NULL) && (tau->arena_size >= n_bytes))
+        return;
+
+    free(tau->arena);
+    tau->arena = (char *)malloc(n_bytes);
+
+    if (tau->arena == NULL)
+        tau->arena_size = 0;
+    else
+        tau->arena_size = n_bytes;
+}
+/*  End of rssringoccs_Tau_Arena_Init.                                        */
+
+/*  Function for allocating memory from the arena of tau.                     */
+RSS_RINGOCCS_EXPORT void *
+rssringoccs_Tau_Arena_Alloc(rssringoccs_TAUObj *tau, unsigned long n_bytes)
+{
+    unsigned long offset, size;
+    char *ptr;
+
+    if (tau->arena == NULL)
+        return malloc(n_bytes);
+
+    /*  Round up so that the next allocation is aligned as well.              */
+    size = (n_bytes + RSSRINGOCCS_TAU_ARENA_ALIGN - 1) /
+           RSSRINGOCCS_TAU_ARENA_ALIGN * RSSRINGOCCS_TAU_ARENA_ALIGN;
+    offset = __arena_offset(tau);
+
+    if (size > tau->arena_size - offset - tau->arena_used)
+        return malloc(n_bytes);
+
+    ptr = tau->arena + offset + tau->arena_used;
+    tau->arena_used += size;
+    return ptr;
+}
+/*  End of rssringoccs_Tau_Arena_Alloc.                                       */
+
+/*  Function for allocating zeroed memory from the arena of tau.              */
+RSS_RINGOCCS_EXPORT void *
+rssringoccs_Tau_Arena_Calloc(rssringoccs_TAUObj *tau, unsigned long n_elements,
+                             unsigned long size)
+{
+    void *ptr;
+
+    if (tau->arena == NULL)
+        return calloc(n_elements, size);
+
+    ptr = rssringoccs_Tau_Arena_Alloc(tau, n_elements * size);
+
+    if (ptr != NULL)
+        memset(ptr, 0, n_elements * size);
+
+    return ptr;
+}
+/*  End of rssringoccs_Tau_Arena_Calloc.                                      */
+
+/*  Function for checking if a pointer is in the arena of tau.                */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Tau_Arena_Owns(const rssringoccs_TAUObj *tau, const void *ptr)
+{
+    const char *p = (const char *)ptr;
+
+    if ((tau->arena == NULL) || (p == NULL))
+        return rssringoccs_False;
+
+    if ((p >= tau->arena) && (p < tau->arena + tau->arena_size))
+        return rssringoccs_True;
+    else
+        return rssringoccs_False;
+}
+/*  End of rssringoccs_Tau_Arena_Owns.                                        */
+
+/*  Function for freeing memory that is not in the arena of tau.              */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Tau_Arena_Free(rssringoccs_TAUObj *tau, void *ptr)
+{
+    /*  Borrowed arrays belong to the DLP, and are not freed here.            */
+    if (rssringoccs_Tau_Is_Borrowed(tau, ptr))
+        return;
+
+    if (!rssringoccs_Tau_Arena_Owns(tau, ptr))
+        free(ptr);
+}
+/*  End of rssringoccs_Tau_Arena_Free.                                        */
+
+/*  Function for marking the arena of tau empty.                              */
+RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Arena_Reset(rssringoccs_TAUObj *tau)
+{
+    if (tau == NULL)
+        return;
+
+    tau->arena_used = 0;
+}
+/*  End of rssringoccs_Tau_Arena_Reset.                                       */
+
+/*  Function for freeing the arena of tau.                                    */
+RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Arena_Destroy(rssringoccs_TAUObj *tau)
+{
+    if (tau == NULL)
+        return;
+
+    free(tau->arena);
+    tau->arena = NULL;
+    tau->arena_size = 0;
+    tau->arena_used = 0;
+}
+/*  End of rssringoccs_Tau_Arena_Destroy.                                     */
+
+/*  Function for checking if a pointer is borrowed from a DLP.                */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Tau_Is_Borrowed(const rssringoccs_TAUObj *tau, const void *ptr)
+{
+    unsigned int n;
+
+    if (ptr == NULL)
+        return rssringoccs_False;
+
+    for (n = 0U; n < tau->n_borrowed; ++n)
+        if ((const void *)tau->borrowed[n] == ptr)
+            return rssringoccs_True;
+
+    return rssringoccs_False;
+}
+/*  End of rssringoccs_Tau_Is_Borrowed.                                       */
+
+/*  Returns the index of ptr in the list of borrowed arrays of tau, or        *
+ *  n_borrowed if tau owns it.                                                */
+static unsigned int
+__borrowed_index(const rssringoccs_TAUObj *tau, const void *ptr)
+{
+    unsigned int n;
+
+    for (n = 0U; n < tau->n_borrowed; ++n)
+        if ((const void *)tau->borrowed[n] == ptr)
+            break;
+
+    return n;
+}
+
+/*  Removes entry n from the list of borrowed arrays of tau. The order of the *
+ *  list does not matter, so the last entry is moved into its place.          */
+static void __drop_borrowed(rssringoccs_TAUObj *tau, unsigned int n)
+{
+    --tau->n_borrowed;
+    tau->borrowed[n] = tau->borrowed[tau->n_borrowed];
+}
+
+/*  Function for replacing a borrowed array with a copy that tau owns.        */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Tau_Own_Array(rssringoccs_TAUObj *tau, double **ptr,
+                          unsigned long start, unsigned long len)
+{
+    double *copy;
+    unsigned int n;
+
+    if ((tau == NULL) || (ptr == NULL))
+        return;
+
+    n = __borrowed_index(tau, *ptr);
+
+    /*  tau owns *ptr already.                                                */
+    if (n == tau->n_borrowed)
+        return;
+
+    copy = (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(*copy) * len);
+
+    if (copy == NULL)
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\trssringoccs_Tau_Own_Array\n\n"
+            "\rMalloc failed and returned NULL. Returning.\n\n"
+        );
+        return;
+    }
+
+    memcpy(copy, *ptr + start, sizeof(*copy) * len);
+    *ptr = copy;
+    __drop_borrowed(tau, n);
+}
+/*  End of rssringoccs_Tau_Own_Array.                                         */
+
+/*  Function for replacing a borrowed complex array with a copy tau owns.     */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Tau_Own_CArray(rssringoccs_TAUObj *tau,
+                           rssringoccs_ComplexDouble **ptr,
+                           unsigned long start, unsigned long len)
+{
+    rssringoccs_ComplexDouble *copy;
+    unsigned int n;
+
+    if ((tau == NULL) || (ptr == NULL))
+        return;
+
+    n = __borrowed_index(tau, *ptr);
+
+    /*  tau owns *ptr already.                                                */
+    if (n == tau->n_borrowed)
+        return;
+
+    copy = (rssringoccs_ComplexDouble *)
+        rssringoccs_Tau_Arena_Alloc(tau, sizeof(*copy) * len);
+
+    if (copy == NULL)
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\trssringoccs_Tau_Own_CArray\n\n"
+            "\rMalloc failed and returned NULL. Returning.\n\n"
+        );
+        return;
+    }
+
+    memcpy(copy, *ptr + start, sizeof(*copy) * len);
+    *ptr = copy;
+    __drop_borrowed(tau, n);
+}
+/*  End of rssringoccs_Tau_Own_CArray.                                        */
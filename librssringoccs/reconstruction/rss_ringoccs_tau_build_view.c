@@ -0,0 +1,176 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                        rss_ringoccs_tau_build_view                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Store the diffracted data of a tau object as separate arrays for the  *
+ *      real and imaginary parts.                                             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Build_View:                                           *
+ *  Purpose:                                                                  *
+ *      Copies tau->T_in into tau->T_in_re and tau->T_in_im, and into         *
+ *      tau->T_in_re_f and tau->T_in_im_f in single precision.                *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      The Fresnel transforms sum the product of the Fresnel kernel with     *
+ *      T_in across the window. T_in is an array of complex numbers, so the   *
+ *      real and imaginary parts are interleaved in memory. With the parts in *
+ *      their own arrays every load in the Riemann sum is contiguous, which   *
+ *      is what the vectorized loops in rssringoccs_Fresnel_Riemann_Block     *
+ *      work best with. The window always spans a contiguous range of         *
+ *      indices, so rho_km_vals and phi_rad_vals already have this layout.    *
+ *                                                                            *
+ *      If tau->use_float is set, the single precision transforms read the    *
+ *      float arrays instead, which halves the memory read per point.         *
+ *                                                                            *
+ *      The arrays are allocated on the first call and reused afterwards, so  *
+ *      the function may be called again whenever T_in changes, for example   *
+ *      when T_in is swapped with T_out for the forward model.                *
+ *  NOTES:                                                                    *
+ *      1.) If tau->use_view is false, or T_in is NULL, the double arrays are *
+ *          freed and set to NULL. The transforms then read T_in directly.    *
+ *          Likewise for the float arrays and tau->use_float.                 *
+ *      2.) This function sets the tau->error_occured Boolean to true if      *
+ *          malloc fails.                                                     *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for realloc and free.             *
+ *  2.) rss_ringoccs_complex.h:                                               *
+ *          Header file containing the real and imaginary part functions.     *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file containing the rssringoccs_TAUObj typedef.            *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  Function for splitting T_in into real and imaginary parts.                */
+RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Build_View(rssringoccs_TAUObj *tau)
+{
+    /*  Variable for indexing.                                                */
+    unsigned long n;
+
+    /*  Temporary pointers for checking realloc.                              */
+    double *T_re, *T_im;
+    float *T_re_f, *T_im_f;
+    double re, im;
+
+    /*  If the tau pointer is NULL we can't access it. Return.                */
+    if (tau == NULL)
+        return;
+
+    /*  Don't do anything if an error occurred earlier.                       */
+    if (tau->error_occurred)
+        return;
+
+    /*  If the float arrays are not wanted, or there is no data, make sure    *
+     *  the old arrays are not used by the transforms.                        */
+    if ((!tau->use_float) || (tau->T_in == NULL) || (tau->arr_size == 0))
+    {
+        free(tau->T_in_re_f);
+        free(tau->T_in_im_f);
+        tau->T_in_re_f = NULL;
+        tau->T_in_im_f = NULL;
+    }
+    else
+    {
+        T_re_f = (float *)realloc(tau->T_in_re_f,
+                                  sizeof(*T_re_f) * tau->arr_size);
+        if (T_re_f != NULL)
+            tau->T_in_re_f = T_re_f;
+
+        T_im_f = (float *)realloc(tau->T_in_im_f,
+                                  sizeof(*T_im_f) * tau->arr_size);
+        if (T_im_f != NULL)
+            tau->T_in_im_f = T_im_f;
+
+        if ((T_re_f == NULL) || (T_im_f == NULL))
+        {
+            tau->error_occurred = rssringoccs_True;
+            tau->error_message = rssringoccs_strdup(
+                "\n\rError Encountered: rss_ringoccs\n"
+                "\r\trssringoccs_Tau_Build_View\n\n"
+                "\rMalloc failed and returned NULL for T_in_re_f or\n"
+                "\rT_in_im_f. Returning.\n\n"
+            );
+            return;
+        }
+
+        for (n = 0; n < tau->arr_size; ++n)
+        {
+            re = rssringoccs_CDouble_Real_Part(tau->T_in[n]);
+            im = rssringoccs_CDouble_Imag_Part(tau->T_in[n]);
+            tau->T_in_re_f[n] = (float)re;
+            tau->T_in_im_f[n] = (float)im;
+        }
+    }
+
+    /*  If the view is not wanted, or there is no data, make sure the old     *
+     *  arrays are not used by the transforms.                                */
+    if ((!tau->use_view) || (tau->T_in == NULL) || (tau->arr_size == 0))
+    {
+        free(tau->T_in_re);
+        free(tau->T_in_im);
+        tau->T_in_re = NULL;
+        tau->T_in_im = NULL;
+        return;
+    }
+
+    T_re = (double *)realloc(tau->T_in_re, sizeof(*T_re) * tau->arr_size);
+    if (T_re != NULL)
+        tau->T_in_re = T_re;
+
+    T_im = (double *)realloc(tau->T_in_im, sizeof(*T_im) * tau->arr_size);
+    if (T_im != NULL)
+        tau->T_in_im = T_im;
+
+    if ((T_re == NULL) || (T_im == NULL))
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\trssringoccs_Tau_Build_View\n\n"
+            "\rMalloc failed and returned NULL for T_in_re or T_in_im.\n"
+            "\rReturning.\n\n"
+        );
+        return;
+    }
+
+    for (n = 0; n < tau->arr_size; ++n)
+    {
+        tau->T_in_re[n] = rssringoccs_CDouble_Real_Part(tau->T_in[n]);
+        tau->T_in_im[n] = rssringoccs_CDouble_Imag_Part(tau->T_in[n]);
+    }
+}
+/*  End of rssringoccs_Tau_Build_View.                                        */
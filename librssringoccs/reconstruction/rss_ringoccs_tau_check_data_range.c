@@ -82,7 +82,6 @@
 
 /*  Include the necessary header files.                                       */
 #include <stdlib.h>
-#include <stdio.h>
 #include <rss_ringoccs/include/rss_ringoccs_bool.h>
 #include <rss_ringoccs/include/rss_ringoccs_string.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
@@ -157,17 +156,16 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Check_Data_Range(rssringoccs_TAUObj *ta
                 "\rrequested region has points with a window width that go\n"
                 "\rbeyond the minimum radius you have. Returning.\n"
             );
-            printf("%lu %lu\n", n, nw_pts);
             return;
         }
 
-        /*  The largest radius needed for the window corresponds to the       *
+        /*  The largest index needed for the window corresponds to the        *
          *  current point plus the number of points in the window.            */
         current_max = n + nw_pts;
 
-        /*  If max_requested goes between the size of the array, we have      *
-         *  illegal values. Return with error.                                */
-        if (current_max > tau->arr_size)
+        /*  The window is 2*nw_pts+1 points wide, so current_max is an index  *
+         *  the window reads and must be less than the size of the array.     */
+        if (current_max >= tau->arr_size)
         {
             tau->error_occurred = rssringoccs_True;
             tau->error_message = rssringoccs_strdup(
@@ -177,7 +175,6 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Check_Data_Range(rssringoccs_TAUObj *ta
                 "\rrequested region has points with a window width that go\n"
                 "\rbeyond the maximum radius you have. Returning.\n"
             );
-            printf("%lu %lu\n", n, nw_pts);
             return;
         }
     }
@@ -87,6 +87,15 @@
 #include <rss_ringoccs/include/rss_ringoccs_string.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
+/*  Reverses tau->var in place. If the array is borrowed from the DLP, it is  *
+ *  copied first, since the DLP is never written to.                          */
+#define __REVERSE_TAU_VAR__(var)                                               \
+    rssringoccs_Tau_Own_Array(tau, &tau->var, 0, tau->arr_size);               \
+    if (tau->error_occurred)                                                   \
+        return;                                                                \
+                                                                               \
+    rssringoccs_Reverse_Double_Array(tau->var, tau->arr_size);
+
 /*  Function for determining the type of occultation of a tau object.         */
 RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Check_Occ_Type(rssringoccs_TAUObj *tau)
 {
@@ -194,6 +203,12 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Check_Occ_Type(rssringoccs_TAUObj *tau)
      *  of rho_dot_kms_vals. Compute this and store in the tau object.        */
     else if ((tau->dx_km > 0.0) && (max_val < 0.0))
     {
+        /*  If rho_dot_kms_vals is borrowed from the DLP, copy it first.      */
+        rssringoccs_Tau_Own_Array(tau, &tau->rho_dot_kms_vals,
+                                  0, tau->arr_size);
+        if (tau->error_occurred)
+            return;
+
         for(n=0; n<tau->arr_size; ++n)
             tau->rho_dot_kms_vals[n]
                 = rssringoccs_Double_Abs(tau->rho_dot_kms_vals[n]);
@@ -222,30 +237,28 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Check_Occ_Type(rssringoccs_TAUObj *tau)
      *  safely assume ingress with the data decreasing in radius. Reverse the *
      *  data to be increasing in radius and compute the absolute value of     *
      *  rho_dot_kms_vals. rssringoccs_Reverse_Double_Array is found in        *
-     *  in rss_ringoccs_math.h.                                               */
+     *  in rss_ringoccs_math.h. The __REVERSE_TAU_VAR__ macro copies the      *
+     *  arrays borrowed from the DLP before reversing them.                   */
     else if (tau->dx_km < 0.0)
     {
-        rssringoccs_Reverse_Double_Array(tau->rho_km_vals,      tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->phi_rad_vals,     tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->B_rad_vals,       tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->D_km_vals,        tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->phase_rad_vals,   tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->p_norm_vals,      tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->f_sky_hz_vals,    tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->rho_dot_kms_vals, tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->t_oet_spm_vals,   tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->t_ret_spm_vals,   tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->t_set_spm_vals,   tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->phi_rl_rad_vals,  tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->rx_km_vals,       tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->ry_km_vals,       tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->rz_km_vals,       tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->raw_tau_threshold_vals,
-                                         tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->rho_corr_pole_km_vals,
-                                         tau->arr_size);
-        rssringoccs_Reverse_Double_Array(tau->rho_corr_timing_km_vals,
-                                         tau->arr_size);
+        __REVERSE_TAU_VAR__(rho_km_vals)
+        __REVERSE_TAU_VAR__(phi_rad_vals)
+        __REVERSE_TAU_VAR__(B_rad_vals)
+        __REVERSE_TAU_VAR__(D_km_vals)
+        __REVERSE_TAU_VAR__(phase_rad_vals)
+        __REVERSE_TAU_VAR__(p_norm_vals)
+        __REVERSE_TAU_VAR__(f_sky_hz_vals)
+        __REVERSE_TAU_VAR__(rho_dot_kms_vals)
+        __REVERSE_TAU_VAR__(t_oet_spm_vals)
+        __REVERSE_TAU_VAR__(t_ret_spm_vals)
+        __REVERSE_TAU_VAR__(t_set_spm_vals)
+        __REVERSE_TAU_VAR__(phi_rl_rad_vals)
+        __REVERSE_TAU_VAR__(rx_km_vals)
+        __REVERSE_TAU_VAR__(ry_km_vals)
+        __REVERSE_TAU_VAR__(rz_km_vals)
+        __REVERSE_TAU_VAR__(raw_tau_threshold_vals)
+        __REVERSE_TAU_VAR__(rho_corr_pole_km_vals)
+        __REVERSE_TAU_VAR__(rho_corr_timing_km_vals)
 
         for(n=0; n<tau->arr_size; ++n)
             tau->rho_dot_kms_vals[n]
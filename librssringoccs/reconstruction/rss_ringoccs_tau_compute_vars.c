@@ -45,7 +45,9 @@
  *  for a member of a tau object and then checks if malloc failed.            */
 #define MALLOC_TAU_MEMBER(var, type)                                           \
     /*  Allocate memory for the variable.                                    */\
-    tau->var = (type)malloc(sizeof(*tau->var) * tau->arr_size);                \
+    tau->var = (type)rssringoccs_Tau_Arena_Alloc(                              \
+        tau, sizeof(*tau->var) * tau->arr_size                                 \
+    );                                                                         \
                                                                                \
     /*  Check if malloc failed.                                              */\
     if (tau->var == NULL)                                                      \
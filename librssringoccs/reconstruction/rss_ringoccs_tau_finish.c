@@ -1,17 +1,34 @@
 
 #include <stdlib.h>
+#include <string.h>
 #include <rss_ringoccs/include/rss_ringoccs_math.h>
 #include <rss_ringoccs/include/rss_ringoccs_complex.h>
 #include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
 
-static void __resize_array(double **ptr, unsigned long start, unsigned long len)
+/*  Shrinks an array to the len entries starting at start. Arrays in the      *
+ *  arena are shifted in place, since the arena is freed all at once, and     *
+ *  borrowed arrays are copied, since they are not tau's.                     */
+static void __resize_array(rssringoccs_TAUObj *tau, double **ptr,
+                           unsigned long start, unsigned long len)
 {
     double *temp, *data;
     unsigned long n;
-    temp = (double *)malloc(sizeof(*temp) * len);
-
     data = *ptr;
 
+    if (rssringoccs_Tau_Is_Borrowed(tau, data))
+    {
+        rssringoccs_Tau_Own_Array(tau, ptr, start, len);
+        return;
+    }
+
+    if (rssringoccs_Tau_Arena_Owns(tau, data))
+    {
+        memmove(data, data + start, sizeof(*data) * len);
+        return;
+    }
+
+    temp = (double *)malloc(sizeof(*temp) * len);
+
     for (n = 0; n < len; ++n)
         temp[n] = data[start + n];
 
@@ -19,20 +36,36 @@ static void __resize_array(double **ptr, unsigned long start, unsigned long len)
     *ptr = temp;
 }
 
-static void __resize_carray(rssringoccs_ComplexDouble **ptr,
+static void __resize_carray(rssringoccs_TAUObj *tau,
+                            rssringoccs_ComplexDouble **ptr,
                             unsigned long start, unsigned long len)
 {
     rssringoccs_ComplexDouble *temp, *data;
     unsigned long n;
-    temp = (rssringoccs_ComplexDouble *)malloc(sizeof(*temp) * len);
     data = *ptr;
 
+    /*  rssringoccs_Reconstruction_Multi_Res lends T_in to each resolution.   */
+    if (rssringoccs_Tau_Is_Borrowed(tau, data))
+    {
+        rssringoccs_Tau_Own_CArray(tau, ptr, start, len);
+        return;
+    }
+
+    if (rssringoccs_Tau_Arena_Owns(tau, data))
+    {
+        memmove(data, data + start, sizeof(*data) * len);
+        return;
+    }
+
+    temp = (rssringoccs_ComplexDouble *)malloc(sizeof(*temp) * len);
+
     for (n = 0; n < len; ++n)
         temp[n] = data[start + n];
 
     free(data);
     *ptr = temp;
 }
+
 RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Finish(rssringoccs_TAUObj* tau)
 {
     double mu, factor;
@@ -42,46 +75,73 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Finish(rssringoccs_TAUObj* tau)
     if (tau == NULL)
         return;
 
+    /*  The view of T_in is only read by the transforms, which are done. It   *
+     *  is allocated outside the arena, and the Python wrapper only keeps the *
+     *  arrays it returns, so free it here, error or not.                     */
+    free(tau->T_in_re);
+    free(tau->T_in_im);
+    free(tau->T_in_re_f);
+    free(tau->T_in_im_f);
+    tau->T_in_re = NULL;
+    tau->T_in_im = NULL;
+    tau->T_in_re_f = NULL;
+    tau->T_in_im_f = NULL;
+
     if (tau->error_occurred)
         return;
 
     len = tau->n_used;
 
-    tau->power_vals         = (double *)malloc(sizeof(*tau->power_vals)         * len);
-    tau->phase_vals         = (double *)malloc(sizeof(*tau->phase_vals)         * len);
-    tau->tau_vals           = (double *)malloc(sizeof(*tau->tau_vals)           * len);
-    tau->tau_threshold_vals = (double *)malloc(sizeof(*tau->tau_threshold_vals) * len);
+    /*  The outputs are taken from the arena, if there is room.               */
+    tau->power_vals =
+        (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
+    tau->phase_vals =
+        (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
+    tau->tau_vals =
+        (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
+    tau->tau_threshold_vals =
+        (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
 
     if (tau->use_fwd)
     {
-        tau->p_norm_fwd_vals = (double *)malloc(sizeof(*tau->p_norm_fwd_vals) * len);
-        tau->phase_fwd_vals  = (double *)malloc(sizeof(*tau->phase_fwd_vals)  * len);
-        tau->tau_fwd_vals    = (double *)malloc(sizeof(*tau->tau_fwd_vals)    * len);
+        tau->p_norm_fwd_vals =
+            (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
+        tau->phase_fwd_vals =
+            (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
+        tau->tau_fwd_vals =
+            (double *)rssringoccs_Tau_Arena_Alloc(tau, sizeof(double) * len);
     }
 
-    __resize_carray(&tau->T_in, tau->start, len);
-    __resize_carray(&tau->T_out, tau->start, len);
+    __resize_carray(tau, &tau->T_in, tau->start, len);
+    __resize_carray(tau, &tau->T_out, tau->start, len);
     if (tau->use_fwd)
-        __resize_carray(&tau->T_fwd, tau->start, len);
-
-    __resize_array(&tau->rho_km_vals, tau->start, len);
-    __resize_array(&tau->F_km_vals, tau->start, len);
-    __resize_array(&tau->phi_rad_vals, tau->start, len);
-    __resize_array(&tau->k_vals, tau->start, len);
-    __resize_array(&tau->f_sky_hz_vals, tau->start, len);
-    __resize_array(&tau->rho_dot_kms_vals, tau->start, len);
-    __resize_array(&tau->raw_tau_threshold_vals, tau->start, len);
-    __resize_array(&tau->B_rad_vals, tau->start, len);
-    __resize_array(&tau->D_km_vals, tau->start, len);
-    __resize_array(&tau->w_km_vals, tau->start, len);
-    __resize_array(&tau->t_oet_spm_vals, tau->start, len);
-    __resize_array(&tau->t_ret_spm_vals, tau->start, len);
-    __resize_array(&tau->t_set_spm_vals, tau->start, len);
-    __resize_array(&tau->rho_corr_pole_km_vals, tau->start, len);
-    __resize_array(&tau->rho_corr_timing_km_vals, tau->start, len);
-    __resize_array(&tau->phi_rl_rad_vals, tau->start, len);
-    __resize_array(&tau->p_norm_vals, tau->start, len);
-    __resize_array(&tau->phase_rad_vals, tau->start, len);
+        __resize_carray(tau, &tau->T_fwd, tau->start, len);
+
+    __resize_array(tau, &tau->rho_km_vals, tau->start, len);
+    __resize_array(tau, &tau->F_km_vals, tau->start, len);
+    __resize_array(tau, &tau->phi_rad_vals, tau->start, len);
+    __resize_array(tau, &tau->k_vals, tau->start, len);
+    __resize_array(tau, &tau->f_sky_hz_vals, tau->start, len);
+    __resize_array(tau, &tau->rho_dot_kms_vals, tau->start, len);
+    __resize_array(tau, &tau->raw_tau_threshold_vals, tau->start, len);
+    __resize_array(tau, &tau->B_rad_vals, tau->start, len);
+    __resize_array(tau, &tau->D_km_vals, tau->start, len);
+    __resize_array(tau, &tau->w_km_vals, tau->start, len);
+    __resize_array(tau, &tau->t_oet_spm_vals, tau->start, len);
+    __resize_array(tau, &tau->t_ret_spm_vals, tau->start, len);
+    __resize_array(tau, &tau->t_set_spm_vals, tau->start, len);
+    __resize_array(tau, &tau->rho_corr_pole_km_vals, tau->start, len);
+    __resize_array(tau, &tau->rho_corr_timing_km_vals, tau->start, len);
+    __resize_array(tau, &tau->phi_rl_rad_vals, tau->start, len);
+    __resize_array(tau, &tau->p_norm_vals, tau->start, len);
+    __resize_array(tau, &tau->phase_rad_vals, tau->start, len);
+    __resize_array(tau, &tau->rx_km_vals, tau->start, len);
+    __resize_array(tau, &tau->ry_km_vals, tau->start, len);
+    __resize_array(tau, &tau->rz_km_vals, tau->start, len);
+
+    /*  rssringoccs_Tau_Own_Array sets error_occurred if a copy failed.       */
+    if (tau->error_occurred)
+        return;
 
     factor = rssringoccs_Double_Log(tau->dx_km / tau->res);
 
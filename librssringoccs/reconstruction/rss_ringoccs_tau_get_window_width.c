@@ -109,7 +109,8 @@ RSS_RINGOCCS_EXPORT void rssringoccs_Tau_Get_Window_Width(rssringoccs_TAUObj* ta
     /*  Use calloc to both allocate memory for tau.w_km_vals (like malloc)    *
      *  and initialize the data to zero (unlike malloc). This is similar to   *
      *  numpy.zeros(tau.arr_size) in Python.                                  */
-    tau->w_km_vals = (double *)calloc(tau->arr_size, sizeof(double));
+    tau->w_km_vals = (double *)rssringoccs_Tau_Arena_Calloc(tau, tau->arr_size,
+                                                            sizeof(double));
 
     if (tau->bfac)
     {
@@ -0,0 +1,254 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                        rss_ringoccs_tau_run_range                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Run a reconstruction routine over the points of a tau object, either  *
+ *      on a single thread or split into chunks across several threads.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Tau_Run_Range:                                            *
+ *  Purpose:                                                                  *
+ *      Reconstructs the n_samples points starting at tau->start.             *
+ *  Arguments:                                                                *
+ *      tau (rssringoccs_TAUObj *):                                           *
+ *          A pointer to a rssringoccs_TAUObj.                                *
+ *      range_func (rssringoccs_TauRangeFunc):                                *
+ *          Function that reconstructs a contiguous block of points. It is    *
+ *          given the first index, the number of points, and the index where  *
+ *          the window function in effect at the first index was computed.    *
+ *      n_samples (unsigned long):                                            *
+ *          The number of points to reconstruct.                              *
+ *      two_dx (double):                                                      *
+ *          Twice the sample spacing used by range_func. The window function  *
+ *          is recomputed when the window width drifts by more than this.     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      If tau->num_threads is 0 or 1, or if rss_ringoccs was built without   *
+ *      OpenMP, range_func is called once on the entire range. Otherwise the  *
+ *      range is cut into contiguous chunks of roughly equal cost, several    *
+ *      per thread, and the threads take chunks from a shared queue as they   *
+ *      finish the previous one (OpenMP dynamic scheduling).                  *
+ *                                                                            *
+ *      The cost of a point is proportional to the number of points in its    *
+ *      window, w_km_vals[n] / two_dx + 1. Near the planet the window may be  *
+ *      10 to 100 times wider than in the outer rings, so splitting by the    *
+ *      number of points would leave most threads idle while one finishes.    *
+ *                                                                            *
+ *      The reconstruction routines only recompute the window function when   *
+ *      the width drifts by more than two_dx from the last width used, so the *
+ *      window in effect at a given point depends on every point before it.   *
+ *      To keep the output bit-for-bit identical to the single threaded run,  *
+ *      this history is replayed once on the calling thread. Every chunk is   *
+ *      then told where its starting window was computed. Since each output   *
+ *      T_out[n] depends only on the input data and this window, the chunks   *
+ *      are independent and may be run in any order.                          *
+ *                                                                            *
+ *      Chunks only start at multiples of RSSRINGOCCS_TAU_BLOCK_LENGTH points *
+ *      from tau->start. Routines that carry state from one point to the next *
+ *      (such as warm started Newton-Raphson) reset it at these points, so    *
+ *      they too give the same output for any number of threads.              *
+ *  NOTES:                                                                    *
+ *      1.) This function sets the tau->error_occurred Boolean to true if any *
+ *          call to range_func fails. range_func may set tau->error_message   *
+ *          itself when it is run on the calling thread. Otherwise a generic  *
+ *          message is used.                                                  *
+ *      2.) range_func must only write to T_out at the indices it was given,  *
+ *          and must allocate its own scratch memory.                         *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) rss_ringoccs_math.h:                                                  *
+ *          Header file containing fabs.                                      *
+ *  3.) rss_ringoccs_string.h:                                                *
+ *          Header file containing rssringoccs_strdup.                        *
+ *  4.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file containing the rssringoccs_TAUObj typedef.            *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <rss_ringoccs/include/rss_ringoccs_string.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  Number of chunks handed out per thread. Smaller chunks balance the load   *
+ *  better, but each chunk must allocate its own window function.             */
+#define RSSRINGOCCS_TAU_CHUNKS_PER_THREAD 16UL
+
+/*  Function for running a reconstruction routine across a tau object.        */
+RSS_RINGOCCS_EXPORT void
+rssringoccs_Tau_Run_Range(rssringoccs_TAUObj *tau,
+                          rssringoccs_TauRangeFunc range_func,
+                          unsigned long n_samples, double two_dx)
+{
+    /*  Variables for indexing and for the number of chunks.                  */
+    unsigned long n, n_chunks, max_chunks, w_center;
+
+    /*  OpenMP 2.0 (the version Visual Studio supports) needs a signed index. */
+    long k;
+
+    /*  The window width last used when the window function was computed.     */
+    double w_init;
+
+    /*  The estimated cost of all points, and of the points before n.         */
+    double total_cost, cost;
+
+    /*  The starting index of each chunk, and where its window was computed.  */
+    unsigned long *first, *w_start;
+
+    /*  Boolean for each chunk for whether or not it succeeded.               */
+    rssringoccs_Bool *success;
+    rssringoccs_Bool failed;
+
+    /*  If the tau pointer is NULL we can't access it. Return.                */
+    if (tau == NULL)
+        return;
+
+    /*  Nothing to do if an error occurred earlier, or if there is no data.   */
+    if ((tau->error_occurred) || (n_samples == 0))
+        return;
+
+    /*  Only split the range if we have threads to run the chunks on.         */
+#ifdef _OPENMP
+    if (tau->num_threads > 1)
+        max_chunks = tau->num_threads * RSSRINGOCCS_TAU_CHUNKS_PER_THREAD;
+    else
+        max_chunks = 1;
+#else
+    max_chunks = 1;
+#endif
+
+    if (max_chunks > n_samples)
+        max_chunks = n_samples;
+
+    /*  Single threaded run. The window starts at tau->start.                 */
+    if (max_chunks <= 1)
+    {
+        if (!range_func(tau, tau->start, n_samples, tau->start))
+        {
+            tau->error_occurred = rssringoccs_True;
+            if (tau->error_message == NULL)
+                tau->error_message = rssringoccs_strdup(
+                    "\n\rError Encountered: rss_ringoccs\n"
+                    "\r\trssringoccs_Tau_Run_Range\n\n"
+                    "\rThe reconstruction range function failed. Returning.\n\n"
+                );
+        }
+        return;
+    }
+
+    first   = (unsigned long *)malloc(sizeof(*first) * (max_chunks + 1));
+    w_start = (unsigned long *)malloc(sizeof(*w_start) * max_chunks);
+    success = (rssringoccs_Bool *)malloc(sizeof(*success) * max_chunks);
+
+    if ((first == NULL) || (w_start == NULL) || (success == NULL))
+    {
+        tau->error_occurred = rssringoccs_True;
+        tau->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\trssringoccs_Tau_Run_Range\n\n"
+            "\rMalloc failed and returned NULL. Returning.\n\n"
+        );
+
+        /*  free does nothing if the input is NULL, so this is safe.          */
+        free(first);
+        free(w_start);
+        free(success);
+        return;
+    }
+
+    /*  The work done at a point is proportional to its window size.          */
+    total_cost = 0.0;
+    for (n = tau->start; n < tau->start + n_samples; ++n)
+        total_cost += tau->w_km_vals[n] / two_dx + 1.0;
+
+    /*  Replay the window resets the single threaded loop performs, starting  *
+     *  a new chunk each time the running cost passes the next multiple of    *
+     *  total_cost / max_chunks. The window in effect at the start of a chunk *
+     *  is the one in effect after the previous point, so record it before    *
+     *  checking the drift. A very expensive point may pass several multiples *
+     *  at once, in which case fewer than max_chunks chunks are made.         */
+    w_center = tau->start;
+    w_init   = tau->w_km_vals[w_center];
+    cost     = 0.0;
+    n_chunks = 0;
+
+    for (n = tau->start; n < tau->start + n_samples; ++n)
+    {
+        if ((n_chunks == 0) ||
+            ((n_chunks < max_chunks) &&
+             ((n - tau->start) % RSSRINGOCCS_TAU_BLOCK_LENGTH == 0) &&
+             (cost >= total_cost * (double)n_chunks / (double)max_chunks)))
+        {
+            first[n_chunks]   = n;
+            w_start[n_chunks] = w_center;
+            ++n_chunks;
+        }
+
+        cost += tau->w_km_vals[n] / two_dx + 1.0;
+
+        if (fabs(w_init - tau->w_km_vals[n]) >= two_dx)
+        {
+            w_init   = tau->w_km_vals[n];
+            w_center = n;
+        }
+    }
+
+    first[n_chunks] = tau->start + n_samples;
+
+    /*  The chunks are independent. Threads take the next chunk as they       *
+     *  finish, so expensive chunks do not hold up the cheap ones.            */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(tau->num_threads) schedule(dynamic, 1)
+#endif
+    for (k = 0; k < (long)n_chunks; ++k)
+        success[k] = range_func(tau, first[k], first[k+1] - first[k],
+                                w_start[k]);
+
+    failed = rssringoccs_False;
+    for (n = 0; n < n_chunks; ++n)
+    {
+        if (!success[n])
+            failed = rssringoccs_True;
+    }
+
+    if (failed)
+    {
+        tau->error_occurred = rssringoccs_True;
+        if (tau->error_message == NULL)
+            tau->error_message = rssringoccs_strdup(
+                "\n\rError Encountered: rss_ringoccs\n"
+                "\r\trssringoccs_Tau_Run_Range\n\n"
+                "\rThe reconstruction range function failed in one of the\n"
+                "\rthreads. Returning.\n\n"
+            );
+    }
+
+    free(first);
+    free(w_start);
+    free(success);
+}
+/*  End of rssringoccs_Tau_Run_Range.                                         */
@@ -39,6 +39,8 @@ rssringoccs_Tau_Set_Psitype(const char *psitype, rssringoccs_TAUObj* tau)
         tau->psinum = rssringoccs_DR_Elliptical;
     else if (strcmp(tau->psitype, "simplefft") == 0)
         tau->psinum = rssringoccs_DR_SimpleFFT;
+    else if (strcmp(tau->psitype, "blockfft") == 0)
+        tau->psinum = rssringoccs_DR_BlockFFT;
     else if (strcmp(tau->psitype, "quadratic") == 0)
         tau->psinum = rssringoccs_DR_Quadratic;
     else if (strcmp(tau->psitype, "cubic") == 0)
@@ -96,6 +98,7 @@ rssringoccs_Tau_Set_Psitype(const char *psitype, rssringoccs_TAUObj* tau)
             "\r\tnewtondold: Newton-Raphson with the old D algorithm.\n"
             "\r\tnewtondphi: Newton-Raphson with dD/dphi perturbation.\n"
             "\r\tsimplefft:  A single FFT of the entire data set.\n"
+            "\r\tblockfft:   FFTs of blocks with a local Newton kernel.\n"
         );
 
         strcat(errmes1, errmes2);
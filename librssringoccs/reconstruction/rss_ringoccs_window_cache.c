@@ -0,0 +1,256 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *                         rss_ringoccs_window_cache                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Keep the window functions used by the reconstruction routines, so     *
+ *      that each window is computed once.                                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      rssringoccs_Window_Cache_Get:                                         *
+ *  Purpose:                                                                  *
+ *      Returns the window function fw sampled at nw_pts + 1 points.          *
+ *  Arguments:                                                                *
+ *      fw (rssringoccs_window_func):                                         *
+ *          The window function.                                              *
+ *      nw_pts (unsigned long):                                               *
+ *          The number of points in the window. This should be odd.           *
+ *      buffer (double **):                                                   *
+ *          Pointer to an array owned by the caller, which may be NULL. This  *
+ *          is only used if the cache is full.                                *
+ *  Output:                                                                   *
+ *      w_func (const double *):                                              *
+ *          The array w_j = fw(j - (nw_pts+1)/2, nw_pts), j = 0, ..., nw_pts. *
+ *          Returns NULL if malloc fails.                                     *
+ *  Method:                                                                   *
+ *      The reconstruction routines compute the window at x = n dx for a      *
+ *      window width W, and recompute it every time W changes by 2 dx. For    *
+ *      a window of 2h+1 points, h = floor(W / 2 dx), so W is between 2h dx   *
+ *      and (2h+2) dx. The cached window uses the width (2h+1) dx, so that    *
+ *      it depends only on fw and the number of points:                       *
+ *                                                                            *
+ *          fw(n dx, (2h+1) dx) = fw(n, 2h+1)                                 *
+ *                                                                            *
+ *      since every window function depends only on x / W. This moves the     *
+ *      edge of the window by less than one sample, which is less than the    *
+ *      2 dx the window width may already drift before it is recomputed.      *
+ *                                                                            *
+ *      Entries 1 to nw_pts are the window about the center, used by the      *
+ *      Newton-Raphson transforms. The quadratic and Legendre transforms use  *
+ *      the left half of the window, from x = -(h+1) dx to x = -dx, which are *
+ *      entries 0 to h.                                                       *
+ *                                                                            *
+ *      The windows are kept in a hash table keyed by fw and nw_pts, shared   *
+ *      by all threads and all tau objects, and are not freed until           *
+ *      rssringoccs_Window_Cache_Clear is called. Lookups and insertions are  *
+ *      done in an OpenMP critical section.                                   *
+ *  NOTES:                                                                    *
+ *      1.) The arrays are read-only. Do not free them.                       *
+ *      2.) The cache holds at most RSSRINGOCCS_WINDOW_CACHE_MAX_POINTS       *
+ *          doubles. After that, the window is computed in *buffer, which is  *
+ *          realloced as needed. The caller frees *buffer when done with it.  *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Window_Cache_Clear:                                       *
+ *  Purpose:                                                                  *
+ *      Frees all of the cached windows.                                      *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  NOTES:                                                                    *
+ *      1.) Pointers returned by rssringoccs_Window_Cache_Get are not valid   *
+ *          after this, so do not call this while a reconstruction is         *
+ *          running.                                                          *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      rssringoccs_Window_Cache_Is_Thread_Safe:                              *
+ *  Purpose:                                                                  *
+ *      Tells callers, such as the Python bindings, whether reconstructions   *
+ *      may be run on several of their own threads at once.                   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      is_safe (rssringoccs_Bool):                                           *
+ *          True if the cache is locked. The lock is an OpenMP critical       *
+ *          section, which also excludes threads not created by OpenMP, so    *
+ *          this is false when OpenMP is not available.                       *
+ ******************************************************************************
+ *                               DEPENDENCIES                                 *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          C standard library header. Used for malloc and free.              *
+ *  2.) rss_ringoccs_bool.h:                                                  *
+ *          Header file containing rssringoccs_Bool, and True and False.      *
+ *  3.) rss_ringoccs_special_functions.h:                                     *
+ *          Header file containing the rssringoccs_window_func typedef.       *
+ *  4.) rss_ringoccs_reconstruction.h:                                        *
+ *          Header file where these functions are declared.                   *
+ ******************************************************************************/
+
+/*  Include the necessary header files.                                       */
+#include <stdlib.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <rss_ringoccs/include/rss_ringoccs_special_functions.h>
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+
+/*  Number of buckets in the hash table.                                      */
+#define RSSRINGOCCS_WINDOW_CACHE_BUCKETS 256UL
+
+/*  Most doubles stored across all windows, 64 MB.                            */
+#define RSSRINGOCCS_WINDOW_CACHE_MAX_POINTS (1UL << 23)
+
+/*  A cached window, and a pointer to the next one in the same bucket.        */
+typedef struct rssringoccs_WindowCacheEntry {
+    rssringoccs_window_func fw;
+    unsigned long nw_pts;
+    double *w_func;
+    struct rssringoccs_WindowCacheEntry *next;
+} rssringoccs_WindowCacheEntry;
+
+static rssringoccs_WindowCacheEntry
+*__window_cache[RSSRINGOCCS_WINDOW_CACHE_BUCKETS];
+
+/*  The number of doubles stored across all windows.                          */
+static unsigned long __window_cache_points = 0;
+
+/*  Computes w_j = fw(j - (nw_pts+1)/2, nw_pts) for j = 0, ..., nw_pts.       */
+static void
+__compute_window(rssringoccs_window_func fw, unsigned long nw_pts,
+                 double *w_func)
+{
+    unsigned long j;
+    double half, width;
+
+    half  = (double)((nw_pts + 1) / 2);
+    width = (double)nw_pts;
+
+    for (j = 0; j <= nw_pts; ++j)
+        w_func[j] = fw((double)j - half, width);
+}
+
+/*  Function for getting a window function from the cache.                    */
+RSS_RINGOCCS_EXPORT const double *
+rssringoccs_Window_Cache_Get(rssringoccs_window_func fw, unsigned long nw_pts,
+                             double **buffer)
+{
+    unsigned long bucket;
+    double *tmp;
+    const double *w_func;
+    rssringoccs_WindowCacheEntry *entry;
+
+    bucket = nw_pts % RSSRINGOCCS_WINDOW_CACHE_BUCKETS;
+    w_func = NULL;
+
+#ifdef _OPENMP
+#pragma omp critical (rssringoccs_window_cache)
+#endif
+    {
+        for (entry = __window_cache[bucket]; entry != NULL; entry = entry->next)
+        {
+            if ((entry->fw == fw) && (entry->nw_pts == nw_pts))
+            {
+                w_func = entry->w_func;
+                break;
+            }
+        }
+
+        /*  Not found. Compute the window and add it, if there is room.       */
+        if ((w_func == NULL) &&
+            (__window_cache_points + nw_pts + 1 <=
+             RSSRINGOCCS_WINDOW_CACHE_MAX_POINTS))
+        {
+            entry = (rssringoccs_WindowCacheEntry *)malloc(sizeof(*entry));
+            tmp = (double *)malloc(sizeof(*tmp) * (nw_pts + 1));
+
+            if ((entry != NULL) && (tmp != NULL))
+            {
+                __compute_window(fw, nw_pts, tmp);
+                entry->fw     = fw;
+                entry->nw_pts = nw_pts;
+                entry->w_func = tmp;
+                entry->next   = __window_cache[bucket];
+                __window_cache[bucket] = entry;
+                __window_cache_points += nw_pts + 1;
+                w_func = tmp;
+            }
+            else
+            {
+                free(entry);
+                free(tmp);
+            }
+        }
+    }
+
+    if (w_func != NULL)
+        return w_func;
+
+    /*  The cache is full, or malloc failed. Use the caller's buffer.         */
+    tmp = (double *)realloc(*buffer, sizeof(*tmp) * (nw_pts + 1));
+    if (tmp == NULL)
+        return NULL;
+
+    *buffer = tmp;
+    __compute_window(fw, nw_pts, tmp);
+    return tmp;
+}
+/*  End of rssringoccs_Window_Cache_Get.                                      */
+
+/*  Function for freeing all of the cached windows.                           */
+RSS_RINGOCCS_EXPORT void rssringoccs_Window_Cache_Clear(void)
+{
+    unsigned long bucket;
+    rssringoccs_WindowCacheEntry *entry, *next;
+
+#ifdef _OPENMP
+#pragma omp critical (rssringoccs_window_cache)
+#endif
+    {
+        for (bucket = 0; bucket < RSSRINGOCCS_WINDOW_CACHE_BUCKETS; ++bucket)
+        {
+            entry = __window_cache[bucket];
+            while (entry != NULL)
+            {
+                next = entry->next;
+                free(entry->w_func);
+                free(entry);
+                entry = next;
+            }
+
+            __window_cache[bucket] = NULL;
+        }
+
+        __window_cache_points = 0;
+    }
+}
+/*  End of rssringoccs_Window_Cache_Clear.                                    */
+
+/*  Function for checking if the cache may be used by several threads.        */
+RSS_RINGOCCS_EXPORT rssringoccs_Bool
+rssringoccs_Window_Cache_Is_Thread_Safe(void)
+{
+#ifdef _OPENMP
+    return rssringoccs_True;
+#else
+    return rssringoccs_False;
+#endif
+}
+/*  End of rssringoccs_Window_Cache_Is_Thread_Safe.                           */
@@ -39,6 +39,16 @@
  *              _diffraction_correction.c and the associated header file      *
  *              _diffraction_correction.h for more information on the         *
  *              algorithms implemented.                                       *
+ *              The GIL is released while the reconstruction runs, so several *
+ *              instances may be computed at once on Python threads.          *
+ *              C-contiguous float64 arrays of the DLP are used in place,     *
+ *              and are not copied. The num_threads keyword splits the        *
+ *              reconstruction of one instance across that many threads.     *
+ *          DiffractionCorrectionAsync:                                       *
+ *              Takes the same arguments as DiffractionCorrection, and an     *
+ *              optional executor keyword. Submits DiffractionCorrection to   *
+ *              the executor, or to a thread pool shared by the module if     *
+ *              none is given, and returns a concurrent.futures.Future.       *
  *          gap_diffraction:                                                  *
  *              A diffraction modeling tool which returns the diffraction     *
  *              profile of a gap, which has 0 complex amplitude everywhere    *
@@ -203,6 +213,14 @@
 #include "rss_ringoccs_Get_Py_Range.c"
 #include "rss_ringoccs_Get_Py_Vars_From_Self.c"
 
+/*  Without OpenMP the window cache in librssringoccs is not locked, and this *
+ *  lock lets only one reconstruction run at a time. It is NULL otherwise.    */
+static PyThread_type_lock diffrec_lock = NULL;
+
+/*  The thread pool used by DiffractionCorrectionAsync if no executor is      *
+ *  given. It is created on first use.                                        */
+static PyObject *diffrec_executor = NULL;
+
 /*  Deallocating function for the DiffractionCorrection class.                */
 static void Diffrec_dealloc(PyDiffrecObj *self)
 {
@@ -275,6 +293,7 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
         "ecc",
         "peri",
         "perturb",
+        "num_threads",
         NULL
     };
 
@@ -285,6 +304,12 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
     PyObject *rngreq;
     PyObject *perturb;
 
+    /*  Holds the DLP arrays while C has pointers to their data.              */
+    PyObject *pinned;
+
+    /*  Parsed as a signed int so that negative values can be rejected.       */
+    int num_threads;
+
     /*  Set the default keyword options.                                      */
 
     /*  The kbmd20 is a new window, a modifed Kaiser-Bessel with alpha set to *
@@ -339,6 +364,10 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
     /*  Default polynomial perturbation is off.                               */
     perturb = NULL;
 
+    /*  Reconstruct on one thread unless more are requested. The output does  *
+     *  not depend on the number of threads.                                  */
+    num_threads = 1;
+
     /*  Extract the inputs and keywords supplied by the user. If the data     *
      *  cannot be extracted, raise a type error and return to caller. A short *
      *  explaination of PyArg_ParseTupleAndKeywords. The inputs args and kwds *
@@ -350,9 +379,9 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
      *  DiffractionCorrect(..., wtype="blah"). O indicates a Python object,   *
      *  and d is a Python float. This is the DLP and res variables. The $     *
      *  symbold means everything after is optional. s is a string, p is a     *
-     *  Boolean (p for "predicate"). b is an integer, and the colon : denotes *
-     *  that the input list has ended.                                        */
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|Od$OsppppdspdddO:", kwlist,
+     *  Boolean (p for "predicate"). b is an integer, as is i, and the colon  *
+     *  : denotes that the input list has ended.                              */
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|Od$OsppppdspdddOi:", kwlist,
                                      &DLPInst,          &self->input_res,
                                      &rngreq,           &self->wtype,
                                      &self->use_fwd,    &self->use_norm,
@@ -360,7 +389,7 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
                                      &self->sigma,      &self->psitype,
                                      &self->write_file, &self->res_factor,
                                      &self->ecc,        &self->peri,
-                                     &perturb))
+                                     &perturb,          &num_threads))
     {
         PyErr_Format(
             PyExc_TypeError,
@@ -384,10 +413,24 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
             "\r\tecc       \tEccentricity of rings (bool).\n"
             "\r\tperi      \tPeriapse of rings (bool).\n"
             "\r\tperturb   \tRequested perturbation to Fresnel kernel (list).\n"
+            "\r\tnum_threads\tNumber of threads to reconstruct with (int).\n"
         );
         return -1;
     }
 
+    if (num_threads < 1)
+    {
+        PyErr_Format(
+            PyExc_ValueError,
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\tdiffrec.DiffractionCorrection\n\n"
+            "\rnum_threads must be a positive integer.\n\n"
+        );
+        return -1;
+    }
+
+    self->num_threads = (unsigned int)num_threads;
+
     if (self->verbose)
     {
         puts("Diffraction Correction:");
@@ -442,10 +485,15 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
     if (self->verbose)
         puts("\tDiffraction Correction: Converting Py DLP to C DLP...");
 
-    dlp = rssringoccs_Py_DLP_to_C_DLP(DLPInst);
+    pinned = PyList_New(0);
+    if (pinned == NULL)
+        return -1;
+
+    dlp = rssringoccs_Py_DLP_to_C_DLP(DLPInst, pinned);
 
     if (dlp == NULL)
     {
+        Py_DECREF(pinned);
         PyErr_Format(
             PyExc_RuntimeError,
             "\n\rError Encountered: rss_ringoccs\n"
@@ -475,6 +523,7 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
             free(dlp->error_message);
         }
         free(dlp);
+        Py_DECREF(pinned);
         return -1;
     }
 
@@ -482,7 +531,18 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
     if (self->verbose)
         puts("\tDiffraction Correction: Creating C Tau object...");
 
-    tau = rssringoccs_Create_TAUObj(dlp, self->input_res * self->res_factor);
+    /*  tau points at the data of the numpy arrays rather than copying it.    *
+     *  The arrays are held by pinned, so other Python threads may run while  *
+     *  the data is checked.                                                  */
+    Py_BEGIN_ALLOW_THREADS
+    tau = rssringoccs_Create_TAUObj_Borrowed(
+        dlp, self->input_res * self->res_factor
+    );
+    Py_END_ALLOW_THREADS
+
+    /*  Only the pointers in dlp are freed, not the data from the input DLP   *
+     *  PyObject, which tau still uses. pinned is released after tau is done. */
+    free(dlp);
 
     if (self->verbose)
         puts("\tDiffraction Correction: Passing Py variables to tau...");
@@ -496,13 +556,28 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
     if (self->verbose)
         puts("\tDiffraction Correction: Running reconstruction...");
 
+    /*  Only this thread has tau, so the GIL is released while the            *
+     *  reconstruction runs. The lock is taken without the GIL, so a thread   *
+     *  waiting for it does not stop the others.                              */
+    Py_BEGIN_ALLOW_THREADS
+    if (diffrec_lock != NULL)
+        PyThread_acquire_lock(diffrec_lock, WAIT_LOCK);
+
     rssringoccs_Reconstruction(tau);
 
+    if (diffrec_lock != NULL)
+        PyThread_release_lock(diffrec_lock);
+    Py_END_ALLOW_THREADS
+
     if (self->verbose)
         puts("\tDiffraction Correction: Converting C tau to Py tau...");
 
     rssringoccs_C_Tau_to_Py_Tau(self, tau);
 
+    /*  rssringoccs_Tau_Finish copied the data that is used, so tau no longer *
+     *  points at the arrays of the DLP.                                      */
+    Py_DECREF(pinned);
+
     if (tau == NULL)
     {
         PyErr_Format(
@@ -541,10 +616,6 @@ static int Diffrec_init(PyDiffrecObj *self, PyObject *args, PyObject *kwds)
      *  data is still available in self.                                      */
     free(tau);
 
-    /*  Similarly, we free the DLP. This does not free the data from the      *
-     *  input DLP PyObject. Those are also still available.                   */
-    free(dlp);
-
     if (self->verbose)
         puts("\tDiffraction Correction: Building arguments dictionary...");
 
@@ -915,6 +986,13 @@ static PyMemberDef Custom_members[] = {
         0,
         "Allen deviation."
     },
+    {
+        "num_threads",
+        T_UINT,
+        offsetof(PyDiffrecObj, num_threads),
+        0,
+        "Number of threads the reconstruction was split across."
+    },
     {
         NULL
     }  /* Sentinel */
@@ -934,11 +1012,131 @@ static PyTypeObject DiffrecType = {
     .tp_methods = DiffractionCorrection_methods,
 };
 
+/*  Submits DiffractionCorrection(*args, **kwds) to an executor and returns   *
+ *  the future. Since the reconstruction releases the GIL, runs submitted to  *
+ *  a thread pool share the input DLP arrays, rather than copying them into   *
+ *  other processes, and still run at the same time.                          */
+static PyObject *
+DiffractionCorrectionAsync(PyObject *module, PyObject *args, PyObject *kwds)
+{
+    PyObject *executor;
+    PyObject *futures;
+    PyObject *submit;
+    PyObject *submit_args;
+    PyObject *submit_kwds;
+    PyObject *future;
+    PyObject *item;
+    Py_ssize_t n, n_args;
+
+    (void)module;
+    executor = NULL;
+    submit_kwds = NULL;
+
+    /*  The executor keyword is for this function. The rest are passed on.   */
+    if (kwds != NULL)
+    {
+        submit_kwds = PyDict_Copy(kwds);
+        if (submit_kwds == NULL)
+            return NULL;
+
+        executor = PyDict_GetItemString(submit_kwds, "executor");
+        if (executor != NULL)
+        {
+            Py_INCREF(executor);
+            if (PyDict_DelItemString(submit_kwds, "executor") == -1)
+            {
+                Py_DECREF(executor);
+                Py_DECREF(submit_kwds);
+                return NULL;
+            }
+        }
+    }
+
+    if ((executor == NULL) || (executor == Py_None))
+    {
+        Py_XDECREF(executor);
+
+        if (diffrec_executor == NULL)
+        {
+            futures = PyImport_ImportModule("concurrent.futures");
+            if (futures == NULL)
+            {
+                Py_XDECREF(submit_kwds);
+                return NULL;
+            }
+
+            diffrec_executor = PyObject_CallMethod(futures,
+                                                   "ThreadPoolExecutor", NULL);
+            Py_DECREF(futures);
+
+            if (diffrec_executor == NULL)
+            {
+                Py_XDECREF(submit_kwds);
+                return NULL;
+            }
+        }
+
+        executor = diffrec_executor;
+        Py_INCREF(executor);
+    }
+
+    submit = PyObject_GetAttrString(executor, "submit");
+    Py_DECREF(executor);
+
+    if (submit == NULL)
+    {
+        Py_XDECREF(submit_kwds);
+        return NULL;
+    }
+
+    /*  The arguments of executor.submit are the class, and then args.        */
+    n_args = PyTuple_GET_SIZE(args);
+    submit_args = PyTuple_New(n_args + 1);
+    if (submit_args == NULL)
+    {
+        Py_DECREF(submit);
+        Py_XDECREF(submit_kwds);
+        return NULL;
+    }
+
+    Py_INCREF(&DiffrecType);
+    PyTuple_SET_ITEM(submit_args, 0, (PyObject *)&DiffrecType);
+
+    for (n = 0; n < n_args; ++n)
+    {
+        item = PyTuple_GET_ITEM(args, n);
+        Py_INCREF(item);
+        PyTuple_SET_ITEM(submit_args, n + 1, item);
+    }
+
+    future = PyObject_Call(submit, submit_args, submit_kwds);
+
+    Py_DECREF(submit);
+    Py_DECREF(submit_args);
+    Py_XDECREF(submit_kwds);
+    return future;
+}
+
+static PyMethodDef diffrec_module_methods[] =
+{
+    {
+        "DiffractionCorrectionAsync",
+        (PyCFunction)(void (*)(void))DiffractionCorrectionAsync,
+        METH_VARARGS | METH_KEYWORDS,
+        "Runs DiffractionCorrection on a thread pool and returns a\n"
+        "concurrent.futures.Future. Takes the arguments of\n"
+        "DiffractionCorrection, and an optional executor keyword. If\n"
+        "executor is not given, a thread pool shared by the module is used."
+    },
+    {NULL}
+};
+
 static PyModuleDef moduledef = {
     PyModuleDef_HEAD_INIT,
     .m_name = "custom",
     .m_doc = "Module containing the rss_ringoccs class.",
     .m_size = -1,
+    .m_methods = diffrec_module_methods,
 };
 
 PyMODINIT_FUNC PyInit_diffrec(void)
@@ -948,6 +1146,15 @@ PyMODINIT_FUNC PyInit_diffrec(void)
     if (PyType_Ready(&DiffrecType) < 0)
         return NULL;
 
+    /*  Reconstructions on different threads share the window cache, which is *
+     *  only locked if librssringoccs was built with OpenMP.                  */
+    if (!rssringoccs_Window_Cache_Is_Thread_Safe() && (diffrec_lock == NULL))
+    {
+        diffrec_lock = PyThread_allocate_lock();
+        if (diffrec_lock == NULL)
+            return PyErr_NoMemory();
+    }
+
     m = PyModule_Create(&moduledef);
 
     if (m == NULL)
@@ -8,15 +8,31 @@ static void capsule_cleanup(PyObject *capsule)
     free(memory);
 }
 
-static void __set_var(PyObject **py_ptr, double **ptr, unsigned long len)
+/*  Returns the base object for a numpy array wrapping ptr. Arrays in the     *
+ *  arena of tau share the capsule arena, which frees the arena once all of   *
+ *  them are gone. Any other array gets its own capsule.                      */
+static PyObject *
+__get_base(void *ptr, rssringoccs_TAUObj *tau, PyObject *arena)
+{
+    if (rssringoccs_Tau_Arena_Owns(tau, ptr))
+    {
+        Py_INCREF(arena);
+        return arena;
+    }
+
+    return PyCapsule_New(ptr, NULL, capsule_cleanup);
+}
+
+static void __set_var(PyObject **py_ptr, double **ptr,
+                      rssringoccs_TAUObj *tau, PyObject *arena)
 {
     PyObject *arr;
     PyObject *capsule;
     PyObject *tmp;
-    long pylength = (long)len;
+    long pylength = (long)tau->arr_size;
 
     arr     = PyArray_SimpleNewFromData(1, &pylength, NPY_DOUBLE, *ptr);
-    capsule = PyCapsule_New((void *) (*ptr), NULL, capsule_cleanup);
+    capsule = __get_base((void *)(*ptr), tau, arena);
 
     PyArray_SetBaseObject((PyArrayObject *)arr, capsule);
 
@@ -27,15 +43,15 @@ static void __set_var(PyObject **py_ptr, double **ptr, unsigned long len)
 }
 
 static void __set_cvar(PyObject **py_ptr, rssringoccs_ComplexDouble **ptr,
-                       unsigned long len)
+                       rssringoccs_TAUObj *tau, PyObject *arena)
 {
     PyObject *arr;
     PyObject *capsule;
     PyObject *tmp;
-    long pylength = (long)len;
+    long pylength = (long)tau->arr_size;
 
     arr     = PyArray_SimpleNewFromData(1, &pylength, NPY_CDOUBLE, *ptr);
-    capsule = PyCapsule_New((void *)(*ptr), NULL, capsule_cleanup);
+    capsule = __get_base((void *)(*ptr), tau, arena);
 
     PyArray_SetBaseObject((PyArrayObject *)arr, capsule);
 
@@ -49,6 +65,8 @@ static void rssringoccs_C_Tau_to_Py_Tau(PyDiffrecObj *py_tau,
                                         rssringoccs_TAUObj *tau)
 {
     PyObject *tmp;
+    PyObject *arena;
+
     if (tau == NULL)
         return;
 
@@ -66,41 +84,61 @@ static void rssringoccs_C_Tau_to_Py_Tau(PyDiffrecObj *py_tau,
         return;
     }
 
-    __set_cvar(&py_tau->T_hat_vals,      &tau->T_in,             tau->arr_size);
-    __set_cvar(&py_tau->T_vals,          &tau->T_out,            tau->arr_size);
-
-    __set_var(&py_tau->rho_km_vals,      &tau->rho_km_vals,      tau->arr_size);
-    __set_var(&py_tau->B_rad_vals,       &tau->B_rad_vals,       tau->arr_size);
-    __set_var(&py_tau->D_km_vals,        &tau->D_km_vals,        tau->arr_size);
-    __set_var(&py_tau->F_km_vals,        &tau->F_km_vals,        tau->arr_size);
-    __set_var(&py_tau->f_sky_hz_vals,    &tau->f_sky_hz_vals,    tau->arr_size);
-    __set_var(&py_tau->p_norm_vals,      &tau->p_norm_vals,      tau->arr_size);
-    __set_var(&py_tau->phase_rad_vals,   &tau->phase_rad_vals,   tau->arr_size);
-    __set_var(&py_tau->phase_vals,       &tau->phase_vals,       tau->arr_size);
-    __set_var(&py_tau->phi_rad_vals,     &tau->phi_rad_vals,     tau->arr_size);
-    __set_var(&py_tau->phi_rl_rad_vals,  &tau->phi_rl_rad_vals,  tau->arr_size);
-    __set_var(&py_tau->power_vals,       &tau->power_vals,       tau->arr_size);
-    __set_var(&py_tau->rho_dot_kms_vals, &tau->rho_dot_kms_vals, tau->arr_size);
-    __set_var(&py_tau->t_oet_spm_vals,   &tau->t_oet_spm_vals,   tau->arr_size);
-    __set_var(&py_tau->t_ret_spm_vals,   &tau->t_ret_spm_vals,   tau->arr_size);
-    __set_var(&py_tau->t_set_spm_vals,   &tau->t_set_spm_vals,   tau->arr_size);
-    __set_var(&py_tau->tau_vals,         &tau->tau_vals,         tau->arr_size);
-    __set_var(&py_tau->w_km_vals,        &tau->w_km_vals,        tau->arr_size);
-    __set_var(&py_tau->rx_km_vals,       &tau->rx_km_vals,       tau->arr_size);
-    __set_var(&py_tau->ry_km_vals,       &tau->ry_km_vals,       tau->arr_size);
-    __set_var(&py_tau->rz_km_vals,       &tau->rz_km_vals,       tau->arr_size);
+    /*  The numpy arrays take over the memory of tau. The arena is freed by   *
+     *  its capsule, once every array that points into it has been deleted.   */
+    if (tau->arena == NULL)
+        arena = NULL;
+    else
+    {
+        arena = PyCapsule_New((void *)tau->arena, NULL, capsule_cleanup);
+
+        if (arena == NULL)
+        {
+            tau->error_occurred = rssringoccs_True;
+            tau->error_message = rssringoccs_strdup(
+                "\n\rError Encountered: rss_ringoccs\n"
+                "\r\trssringoccs_C_Tau_to_Py_Tau\n\n"
+                "\rPyCapsule_New returned NULL for the arena. Aborting.\n"
+            );
+            return;
+        }
+    }
+
+    __set_cvar(&py_tau->T_hat_vals,      &tau->T_in,               tau, arena);
+    __set_cvar(&py_tau->T_vals,          &tau->T_out,              tau, arena);
+
+    __set_var(&py_tau->rho_km_vals,      &tau->rho_km_vals,        tau, arena);
+    __set_var(&py_tau->B_rad_vals,       &tau->B_rad_vals,         tau, arena);
+    __set_var(&py_tau->D_km_vals,        &tau->D_km_vals,          tau, arena);
+    __set_var(&py_tau->F_km_vals,        &tau->F_km_vals,          tau, arena);
+    __set_var(&py_tau->f_sky_hz_vals,    &tau->f_sky_hz_vals,      tau, arena);
+    __set_var(&py_tau->p_norm_vals,      &tau->p_norm_vals,        tau, arena);
+    __set_var(&py_tau->phase_rad_vals,   &tau->phase_rad_vals,     tau, arena);
+    __set_var(&py_tau->phase_vals,       &tau->phase_vals,         tau, arena);
+    __set_var(&py_tau->phi_rad_vals,     &tau->phi_rad_vals,       tau, arena);
+    __set_var(&py_tau->phi_rl_rad_vals,  &tau->phi_rl_rad_vals,    tau, arena);
+    __set_var(&py_tau->power_vals,       &tau->power_vals,         tau, arena);
+    __set_var(&py_tau->rho_dot_kms_vals, &tau->rho_dot_kms_vals,   tau, arena);
+    __set_var(&py_tau->t_oet_spm_vals,   &tau->t_oet_spm_vals,     tau, arena);
+    __set_var(&py_tau->t_ret_spm_vals,   &tau->t_ret_spm_vals,     tau, arena);
+    __set_var(&py_tau->t_set_spm_vals,   &tau->t_set_spm_vals,     tau, arena);
+    __set_var(&py_tau->tau_vals,         &tau->tau_vals,           tau, arena);
+    __set_var(&py_tau->w_km_vals,        &tau->w_km_vals,          tau, arena);
+    __set_var(&py_tau->rx_km_vals,       &tau->rx_km_vals,         tau, arena);
+    __set_var(&py_tau->ry_km_vals,       &tau->ry_km_vals,         tau, arena);
+    __set_var(&py_tau->rz_km_vals,       &tau->rz_km_vals,         tau, arena);
 
     __set_var(&py_tau->raw_tau_threshold_vals,
-              &tau->raw_tau_threshold_vals, tau->arr_size);
+              &tau->raw_tau_threshold_vals, tau, arena);
 
     __set_var(&py_tau->rho_corr_pole_km_vals,
-              &tau->rho_corr_pole_km_vals, tau->arr_size);
+              &tau->rho_corr_pole_km_vals, tau, arena);
 
     __set_var(&py_tau->rho_corr_timing_km_vals,
-              &tau->rho_corr_timing_km_vals, tau->arr_size);
+              &tau->rho_corr_timing_km_vals, tau, arena);
 
     __set_var(&py_tau->tau_threshold_vals,
-              &tau->tau_threshold_vals, tau->arr_size);
+              &tau->tau_threshold_vals, tau, arena);
 
     if (tau->T_fwd == NULL)
     {
@@ -126,12 +164,18 @@ static void rssringoccs_C_Tau_to_Py_Tau(PyDiffrecObj *py_tau,
     }
     else
     {
-        __set_cvar(&py_tau->T_hat_fwd_vals, &tau->T_fwd, tau->arr_size);
-        __set_var(&py_tau->p_norm_fwd_vals,
-                  &tau->p_norm_fwd_vals, tau->arr_size);
-        __set_var(&py_tau->phase_fwd_vals, &tau->phase_fwd_vals, tau->arr_size);
-        __set_var(&py_tau->tau_fwd_vals, &tau->tau_fwd_vals, tau->arr_size);
+        __set_cvar(&py_tau->T_hat_fwd_vals, &tau->T_fwd, tau, arena);
+        __set_var(&py_tau->p_norm_fwd_vals, &tau->p_norm_fwd_vals, tau, arena);
+        __set_var(&py_tau->phase_fwd_vals, &tau->phase_fwd_vals, tau, arena);
+        __set_var(&py_tau->tau_fwd_vals, &tau->tau_fwd_vals, tau, arena);
     }
+
+    /*  Drop this reference to the arena capsule. The arrays hold their own,  *
+     *  and tau no longer owns the arena.                                     */
+    Py_XDECREF(arena);
+    tau->arena = NULL;
+    tau->arena_size = 0;
+    tau->arena_used = 0;
 }
 
 /*  To edit:
@@ -24,13 +24,13 @@ void rssringoccs_Get_Py_Range(rssringoccs_TAUObj *tau, PyObject *rngreq)
 
     /*  If the rng variable is a string, make sure it is a legal value and    *
      *  try to extract the corresponding values in kilometers.                */
-    if PyBytes_Check(rngreq)
+    if (PyBytes_Check(rngreq))
         rssringoccs_Tau_Set_Range_From_String(PyBytes_AsString(rngreq), tau);
 
     /*  If the rng variable is a unicode object (type of string from python)  *
      *  make sure it is a legal value and try to extract the corresponding    *
      *  values in kilometers.                                                 */
-    else if PyUnicode_Check(rngreq)
+    else if (PyUnicode_Check(rngreq))
 
         /*  Convert the Python string to a C string via PyUnicode_AsUTF8. The *
          *  C API recommends not altering the string, so we create a copy of  *
@@ -38,7 +38,7 @@ void rssringoccs_Get_Py_Range(rssringoccs_TAUObj *tau, PyObject *rngreq)
         rssringoccs_Tau_Set_Range_From_String(PyUnicode_AsUTF8(rngreq), tau);
 
     /*  If the requested range is a list, try to parse the elements.          */
-    else if PyList_Check(rngreq)
+    else if (PyList_Check(rngreq))
     {
         if (PyList_Size(rngreq) != 2)
         {
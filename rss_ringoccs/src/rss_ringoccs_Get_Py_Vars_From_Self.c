@@ -27,4 +27,6 @@ void rssringoccs_Get_Py_Vars_From_Self(rssringoccs_TAUObj *tau,
     tau->use_fwd  = self->use_fwd;
     tau->use_norm = self->use_norm;
     tau->verbose  = self->verbose;
+
+    tau->num_threads = self->num_threads;
 }
\ No newline at end of file
@@ -21,12 +21,16 @@
  *          pass                                                              *
  *  Next we try to convert the numpy array to an array of double, which is    *
  *  equivalent to using the astype method of the ndarray numpy object:        *
- *      arr = arr.astype(float)                                               *
+ *      arr = numpy.ascontiguousarray(arr, dtype=float)                       *
+ *  This returns the array itself if it is already a C-contiguous array of    *
+ *  double, read-only or not, so that its data is used without a copy.        *
  *  Finally, we check that the array is one dimensional and that it has the   *
  *  same number of elements as the input rho_km_vals array. If this passes,   *
- *  we pointer the pointer ptr to the data of the array.                      */
+ *  we pointer the pointer ptr to the data of the array. The array is added   *
+ *  to the list pinned, which keeps it alive while ptr is in use, even if the *
+ *  attribute is reassigned by another thread after the GIL is released.      */
 static double *__extract_data(rssringoccs_DLPObj *dlp, PyObject *py_dlp,
-                              const char *var_name)
+                              const char *var_name, PyObject *pinned)
 {
     PyObject *tmp;
     PyObject *arr;
@@ -57,6 +61,7 @@ static double *__extract_data(rssringoccs_DLPObj *dlp, PyObject *py_dlp,
 
     if (!PyArray_Check(tmp))
     {
+        Py_DECREF(tmp);
         dlp->error_occurred = rssringoccs_True;
         dlp->error_message = malloc(sizeof(*dlp->error_message) * 256);
         sprintf(
@@ -69,11 +74,13 @@ static double *__extract_data(rssringoccs_DLPObj *dlp, PyObject *py_dlp,
         return NULL;
     }
     else
-        arr = PyArray_FromObject(tmp, NPY_DOUBLE, 1, 1);
+        arr = PyArray_FromAny(tmp, PyArray_DescrFromType(NPY_DOUBLE), 1, 1,
+                              NPY_ARRAY_IN_ARRAY, NULL);
 
-    len = (unsigned long)PyArray_DIMS((PyArrayObject *)arr)[0];
+    /*  arr is either tmp, with a new reference, or a copy of it.             */
+    Py_DECREF(tmp);
 
-    /*  If PyArray_FromObject failed arr should be NULL. If so, raise error.  */
+    /*  If PyArray_FromAny failed arr should be NULL. If so, raise error.     */
     if (!arr)
     {
         dlp->error_occurred = rssringoccs_True;
@@ -88,8 +95,26 @@ static double *__extract_data(rssringoccs_DLPObj *dlp, PyObject *py_dlp,
         return NULL;
     }
 
+    /*  The list now owns arr, and keeps it alive until it is destroyed.      */
+    if (PyList_Append(pinned, arr) == -1)
+    {
+        Py_DECREF(arr);
+        PyErr_Clear();
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = malloc(sizeof(*dlp->error_message) * 256);
+        sprintf(
+            dlp->error_message,
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\tdiffrec.DiffractionCorrection\n\n"
+            "\rCould not hold a reference to %s.\n",
+            var_name
+        );
+        return NULL;
+    }
+    Py_DECREF(arr);
+
     /*  Currently we only allow for one dimensional inputs.                   */
-    else if (PyArray_NDIM((PyArrayObject *)arr) != 1)
+    if (PyArray_NDIM((PyArrayObject *)arr) != 1)
     {
         dlp->error_occurred = rssringoccs_True;
         dlp->error_message = malloc(sizeof(*dlp->error_message) * 256);
@@ -103,8 +128,10 @@ static double *__extract_data(rssringoccs_DLPObj *dlp, PyObject *py_dlp,
         return NULL;
     }
 
+    len = (unsigned long)PyArray_DIMS((PyArrayObject *)arr)[0];
+
     /*  arr should have the same number of elements as rho_km_vals.           */
-    else if (len != dlp->arr_size)
+    if (len != dlp->arr_size)
     {
         dlp->error_occurred = rssringoccs_True;
         dlp->error_message = malloc(sizeof(*dlp->error_message) * 256);
@@ -122,7 +149,8 @@ static double *__extract_data(rssringoccs_DLPObj *dlp, PyObject *py_dlp,
     return (double *)PyArray_DATA((PyArrayObject *)arr);;
 }
 
-rssringoccs_DLPObj *rssringoccs_Py_DLP_to_C_DLP(PyObject *py_dlp)
+rssringoccs_DLPObj *
+rssringoccs_Py_DLP_to_C_DLP(PyObject *py_dlp, PyObject *pinned)
 {
     PyObject *tmp;
     PyObject *arr;
@@ -175,6 +203,7 @@ rssringoccs_DLPObj *rssringoccs_Py_DLP_to_C_DLP(PyObject *py_dlp)
     /*  Now make sure rho_km_vals is a numpy array.                           */
     if (!PyArray_Check(tmp))
     {
+        Py_DECREF(tmp);
         dlp->error_occurred = rssringoccs_True;
         dlp->error_message = rssringoccs_strdup(
             "\n\rError Encountered: rss_ringoccs\n"
@@ -184,11 +213,15 @@ rssringoccs_DLPObj *rssringoccs_Py_DLP_to_C_DLP(PyObject *py_dlp)
         return dlp;
     }
 
-    /*  If rho_km_vals is a numpy array, try to convert it to double.         */
+    /*  If rho_km_vals is a numpy array, try to convert it to a C-contiguous  *
+     *  array of double. This is rho_km_vals itself if it is one already.     */
     else
-        arr = PyArray_FromObject(tmp, NPY_DOUBLE, 1, 1);
+        arr = PyArray_FromAny(tmp, PyArray_DescrFromType(NPY_DOUBLE), 1, 1,
+                              NPY_ARRAY_IN_ARRAY, NULL);
 
-    /*  If PyArray_FromObject failed arr should be NULL. If so, raise error. */
+    Py_DECREF(tmp);
+
+    /*  If PyArray_FromAny failed arr should be NULL. If so, raise error.     */
     if (!arr)
     {
         dlp->error_occurred = rssringoccs_True;
@@ -201,8 +234,23 @@ rssringoccs_DLPObj *rssringoccs_Py_DLP_to_C_DLP(PyObject *py_dlp)
         return dlp;
     }
 
+    /*  Keep rho_km_vals alive for as long as the C DLP points to it.         */
+    if (PyList_Append(pinned, arr) == -1)
+    {
+        Py_DECREF(arr);
+        PyErr_Clear();
+        dlp->error_occurred = rssringoccs_True;
+        dlp->error_message = rssringoccs_strdup(
+            "\n\rError Encountered: rss_ringoccs\n"
+            "\r\tdiffrec.DiffractionCorrection\n\n"
+            "\rCould not hold a reference to rho_km_vals.\n"
+        );
+        return dlp;
+    }
+    Py_DECREF(arr);
+
     /*  Currently we only allow for one dimensional inputs.                   */
-    else if (PyArray_NDIM((PyArrayObject *)arr) != 1)
+    if (PyArray_NDIM((PyArrayObject *)arr) != 1)
     {
         dlp->error_occurred = rssringoccs_True;
         dlp->error_message = rssringoccs_strdup(
@@ -217,29 +265,56 @@ rssringoccs_DLPObj *rssringoccs_Py_DLP_to_C_DLP(PyObject *py_dlp)
     dlp->rho_km_vals = (double *)PyArray_DATA((PyArrayObject *)arr);
     dlp->arr_size = PyArray_DIMS((PyArrayObject *)arr)[0];
 
-    dlp->p_norm_vals      = __extract_data(dlp, py_dlp, "p_norm_vals");
-    dlp->phase_rad_vals   = __extract_data(dlp, py_dlp, "phase_rad_vals");
-    dlp->phi_rad_vals     = __extract_data(dlp, py_dlp, "phi_rad_vals");
-    dlp->phi_rl_rad_vals  = __extract_data(dlp, py_dlp, "phi_rl_rad_vals");
-    dlp->B_rad_vals       = __extract_data(dlp, py_dlp, "B_rad_vals");
-    dlp->D_km_vals        = __extract_data(dlp, py_dlp, "D_km_vals");
-    dlp->f_sky_hz_vals    = __extract_data(dlp, py_dlp, "f_sky_hz_vals");
-    dlp->rho_dot_kms_vals = __extract_data(dlp, py_dlp, "rho_dot_kms_vals");
-    dlp->t_oet_spm_vals   = __extract_data(dlp, py_dlp, "t_oet_spm_vals");
-    dlp->t_ret_spm_vals   = __extract_data(dlp, py_dlp, "t_ret_spm_vals");
-    dlp->t_set_spm_vals   = __extract_data(dlp, py_dlp, "t_set_spm_vals");
-    dlp->rx_km_vals       = __extract_data(dlp, py_dlp, "rx_km_vals");
-    dlp->ry_km_vals       = __extract_data(dlp, py_dlp, "ry_km_vals");
-    dlp->rz_km_vals       = __extract_data(dlp, py_dlp, "rz_km_vals");
+    dlp->p_norm_vals
+        = __extract_data(dlp, py_dlp, "p_norm_vals", pinned);
+
+    dlp->phase_rad_vals
+        = __extract_data(dlp, py_dlp, "phase_rad_vals", pinned);
+
+    dlp->phi_rad_vals
+        = __extract_data(dlp, py_dlp, "phi_rad_vals", pinned);
+
+    dlp->phi_rl_rad_vals
+        = __extract_data(dlp, py_dlp, "phi_rl_rad_vals", pinned);
+
+    dlp->B_rad_vals
+        = __extract_data(dlp, py_dlp, "B_rad_vals", pinned);
+
+    dlp->D_km_vals
+        = __extract_data(dlp, py_dlp, "D_km_vals", pinned);
+
+    dlp->f_sky_hz_vals
+        = __extract_data(dlp, py_dlp, "f_sky_hz_vals", pinned);
+
+    dlp->rho_dot_kms_vals
+        = __extract_data(dlp, py_dlp, "rho_dot_kms_vals", pinned);
+
+    dlp->t_oet_spm_vals
+        = __extract_data(dlp, py_dlp, "t_oet_spm_vals", pinned);
+
+    dlp->t_ret_spm_vals
+        = __extract_data(dlp, py_dlp, "t_ret_spm_vals", pinned);
+
+    dlp->t_set_spm_vals
+        = __extract_data(dlp, py_dlp, "t_set_spm_vals", pinned);
+
+    dlp->rx_km_vals
+        = __extract_data(dlp, py_dlp, "rx_km_vals", pinned);
+
+    dlp->ry_km_vals
+        = __extract_data(dlp, py_dlp, "ry_km_vals", pinned);
+
+    dlp->rz_km_vals
+        = __extract_data(dlp, py_dlp, "rz_km_vals", pinned);
 
     dlp->rho_corr_pole_km_vals
-        = __extract_data(dlp, py_dlp, "rho_corr_pole_km_vals");
+        = __extract_data(dlp, py_dlp, "rho_corr_pole_km_vals", pinned);
 
     dlp->rho_corr_timing_km_vals
-        = __extract_data(dlp, py_dlp, "rho_corr_timing_km_vals");
+        = __extract_data(dlp, py_dlp, "rho_corr_timing_km_vals", pinned);
 
     dlp->raw_tau_threshold_vals
-        = __extract_data(dlp, py_dlp, "raw_tau_threshold_vals");
+        = __extract_data(dlp, py_dlp, "raw_tau_threshold_vals", pinned);
 
     return dlp;
 }
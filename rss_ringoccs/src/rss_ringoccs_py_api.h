@@ -70,6 +70,7 @@ typedef struct {
     double             peri;
     double             res_factor;
     double             sigma;
+    unsigned int       num_threads;
     const char        *psitype;
     const char        *wtype;
 } PyDiffrecObj;
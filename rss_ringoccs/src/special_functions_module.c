@@ -34,362 +34,159 @@
  *  Python. Successful compiling requires the Numpy and Python header files.  *
  *----------------------------------------------------------------------------*/
 
-#ifdef RSS_RINGOCCS_GetArrFromTwoTypeFunc
-#undef RSS_RINGOCCS_GetArrFromTwoTypeFunc
-#endif
-
-#define RSS_RINGOCCS_GetArrFromTwoTypeFunc(type, name)                         \
-static void *_get_array_from_two_##name(void *in, type param1, long dim,       \
-                                        type (*f)(type, type))                 \
-{                                                                              \
-    long n;                                                                    \
-    void *out;                                                                 \
-    type *out_data;                                                            \
-                                                                               \
-    out_data = malloc(sizeof(*out_data)*dim);                                  \
-                                                                               \
-    for (n=0; n<dim; ++n)                                                      \
-        out_data[n] = f(((type *)in)[n], param1);                              \
-                                                                               \
-    out = out_data;                                                            \
-    return out;                                                                \
-}
-
-
-RSS_RINGOCCS_GetArrFromTwoTypeFunc(float, float)
-RSS_RINGOCCS_GetArrFromTwoTypeFunc(double, double)
-RSS_RINGOCCS_GetArrFromTwoTypeFunc(long double, longdouble)
-
-#undef RSS_RINGOCCS_GetArrFromTwoTypeFunc
-
-#ifdef RSS_RINGOCCS_GetArrFromThreeTypeFunc
-#undef RSS_RINGOCCS_GetArrFromThreeTypeFunc
-#endif
-
-#define RSS_RINGOCCS_GetArrFromThreeTypeFunc(type, name)                       \
-static void *_get_array_from_three_##name(void *in, type param1,               \
-                                          type param2, long dim,               \
-                                          type (*f)(type, type, type))         \
+/*  The window, Bessel, Fresnel, Lambert W, and sinc functions are NumPy      *
+ *  ufuncs. NumPy broadcasts the inputs, writes to out= if it is given, and   *
+ *  calls the inner loops below on chunks of the data, so no temporary array  *
+ *  is made. There is a loop for float, double, and long double. The data    *
+ *  pointer NumPy passes to a loop is the C function for that type.           */
+#define UFuncOneVarLoop(type, name)                                            \
+static void                                                                    \
+name##_one_var_loop(char **args, npy_intp const *dimensions,                   \
+                    npy_intp const *steps, void *data)                         \
 {                                                                              \
-    long n;                                                                    \
-    void *out;                                                                 \
-    type *out_data;                                                            \
-                                                                               \
-    out_data = malloc(sizeof(*out_data)*dim);                                  \
+    type (*f)(type) = (type (*)(type))data;                                    \
+    char *x = args[0];                                                         \
+    char *out = args[1];                                                       \
+    npy_intp n;                                                                \
                                                                                \
-    for (n=0; n<dim; ++n)                                                      \
-        out_data[n] = f(((type *)in)[n], param1, param2);                      \
-                                                                               \
-    out = out_data;                                                            \
-    return out;                                                                \
+    for (n = 0; n < dimensions[0]; ++n)                                        \
+    {                                                                          \
+        *(type *)out = f(*(type *)x);                                          \
+        x += steps[0];                                                         \
+        out += steps[1];                                                       \
+    }                                                                          \
 }
 
-RSS_RINGOCCS_GetArrFromThreeTypeFunc(float, float)
-RSS_RINGOCCS_GetArrFromThreeTypeFunc(double, double)
-RSS_RINGOCCS_GetArrFromThreeTypeFunc(long double, longdouble)
-
-#undef RSS_RINGOCCS_GetArrFromThreeTypeFunc
-
-#define WindowFunctionForNumpy(FuncName, CName)                                \
-static PyObject * FuncName(PyObject *self, PyObject *args)                     \
+#define UFuncTwoVarLoop(type, name)                                            \
+static void                                                                    \
+name##_two_var_loop(char **args, npy_intp const *dimensions,                   \
+                    npy_intp const *steps, void *data)                         \
 {                                                                              \
-    PyObject *output, *capsule, *x, *nth_item;                                 \
-    double W, x_val, y_val;                                                    \
-    char typenum;                                                              \
-    long n, dim;                                                               \
-    void *data, *out;                                                          \
-                                                                               \
-    /*  Parse the data from Python and try to convert it to a usable format. */\
-    if (!PyArg_ParseTuple(args, "Od", &x, &W))                                 \
-    {                                                                          \
-        PyErr_Format(PyExc_TypeError,                                          \
-                     "\n\rError Encountered: rss_ringoccs\n"                   \
-                     "\r\tspecial_functions.%s\n\n"                            \
-                     "\rCould not parse inputs. Legal inputs are:\n"           \
-                     "\r\tx:     Numpy Array of real numbers (Floats)\n"       \
-                     "\r\tW:    Positive real number (Float)\n\rNotes:\n"      \
-                     "\r\tx must be a non-empty one dimensional numpy array.", \
-                     VarToString(FuncName));                                   \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    /*  Check that W is positive and return with error otherwise.            */\
-    if (W <= 0)                                                                \
-    {                                                                          \
-        PyErr_Format(PyExc_ValueError, "\n\rError Encountered: rss_ringoccs\n" \
-                                       "\r\tspecial_functions.%s\n\n"          \
-                                       "\rW must be a positive number.\n",     \
-                                       VarToString(FuncName));                 \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    if (PyLong_Check(x) || PyFloat_Check(x))                                   \
-    {                                                                          \
-        x_val = PyFloat_AsDouble(x);                                           \
-        y_val = rssringoccs_Double_##CName(x_val, W);                          \
-        return PyFloat_FromDouble(y_val);                                      \
-    }                                                                          \
-    else if (PyList_Check(x))                                                  \
-    {                                                                          \
-        dim    = PyList_Size(x);                                               \
-        output = PyList_New(dim);                                              \
-                                                                               \
-        for (n=0; n<dim; ++n)                                                  \
-        {                                                                      \
-            nth_item = PyList_GET_ITEM(x, n);                                  \
-            if (!PyFloat_Check(nth_item) && !PyLong_Check(nth_item))           \
-            {                                                                  \
-                PyErr_Format(PyExc_TypeError,                                  \
-                             "\n\rError Encountered: rss_ringoccs\n"           \
-                             "\r\tspecial_functions.%s\n\n"                    \
-                             "\rInput list must contain real numbers only.\n", \
-                             VarToString(FuncName));                           \
-                return NULL;                                                   \
-            }                                                                  \
+    type (*f)(type, type) = (type (*)(type, type))data;                        \
+    char *x = args[0];                                                         \
+    char *W = args[1];                                                         \
+    char *out = args[2];                                                       \
+    npy_intp n;                                                                \
                                                                                \
-            x_val = PyFloat_AsDouble(nth_item);                                \
-            y_val = rssringoccs_Double_##CName(x_val, W);                      \
-            PyList_SET_ITEM(output, n, PyFloat_FromDouble(y_val));             \
-        }                                                                      \
-        return output;                                                         \
-    }                                                                          \
-    else if (!(PyArray_Check(x)))                                              \
-    {                                                                          \
-        PyErr_Format(PyExc_TypeError,                                          \
-             "\n\rError Encountered: rss_ringoccs\n"                           \
-             "\r\tspecial_functions.%s\n\n"                                    \
-             "\rCould not parse inputs. Legal inputs are:\n"                   \
-             "\r\tx: Numpy Array of real numbers (Floats)\n\rNotes:\n"         \
-             "\r\tx must be a non-empty one dimensional numpy array.\n",       \
-             VarToString(FuncName));                                           \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    /*  If you get here, then the input is a numpy array. Grab some useful   */\
-    /*  information about the data using numpy's API functions.              */\
-    typenum = PyArray_TYPE((PyArrayObject *)x);                                \
-    dim     = PyArray_DIMS((PyArrayObject *)x)[0];                             \
-    data    = PyArray_DATA((PyArrayObject *)x);                                \
-                                                                               \
-    /*  Check the inputs to make sure they're valid.                         */\
-    if (PyArray_NDIM((PyArrayObject *)x) != 1){                                \
-        PyErr_Format(PyExc_TypeError,                                          \
-                     "\n\rError Encountered: rss_ringoccs\n"                   \
-                     "\r\tspecial_functions.%s\n"                              \
-                     "\n\rInput is not 1-dimensional.\n",                      \
-                     VarToString(FuncName));                                   \
-        return NULL;                                                           \
-    }                                                                          \
-    else if (dim == 0){                                                        \
-        PyErr_Format(PyExc_TypeError,                                          \
-                     "\n\rError Encountered: rss_ringoccs\n"                   \
-                     "\r\tspecial_functions.%s"                                \
-                     "\n\n\rInput numpy array is empty.\n",                    \
-                     VarToString(FuncName));                                   \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    if (typenum == NPY_FLOAT)                                                  \
-        out = _get_array_from_two_float(data, W, dim,                          \
-                                        rssringoccs_Float_##CName);            \
-    else if (typenum == NPY_DOUBLE)                                            \
-        out = _get_array_from_two_double(data, W, dim,                         \
-                                         rssringoccs_Double_##CName);          \
-    else if (typenum == NPY_LONGDOUBLE)                                        \
-        out = _get_array_from_two_longdouble(data, W, dim,                     \
-                                              rssringoccs_LDouble_##CName);    \
-    else                                                                       \
+    for (n = 0; n < dimensions[0]; ++n)                                        \
     {                                                                          \
-        /*  Try to convert the input numpy array to double and compute.      */\
-        PyObject *new_x = PyArray_FromObject(x, NPY_DOUBLE, 1, 1);             \
-                                                                               \
-        /*  If PyArray_FromObject failed, newrho should be NULL. Check this. */\
-        if (!(new_x))                                                          \
-        {                                                                      \
-            PyErr_Format(PyExc_TypeError,                                      \
-                        "\n\rError Encountered: rss_ringoccs\n"                \
-                        "\r\tspecial_functions.%s\n\n"                         \
-                        "\rInvalid data type for input array. Input should"    \
-                        "\n\rbe a 1-dimensional array of real numbers.\n",     \
-                        VarToString(FuncName));                                \
-            return NULL;                                                       \
-        }                                                                      \
-                                                                               \
-        /*  If it passed, get a pointer to the data inside the numpy array.  */\
-        else                                                                   \
-            data = PyArray_DATA((PyArrayObject *)new_x);                       \
-                                                                               \
-        /*  loop over the data and compute with CName_Double.                */\
-        out = _get_array_from_two_double(data, W, dim,                         \
-                                         rssringoccs_Double_##CName);          \
-        typenum = NPY_DOUBLE;                                                  \
+        *(type *)out = f(*(type *)x, *(type *)W);                              \
+        x += steps[0];                                                         \
+        W += steps[1];                                                         \
+        out += steps[2];                                                       \
     }                                                                          \
-                                                                               \
-    output  = PyArray_SimpleNewFromData(1, &dim, typenum, out);                \
-    capsule = PyCapsule_New(out, NULL, capsule_cleanup);                       \
-                                                                               \
-    /*  This frees the variable at the Python level once it's destroyed.  */   \
-    PyArray_SetBaseObject((PyArrayObject *)output, capsule);                   \
-                                                                               \
-    /*  Return the results to Python.                                     */   \
-    return Py_BuildValue("N", output);                                         \
 }
 
-#define WindowFunctionAlForNumpy(FuncName, CName)                              \
-static PyObject * FuncName(PyObject *self, PyObject *args)                     \
+#define UFuncThreeVarLoop(type, name)                                          \
+static void                                                                    \
+name##_three_var_loop(char **args, npy_intp const *dimensions,                 \
+                      npy_intp const *steps, void *data)                       \
 {                                                                              \
-    PyObject *output, *capsule, *x, *nth_item;                                 \
-    double W, alpha, x_val, y_val;                                             \
-    char typenum;                                                              \
-    long n, dim;                                                               \
-    void *data, *out;                                                          \
-                                                                               \
-    /*  Parse the data from Python and try to convert it to a usable format. */\
-    if (!PyArg_ParseTuple(args, "Odd", &x, &W, &alpha))                        \
-    {                                                                          \
-        PyErr_Format(PyExc_TypeError,                                          \
-                     "\n\rError Encountered: rss_ringoccs\n"                   \
-                     "\r\tdiffrec.special_functions.%s\n\n"                    \
-                     "\rCould not parse inputs. Legal inputs are:\n"           \
-                     "\r\tx:     Numpy Array of real numbers (Floats)\n"       \
-                     "\r\tW:     Positive real number (Float)\n"               \
-                     "\r\talpha: Positive real number (Float)"                 \
-                     "\rNotes:\n"                                              \
-                     "\r\tx must be a non-empty one dimensional numpy array.", \
-                     VarToString(FuncName));                                   \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    /*  Check that W and alpha are positive.                                 */\
-    if (W <= 0)                                                                \
-    {                                                                          \
-        PyErr_Format(PyExc_ValueError, "\n\rError Encountered: rss_ringoccs\n" \
-                                       "\r\tspecial_functions.%s\n\n"          \
-                                       "\rW must be a positive number.\n",     \
-                                       VarToString(FuncName));                 \
-        return NULL;                                                           \
-    }                                                                          \
-    else if (alpha <= 0)                                                       \
-    {                                                                          \
-        PyErr_Format(PyExc_ValueError, "\n\rError Encountered: rss_ringoccs\n" \
-                                       "\r\tspecial_functions.%s\n\n"          \
-                                       "\ralpha must be a positive number.\n", \
-                                       VarToString(FuncName));                 \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    if (PyLong_Check(x) || PyFloat_Check(x))                                   \
-    {                                                                          \
-        x_val = PyFloat_AsDouble(x);                                           \
-        y_val = rssringoccs_Double_##CName(x_val, W, alpha);                   \
-        return PyFloat_FromDouble(y_val);                                      \
-    }                                                                          \
-    else if (PyList_Check(x))                                                  \
-    {                                                                          \
-        dim    = PyList_Size(x);                                               \
-        output = PyList_New(dim);                                              \
-                                                                               \
-        for (n=0; n<dim; ++n)                                                  \
-        {                                                                      \
-            nth_item = PyList_GET_ITEM(x, n);                                  \
-            if (!PyFloat_Check(nth_item) && !PyLong_Check(nth_item))           \
-            {                                                                  \
-                PyErr_Format(PyExc_TypeError,                                  \
-                             "\n\rError Encountered: rss_ringoccs\n"           \
-                             "\r\tspecial_functions.%s\n\n"                    \
-                             "\rInput list must contain real numbers only.\n", \
-                             VarToString(FuncName));                           \
-                return NULL;                                                   \
-            }                                                                  \
-                                                                               \
-            x_val = PyFloat_AsDouble(nth_item);                                \
-            y_val = rssringoccs_Double_##CName(x_val, W, alpha);               \
-            PyList_SET_ITEM(output, n, PyFloat_FromDouble(y_val));             \
-        }                                                                      \
-        return output;                                                         \
-    }                                                                          \
-    else if (!(PyArray_Check(x)))                                              \
-    {                                                                          \
-        PyErr_Format(PyExc_TypeError,                                          \
-             "\n\rError Encountered: rss_ringoccs\n"                           \
-             "\r\tspecial_functions.%s\n\n"                                    \
-             "\rCould not parse inputs. Legal inputs are:\n"                   \
-             "\r\tx: Numpy Array of real numbers (Floats)\n\rNotes:\n"         \
-             "\r\tx must be a non-empty one dimensional numpy array.\n",       \
-             VarToString(FuncName));                                           \
-        return NULL;                                                           \
-    }                                                                          \
-                                                                               \
-    /*  If you get here, then the input is a numpy array. Grab some useful   */\
-    /*  information about the data using numpy's API functions.              */\
-    typenum = PyArray_TYPE((PyArrayObject *)x);                                \
-    dim     = PyArray_DIMS((PyArrayObject *)x)[0];                             \
-    data    = PyArray_DATA((PyArrayObject *)x);                                \
-                                                                               \
-    /*  Check the inputs to make sure they're valid.                         */\
-    if (PyArray_NDIM((PyArrayObject *)x) != 1){                                \
-        PyErr_Format(PyExc_TypeError,                                          \
-                     "\n\rError Encountered: rss_ringoccs\n"                   \
-                     "\r\tspecial_functions.%s\n"                              \
-                     "\n\rInput is not 1-dimensional.\n",                      \
-                     VarToString(FuncName));                                   \
-        return NULL;                                                           \
-    }                                                                          \
-    else if (dim == 0){                                                        \
-        PyErr_Format(PyExc_TypeError,                                          \
-                     "\n\rError Encountered: rss_ringoccs\n"                   \
-                     "\r\tspecial_functions.%s"                                \
-                     "\n\n\rInput numpy array is empty.\n",                    \
-                     VarToString(FuncName));                                   \
-        return NULL;                                                           \
-    }                                                                          \
+    type (*f)(type, type, type) = (type (*)(type, type, type))data;            \
+    char *x = args[0];                                                         \
+    char *W = args[1];                                                         \
+    char *alpha = args[2];                                                     \
+    char *out = args[3];                                                       \
+    npy_intp n;                                                                \
                                                                                \
-    if (typenum == NPY_FLOAT)                                                  \
-        out = _get_array_from_three_float(data, W, alpha, dim,                 \
-                                         rssringoccs_Float_##CName);           \
-    else if (typenum == NPY_DOUBLE)                                            \
-        out = _get_array_from_three_double(data, W, alpha, dim,                \
-                                           rssringoccs_Double_##CName);        \
-    else if (typenum == NPY_LONGDOUBLE)                                        \
-        out = _get_array_from_three_longdouble(data, W, alpha, dim,            \
-                                               rssringoccs_LDouble_##CName);   \
-    else                                                                       \
+    for (n = 0; n < dimensions[0]; ++n)                                        \
     {                                                                          \
-        /*  Try to convert the input numpy array to double and compute.      */\
-        PyObject *new_x = PyArray_FromObject(x, NPY_DOUBLE, 1, 1);             \
-                                                                               \
-        /*  If PyArray_FromObject failed, newrho should be NULL. Check this. */\
-        if (!(new_x))                                                          \
-        {                                                                      \
-            PyErr_Format(PyExc_TypeError,                                      \
-                        "\n\rError Encountered: rss_ringoccs\n"                \
-                        "\r\tspecial_functions.%s\n\n"                         \
-                        "\rInvalid data type for input array. Input should"    \
-                        "\n\rbe a 1-dimensional array of real numbers.\n",     \
-                        VarToString(FuncName));                                \
-            return NULL;                                                       \
-        }                                                                      \
-                                                                               \
-        /*  If it passed, get a pointer to the data inside the numpy array.  */\
-        else                                                                   \
-            data = PyArray_DATA((PyArrayObject *)new_x);                       \
-                                                                               \
-        /*  loop over the data and compute with CName_Double.                */\
-        out = _get_array_from_three_double(data, W, alpha,                     \
-                                           dim, rssringoccs_Double_##CName);   \
-        typenum = NPY_DOUBLE;                                                  \
+        *(type *)out = f(*(type *)x, *(type *)W, *(type *)alpha);              \
+        x += steps[0];                                                         \
+        W += steps[1];                                                         \
+        alpha += steps[2];                                                     \
+        out += steps[3];                                                       \
     }                                                                          \
-                                                                               \
-    output  = PyArray_SimpleNewFromData(1, &dim, typenum, out);                \
-    capsule = PyCapsule_New(out, NULL, capsule_cleanup);                       \
-                                                                               \
-    /*  This frees the variable at the Python level once it's destroyed.  */   \
-    PyArray_SetBaseObject((PyArrayObject *)output, capsule);                   \
-                                                                               \
-    /*  Return the results to Python.                                     */   \
-    return Py_BuildValue("N", output);                                         \
 }
 
+UFuncOneVarLoop(float, float)
+UFuncOneVarLoop(double, double)
+UFuncOneVarLoop(long double, ldouble)
+UFuncOneVarLoop(rssringoccs_ComplexDouble, cdouble)
+UFuncTwoVarLoop(float, float)
+UFuncTwoVarLoop(double, double)
+UFuncTwoVarLoop(long double, ldouble)
+UFuncThreeVarLoop(float, float)
+UFuncThreeVarLoop(double, double)
+UFuncThreeVarLoop(long double, ldouble)
+
+#undef UFuncOneVarLoop
+#undef UFuncTwoVarLoop
+#undef UFuncThreeVarLoop
+
+static PyUFuncGenericFunction one_var_funcs[4] = {
+    float_one_var_loop,
+    double_one_var_loop,
+    ldouble_one_var_loop,
+    cdouble_one_var_loop
+};
+
+static PyUFuncGenericFunction two_var_funcs[3] = {
+    float_two_var_loop,
+    double_two_var_loop,
+    ldouble_two_var_loop
+};
+
+static PyUFuncGenericFunction three_var_funcs[3] = {
+    float_three_var_loop,
+    double_three_var_loop,
+    ldouble_three_var_loop
+};
+
+/*  The input and output types of each loop, in the order of the loops.      *
+ *  Only besselI0 has the complex loop, and it is the last one.               */
+static char one_var_types[8] = {
+    NPY_FLOAT, NPY_FLOAT,
+    NPY_DOUBLE, NPY_DOUBLE,
+    NPY_LONGDOUBLE, NPY_LONGDOUBLE,
+    NPY_CDOUBLE, NPY_CDOUBLE
+};
+
+static char two_var_types[9] = {
+    NPY_FLOAT, NPY_FLOAT, NPY_FLOAT,
+    NPY_DOUBLE, NPY_DOUBLE, NPY_DOUBLE,
+    NPY_LONGDOUBLE, NPY_LONGDOUBLE, NPY_LONGDOUBLE
+};
+
+static char three_var_types[12] = {
+    NPY_FLOAT, NPY_FLOAT, NPY_FLOAT, NPY_FLOAT,
+    NPY_DOUBLE, NPY_DOUBLE, NPY_DOUBLE, NPY_DOUBLE,
+    NPY_LONGDOUBLE, NPY_LONGDOUBLE, NPY_LONGDOUBLE, NPY_LONGDOUBLE
+};
+
+/*  The C functions for the loops of each ufunc.                              */
+#define UFuncData(name, CName)                                                 \
+static void *name##_data[3] = {                                                \
+    (void *)rssringoccs_Float_##CName,                                         \
+    (void *)rssringoccs_Double_##CName,                                        \
+    (void *)rssringoccs_LDouble_##CName                                        \
+};
+
+UFuncData(besselJ0,    Bessel_J0)
+UFuncData(fresnel_sin, Fresnel_Sin)
+UFuncData(fresnel_cos, Fresnel_Cos)
+UFuncData(lambertw,    LambertW)
+UFuncData(sinc,        Sinc)
+UFuncData(rect,        Rect_Window)
+UFuncData(coss,        Coss_Window)
+UFuncData(kb20,        Kaiser_Bessel_2_0)
+UFuncData(kb25,        Kaiser_Bessel_2_5)
+UFuncData(kb35,        Kaiser_Bessel_3_5)
+UFuncData(kbmd20,      Modified_Kaiser_Bessel_2_0)
+UFuncData(kbmd25,      Modified_Kaiser_Bessel_2_5)
+UFuncData(kbmd35,      Modified_Kaiser_Bessel_3_5)
+UFuncData(kbal,        Kaiser_Bessel)
+UFuncData(kbmdal,      Modified_Kaiser_Bessel)
+
+#undef UFuncData
+
+static void *besselI0_data[4] = {
+    (void *)rssringoccs_Float_Bessel_I0,
+    (void *)rssringoccs_Double_Bessel_I0,
+    (void *)rssringoccs_LDouble_Bessel_I0,
+    (void *)rssringoccs_CDouble_Bessel_I0
+};
+
 #define MinMaxFunctionForNumpy(FuncName, CName)                                \
 static PyObject *FuncName(PyObject *self, PyObject *args)                      \
 {                                                                              \
@@ -484,90 +281,6 @@ static PyObject *FuncName(PyObject *self, PyObject *args)                      \
 }
 
 
-static PyObject *besselI0(PyObject *self, PyObject *args)
-{
-    rssringoccs_Generic_Function_Obj c_funcs;
-
-    c_funcs.long_func = NULL;
-    c_funcs.float_func = rssringoccs_Float_Bessel_I0;
-    c_funcs.double_func = rssringoccs_Double_Bessel_I0;
-    c_funcs.ldouble_func = rssringoccs_LDouble_Bessel_I0;
-    c_funcs.cdouble_from_real_func = NULL;
-    c_funcs.cdouble_from_complex_func = rssringoccs_CDouble_Bessel_I0;
-
-    return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
-}
-
-static PyObject *besselJ0(PyObject *self, PyObject *args)
-{
-    rssringoccs_Generic_Function_Obj c_funcs;
-
-    c_funcs.long_func = NULL;
-    c_funcs.float_func = rssringoccs_Float_Bessel_J0;
-    c_funcs.double_func = rssringoccs_Double_Bessel_J0;
-    c_funcs.ldouble_func = rssringoccs_LDouble_Bessel_J0;
-    c_funcs.cdouble_from_real_func = NULL;
-    c_funcs.cdouble_from_complex_func = NULL;
-
-    return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
-}
-
-static PyObject *sinc(PyObject *self, PyObject *args)
-{
-    rssringoccs_Generic_Function_Obj c_funcs;
-
-    c_funcs.long_func = NULL;
-    c_funcs.float_func = rssringoccs_Float_Sinc;
-    c_funcs.double_func = rssringoccs_Double_Sinc;
-    c_funcs.ldouble_func = rssringoccs_LDouble_Sinc;
-    c_funcs.cdouble_from_real_func = NULL;
-    c_funcs.cdouble_from_complex_func = NULL;
-
-    return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
-}
-
-static PyObject *fresnel_sin(PyObject *self, PyObject *args)
-{
-    rssringoccs_Generic_Function_Obj c_funcs;
-
-    c_funcs.long_func = NULL;
-    c_funcs.float_func = rssringoccs_Float_Fresnel_Sin;
-    c_funcs.double_func = rssringoccs_Double_Fresnel_Sin;
-    c_funcs.ldouble_func = rssringoccs_LDouble_Fresnel_Sin;
-    c_funcs.cdouble_from_real_func = NULL;
-    c_funcs.cdouble_from_complex_func = NULL;
-
-    return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
-}
-
-static PyObject *fresnel_cos(PyObject *self, PyObject *args)
-{
-    rssringoccs_Generic_Function_Obj c_funcs;
-
-    c_funcs.long_func = NULL;
-    c_funcs.float_func = rssringoccs_Float_Fresnel_Cos;
-    c_funcs.double_func = rssringoccs_Double_Fresnel_Cos;
-    c_funcs.ldouble_func = rssringoccs_LDouble_Fresnel_Cos;
-    c_funcs.cdouble_from_real_func = NULL;
-    c_funcs.cdouble_from_complex_func = NULL;
-
-    return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
-}
-
-static PyObject *lambertw(PyObject *self, PyObject *args)
-{
-    rssringoccs_Generic_Function_Obj c_funcs;
-
-    c_funcs.long_func = NULL;
-    c_funcs.float_func = rssringoccs_Float_LambertW;
-    c_funcs.double_func = rssringoccs_Double_LambertW;
-    c_funcs.ldouble_func = rssringoccs_LDouble_LambertW;
-    c_funcs.cdouble_from_real_func = NULL;
-    c_funcs.cdouble_from_complex_func = NULL;
-
-    return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
-}
-
 static PyObject *wavelength_to_wavenumber(PyObject *self, PyObject *args)
 {
     rssringoccs_Generic_Function_Obj c_funcs;
@@ -610,16 +323,6 @@ static PyObject *resolution_inverse(PyObject *self, PyObject *args)
     return rssringoccs_Get_Py_Func_From_C(self, args, &c_funcs);
 }
 
-WindowFunctionForNumpy(rect,   Rect_Window)
-WindowFunctionForNumpy(coss,   Coss_Window)
-WindowFunctionForNumpy(kb20,   Kaiser_Bessel_2_0)
-WindowFunctionForNumpy(kb25,   Kaiser_Bessel_2_5)
-WindowFunctionForNumpy(kb35,   Kaiser_Bessel_3_5)
-WindowFunctionForNumpy(kbmd20, Modified_Kaiser_Bessel_2_0)
-WindowFunctionForNumpy(kbmd25, Modified_Kaiser_Bessel_2_5)
-WindowFunctionForNumpy(kbmd35, Modified_Kaiser_Bessel_3_5)
-WindowFunctionAlForNumpy(kbal, Kaiser_Bessel)
-WindowFunctionAlForNumpy(kbmdal, Modified_Kaiser_Bessel)
 MinMaxFunctionForNumpy(min, rssringoccs_Min)
 MinMaxFunctionForNumpy(max, rssringoccs_Max)
 
@@ -1081,57 +784,305 @@ static PyObject *window_norm(PyObject *self, PyObject *args){
 static PyMethodDef special_functions_methods[] =
 {
     {
-        "coss",
-        coss,
+        "compute_norm_eq",
+        compute_norm_eq,
         METH_VARARGS,
         "\r\t"
         "Function:\n\r\t\t"
-        "special_functions.coss\n\r\t"
+        "special_functions.compute_norm_eq\n\r\t"
         "Purpose:\n\r\t\t"
-        "Compute the squared cosine window function.\n\r\t"
-        "Arguments\n\r\t\t"
-        "x (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers. Independent variable for coss(x)."
-        "\n\r\t\tW (float):\n\r\t\t\t"
-        "The width of the window function.\n\r\t"
+        "Compute normalized equivalenth width of a given function.\n\r\t"
+        "Arguments:\n\r\t\t"
+        "w_func (*numpy.ndarray*):\n\r\t\t\t"
+        "Function to compute the normalized equivalent width.\n\r\t"
         "Outputs:\n\r\t\t"
-        "coss (numpy.ndarray):\n\r\t\t\t"
-        "The squared cosine function of x.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(-20,20,0.1)\n\r\t\t"
-        ">>> W = 10.0\n\r\t\t"
-        ">>> y = special_functions.coss(x, W)"
+        "normeq (*float*):\n\r\t\t\t"
+        "The normalized equivalent width of w_func.\n\r\t"
+        "Notes:\n\r\t\t"
+        "The normalized equivalent width is computed using Riemann\n\r\t\t"
+        "sums to approximate integrals. Therefore large dx values\n\r\t\t"
+        "(Spacing between points) will result in an inaccurate\n\r\t\t"
+        "normeq. One should keep this in mind during calculations.\n\r\t"
+        "Examples:\n\r\t\t"
+        "Compute the Kaiser-Bessel 2.5 window of width 20km and\n\r\t\t"
+        "spacing 0.1 and compute the normalized equivalent width:\n\r\t\t\t"
+        ">>> import special_functions\n\r\t\t\t"
+        ">>> import numpy\n\r\t\t\t"
+        ">>> x = numpy.arange(-10, 10, 0.1)\n\r\t\t\t"
+        ">>> w = special_functions.kb25(x, 20)\n\r\t\t\t"
+        ">>> special_functions.compute_norm_eq(w)\n\r\t\t\t"
+        "1.651925635118099\n\r\t\t"
+        "In contrast, the actual value is 1.6519208. Compute the\n\r\t\t"
+        "normalized equivalent width for the squared cosine window of\n\r\t\t"
+        "width 20 and spacing 0.25.\n\r\t\t\t"
+        ">>> import special_functions\n\r\t\t\t"
+        ">>> import numpy\n\r\t\t\t"
+        ">>> x = numpy.arange(-10, 10, 0.25)\n\r\t\t\t"
+        ">>> w = special_functions.kb25(x, 20)\n\r\t\t\t"
+        ">>> special_functions.compute_norm_eq(w)\n\r\t\t\t"
+        "1.5000000000000013\n\r\t\t"
+        "The normalized equivalent width of the squared cosine\n\r\t\t"
+        "function can be computed exactly using standard methods\n\r\t\t"
+        "from a calculus course. It's value is exactly 1.5."
     },
     {
-        "rect",
-        rect,
+        "frequency_to_wavelength",
+        frequency_to_wavelength,
         METH_VARARGS,
         "\r\t"
         "Function:\n\r\t\t"
-        "special_functions.rect\n\r\t"
-        "Purpose:\n\r\t\t"
-        "Compute the rectangular window function.\n\r\t"
-        "Arguments\n\r\t\t"
-        "x (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers. Independent variable for rect(x)\n\r\t"
-        "W (float):\n\r\t\t\t"
-        "The width of the window function.\n\r\t"
+        "special_functions.frequency_to_wavelength\n\r\t"
+        "Purpose\n\r\t\t"
+        "Convert a non-zero frequency to the equivalent wavelength.\n\r\t"
+        "Arguments:\n\r\t\t"
+        "frequency (numpy.ndarray/int/float/list):\n\r\t\t\t"
+        "A numpy array or list of real numbers, input frequency in Hz.\n\r\t\t"
         "Outputs:\n\r\t\t"
-        "rect (numpy.ndarray):\n\r\t\t\t"
-        "The rect function of x.\n\r\t"
+        "wavelength (numpy.ndarry/list/float):\n\r\t\t\t"
+        "The corresponding wavelength in km.\n\r\t"
         "Example:\n\r\t\t"
         ">>> import numpy\n\r\t\t"
         ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(-20,20,0.1)\n\r\t\t"
-        ">>> W = 10.0"
-        ">>> y = special_functions.rect(x, W)"
+        ">>> x = numpy.arange(1,10,0.1)"
+        ">>> y = special_functions.frequency_to_wavelength(x)"
     },
     {
-        "kb20",
-        kb20,
-        METH_VARARGS,
+        "max",
+        max,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.max\n\r\t"
+        "Purpose\n\r\t\t"
+        "Compute the maximum of a numpy array.\n\r\t"
+        "Arguments:\n\r\t\t"
+        "arr (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers.\n\r\t"
+        "Outputs:\n\r\t\t"
+        "max (int or float):\n\r\t\t\t"
+        "The maximum value of the input array.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.random.rand(100)\n\r\t\t"
+        ">>> y = special_functions.max(x)"
+    },
+    {
+        "min",
+        min,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.min\n\r\t"
+        "Purpose\n\r\t\t"
+        "Compute the minimum of a numpy array.\n\r\t"
+        "Arguments:\n\r\t\t"
+        "arr (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers.\n\r\t"
+        "Outputs:\n\r\t\t"
+        "min (int or float):\n\r\t\t\t"
+        "The minimum value of the input array.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import _special_functions\n\r\t\t"
+        ">>> x = numpy.random.rand(100)\n\r\t\t"
+        ">>> y = special_functions.min(x)"
+    },
+    {
+        "wavelength_to_wavenumber",
+        wavelength_to_wavenumber,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.wavelength_to_wavenumber\n\r\t"
+        "Purpose\n\r\t\t"
+        "Convert a non-zero wavelength to the equivalent wavenumber.\n\r\t"
+        "Arguments:\n\r\t\t"
+        "wavelength (numpy.ndarray/int/float/list):\n\r\t\t\t"
+        "A numpy array or list of real numbers, the input wavelength.\n\r\t\t"
+        "Outputs:\n\r\t\t"
+        "wavenumber (float):\n\r\t\t\t"
+        "The corresponding wavenumber.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.arange(1,10,0.1)"
+        ">>> y = special_functions.wavelength_to_wavenumber(x)"
+    },
+    {
+        "resolution_inverse",
+        resolution_inverse,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.resolution_inverse\n\r\t"
+        "Purpose\n\r\t\t"
+        "Compute the inverse of y = x/(exp(-x)+x-1).\n\r\t"
+        "Arguments:\n\r\t\t"
+        "x (numpy.ndarray/int/float/list):\n\r\t\t\t"
+        "A numpy array or list of real numbers.\n\r\t\t"
+        "Outputs:\n\r\t\t"
+        "y (float):\n\r\t\t\t"
+        "The inverse of x/(exp(-x)+x-1).\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.arange(1,10,0.1)"
+        ">>> y = special_functions.resolution_inverse(x)"
+    },
+    {
+        "where_greater",
+        where_greater,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.where_greater\n\r\t"
+        "Purpose\n\r\t\t"
+        "Given a real-valued numpy array arr, and a real number\n\r\t\t"
+        "threshold, compute the indices n such that arr[n] > threshold\n\r\t"
+        "Arguments:\n\r\t\t"
+        "arr (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers.\n\r\t\t"
+        "threshold (int or float):\n\r\t\t\t"
+        "The threshold value for comparing arr with."
+        "Outputs:\n\r\t\t"
+        "where_arr (numpy.ndarray):\n\r\t\t\t"
+        "The array of indices such that arr[n] > threshold.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.arange(-5, 5, 0.01)\n\r\t\t"
+        ">>> y = special_functions.where_greater(x, 1.0)"
+    },
+    {
+        "where_lesser",
+        where_lesser,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.where_lesser\n\r\t"
+        "Purpose\n\r\t\t"
+        "Given a real-valued numpy array arr, and a real number\n\r\t\t"
+        "threshold, compute the indices n such that arr[n] < threshold\n\r\t"
+        "Arguments:\n\r\t\t"
+        "arr (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers.\n\r\t\t"
+        "threshold (int or float):\n\r\t\t\t"
+        "The threshold value for comparing arr with."
+        "Outputs:\n\r\t\t"
+        "where_arr (numpy.ndarray):\n\r\t\t\t"
+        "The array of indices such that arr[n] < threshold.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.arange(-5, 5, 0.01)\n\r\t\t"
+        ">>> y = special_functions.where_lesser(x, 1.0)"
+    },
+    {
+        "window_norm",
+        window_norm,
+        METH_VARARGS,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.window_norm\n\r\t"
+        "Purpose\n\r\t\t"
+        "Compute the window normalization scheme.\n\r\t"
+        "Arguments:\n\r\t\t"
+        "ker (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers, the input function.\n\r\t\t"
+        "dx (int or float):\n\r\t\t\t"
+        "The sample spacing of the input function.\n\r\t\t"
+        "f_scale (int or float):\n\r\t\t\t"
+        "The Fresnel scale in the same units as dx.\n\r\t\t"
+        "Outputs:\n\r\t\t"
+        "window_norm (float):\n\r\t\t\t"
+        "The normalization factor.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> dx = 0.1"
+        ">>> x = numpy.arange(-10,10,dx)\n\r\t\t"
+        ">>> ker = special_functions.coss(x, 5)"
+        ">>> f_scale = 0.5"
+        ">>> y = special_functions.window_norm(ker, dx, f_scale)"
+    },
+    {NULL, NULL, 0, NULL}
+};
+
+/*  The ufuncs of the module, added to it in PyInit_special_functions.        */
+typedef struct special_functions_ufunc {
+    const char *name;
+    PyUFuncGenericFunction *funcs;
+    void **data;
+    char *types;
+    int ntypes;
+    int nin;
+    const char *doc;
+} special_functions_ufunc;
+
+static special_functions_ufunc special_functions_ufuncs[] =
+{
+    {
+        "coss",
+        two_var_funcs,
+        coss_data,
+        two_var_types,
+        3,
+        2,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.coss\n\r\t"
+        "Purpose:\n\r\t\t"
+        "Compute the squared cosine window function.\n\r\t"
+        "Arguments\n\r\t\t"
+        "x (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers. Independent variable for coss(x)."
+        "\n\r\t\tW (float):\n\r\t\t\t"
+        "The width of the window function.\n\r\t"
+        "Outputs:\n\r\t\t"
+        "coss (numpy.ndarray):\n\r\t\t\t"
+        "The squared cosine function of x.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.arange(-20,20,0.1)\n\r\t\t"
+        ">>> W = 10.0\n\r\t\t"
+        ">>> y = special_functions.coss(x, W)"
+    },
+    {
+        "rect",
+        two_var_funcs,
+        rect_data,
+        two_var_types,
+        3,
+        2,
+        "\r\t"
+        "Function:\n\r\t\t"
+        "special_functions.rect\n\r\t"
+        "Purpose:\n\r\t\t"
+        "Compute the rectangular window function.\n\r\t"
+        "Arguments\n\r\t\t"
+        "x (numpy.ndarray):\n\r\t\t\t"
+        "A numpy array of real numbers. Independent variable for rect(x)\n\r\t"
+        "W (float):\n\r\t\t\t"
+        "The width of the window function.\n\r\t"
+        "Outputs:\n\r\t\t"
+        "rect (numpy.ndarray):\n\r\t\t\t"
+        "The rect function of x.\n\r\t"
+        "Example:\n\r\t\t"
+        ">>> import numpy\n\r\t\t"
+        ">>> import special_functions\n\r\t\t"
+        ">>> x = numpy.arange(-20,20,0.1)\n\r\t\t"
+        ">>> W = 10.0"
+        ">>> y = special_functions.rect(x, W)"
+    },
+    {
+        "kb20",
+        two_var_funcs,
+        kb20_data,
+        two_var_types,
+        3,
+        2,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kb20\n\r\t"
@@ -1154,8 +1105,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kb25",
-        kb25,
-        METH_VARARGS,
+        two_var_funcs,
+        kb25_data,
+        two_var_types,
+        3,
+        2,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kb25\n\r\t"
@@ -1178,8 +1132,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kb35",
-        kb35,
-        METH_VARARGS,
+        two_var_funcs,
+        kb35_data,
+        two_var_types,
+        3,
+        2,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kb35\n\r\t"
@@ -1202,8 +1159,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kbal",
-        kbal,
-        METH_VARARGS,
+        three_var_funcs,
+        kbal_data,
+        three_var_types,
+        3,
+        3,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kbal\n\r\t"
@@ -1227,8 +1187,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kbmd20",
-        kbmd20,
-        METH_VARARGS,
+        two_var_funcs,
+        kbmd20_data,
+        two_var_types,
+        3,
+        2,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kbmd20\n\r\t"
@@ -1251,8 +1214,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kbmd25",
-        kbmd25,
-        METH_VARARGS,
+        two_var_funcs,
+        kbmd25_data,
+        two_var_types,
+        3,
+        2,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kbmd25\n\r\t"
@@ -1275,8 +1241,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kbmd35",
-        kbmd35,
-        METH_VARARGS,
+        two_var_funcs,
+        kbmd35_data,
+        two_var_types,
+        3,
+        2,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kbmd35\n\r\t"
@@ -1299,8 +1268,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "kbmdal",
-        kbmdal,
-        METH_VARARGS,
+        three_var_funcs,
+        kbmdal_data,
+        three_var_types,
+        3,
+        3,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.kbmdal\n\r\t"
@@ -1318,13 +1290,17 @@ static PyMethodDef special_functions_methods[] =
         ">>> import numpy\n\r\t\t"
         ">>> import special_functions\n\r\t\t"
         ">>> x = numpy.arange(-20,20,0.1)\n\r\t\t"
-        ">>> W = 10.0"
-        ">>> y = special_functions.kbmdal(x, W)"
+        ">>> W = 10.0\n\r\t\t"
+        ">>> alpha = 1.8\n\r\t\t"
+        ">>> y = special_functions.kbmdal(x, W, alpha)"
     },
     {
         "besselJ0",
-        besselJ0,
-        METH_VARARGS,
+        one_var_funcs,
+        besselJ0_data,
+        one_var_types,
+        3,
+        1,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.besselJ0\n\r\t"
@@ -1344,8 +1320,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "besselI0",
-        besselI0,
-        METH_VARARGS,
+        one_var_funcs,
+        besselI0_data,
+        one_var_types,
+        4,
+        1,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.besselI0\n\r\t"
@@ -1365,8 +1344,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "fresnel_sin",
-        fresnel_sin,
-        METH_VARARGS,
+        one_var_funcs,
+        fresnel_sin_data,
+        one_var_types,
+        3,
+        1,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.fresnel_sin\n\r\t"
@@ -1386,8 +1368,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "fresnel_cos",
-        fresnel_cos,
-        METH_VARARGS,
+        one_var_funcs,
+        fresnel_cos_data,
+        one_var_types,
+        3,
+        1,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.fresnel_cos\n\r\t"
@@ -1407,8 +1392,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "lambertw",
-        lambertw,
-        METH_VARARGS,
+        one_var_funcs,
+        lambertw_data,
+        one_var_types,
+        3,
+        1,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.lambertw\n\r\t"
@@ -1428,8 +1416,11 @@ static PyMethodDef special_functions_methods[] =
     },
     {
         "sinc",
-        sinc,
-        METH_VARARGS,
+        one_var_funcs,
+        sinc_data,
+        one_var_types,
+        3,
+        1,
         "\r\t"
         "Function:\n\r\t\t"
         "special_functions.sinc\n\r\t"
@@ -1447,232 +1438,85 @@ static PyMethodDef special_functions_methods[] =
         ">>> x = numpy.arange(0,100,0.01)\n\r\t\t"
         ">>> y = special_functions.sinc(x)"
     },
-    {
-        "compute_norm_eq",
-        compute_norm_eq,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.compute_norm_eq\n\r\t"
-        "Purpose:\n\r\t\t"
-        "Compute normalized equivalenth width of a given function.\n\r\t"
-        "Arguments:\n\r\t\t"
-        "w_func (*numpy.ndarray*):\n\r\t\t\t"
-        "Function to compute the normalized equivalent width.\n\r\t"
-        "Outputs:\n\r\t\t"
-        "normeq (*float*):\n\r\t\t\t"
-        "The normalized equivalent width of w_func.\n\r\t"
-        "Notes:\n\r\t\t"
-        "The normalized equivalent width is computed using Riemann\n\r\t\t"
-        "sums to approximate integrals. Therefore large dx values\n\r\t\t"
-        "(Spacing between points) will result in an inaccurate\n\r\t\t"
-        "normeq. One should keep this in mind during calculations.\n\r\t"
-        "Examples:\n\r\t\t"
-        "Compute the Kaiser-Bessel 2.5 window of width 20km and\n\r\t\t"
-        "spacing 0.1 and compute the normalized equivalent width:\n\r\t\t\t"
-        ">>> import special_functions\n\r\t\t\t"
-        ">>> import numpy\n\r\t\t\t"
-        ">>> x = numpy.arange(-10, 10, 0.1)\n\r\t\t\t"
-        ">>> w = special_functions.kb25(x, 20)\n\r\t\t\t"
-        ">>> special_functions.compute_norm_eq(w)\n\r\t\t\t"
-        "1.651925635118099\n\r\t\t"
-        "In contrast, the actual value is 1.6519208. Compute the\n\r\t\t"
-        "normalized equivalent width for the squared cosine window of\n\r\t\t"
-        "width 20 and spacing 0.25.\n\r\t\t\t"
-        ">>> import special_functions\n\r\t\t\t"
-        ">>> import numpy\n\r\t\t\t"
-        ">>> x = numpy.arange(-10, 10, 0.25)\n\r\t\t\t"
-        ">>> w = special_functions.kb25(x, 20)\n\r\t\t\t"
-        ">>> special_functions.compute_norm_eq(w)\n\r\t\t\t"
-        "1.5000000000000013\n\r\t\t"
-        "The normalized equivalent width of the squared cosine\n\r\t\t"
-        "function can be computed exactly using standard methods\n\r\t\t"
-        "from a calculus course. It's value is exactly 1.5."
-    },
-    {
-        "frequency_to_wavelength",
-        frequency_to_wavelength,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.frequency_to_wavelength\n\r\t"
-        "Purpose\n\r\t\t"
-        "Convert a non-zero frequency to the equivalent wavelength.\n\r\t"
-        "Arguments:\n\r\t\t"
-        "frequency (numpy.ndarray/int/float/list):\n\r\t\t\t"
-        "A numpy array or list of real numbers, input frequency in Hz.\n\r\t\t"
-        "Outputs:\n\r\t\t"
-        "wavelength (numpy.ndarry/list/float):\n\r\t\t\t"
-        "The corresponding wavelength in km.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(1,10,0.1)"
-        ">>> y = special_functions.frequency_to_wavelength(x)"
-    },
-    {
-        "max",
-        max,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.max\n\r\t"
-        "Purpose\n\r\t\t"
-        "Compute the maximum of a numpy array.\n\r\t"
-        "Arguments:\n\r\t\t"
-        "arr (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers.\n\r\t"
-        "Outputs:\n\r\t\t"
-        "max (int or float):\n\r\t\t\t"
-        "The maximum value of the input array.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.random.rand(100)\n\r\t\t"
-        ">>> y = special_functions.max(x)"
-    },
-    {
-        "min",
-        min,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.min\n\r\t"
-        "Purpose\n\r\t\t"
-        "Compute the minimum of a numpy array.\n\r\t"
-        "Arguments:\n\r\t\t"
-        "arr (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers.\n\r\t"
-        "Outputs:\n\r\t\t"
-        "min (int or float):\n\r\t\t\t"
-        "The minimum value of the input array.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import _special_functions\n\r\t\t"
-        ">>> x = numpy.random.rand(100)\n\r\t\t"
-        ">>> y = special_functions.min(x)"
-    },
-    {
-        "wavelength_to_wavenumber",
-        wavelength_to_wavenumber,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.wavelength_to_wavenumber\n\r\t"
-        "Purpose\n\r\t\t"
-        "Convert a non-zero wavelength to the equivalent wavenumber.\n\r\t"
-        "Arguments:\n\r\t\t"
-        "wavelength (numpy.ndarray/int/float/list):\n\r\t\t\t"
-        "A numpy array or list of real numbers, the input wavelength.\n\r\t\t"
-        "Outputs:\n\r\t\t"
-        "wavenumber (float):\n\r\t\t\t"
-        "The corresponding wavenumber.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(1,10,0.1)"
-        ">>> y = special_functions.wavelength_to_wavenumber(x)"
-    },
-    {
-        "resolution_inverse",
-        resolution_inverse,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.resolution_inverse\n\r\t"
-        "Purpose\n\r\t\t"
-        "Compute the inverse of y = x/(exp(-x)+x-1).\n\r\t"
-        "Arguments:\n\r\t\t"
-        "x (numpy.ndarray/int/float/list):\n\r\t\t\t"
-        "A numpy array or list of real numbers.\n\r\t\t"
-        "Outputs:\n\r\t\t"
-        "y (float):\n\r\t\t\t"
-        "The inverse of x/(exp(-x)+x-1).\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(1,10,0.1)"
-        ">>> y = special_functions.resolution_inverse(x)"
-    },
-    {
-        "where_greater",
-        where_greater,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.where_greater\n\r\t"
-        "Purpose\n\r\t\t"
-        "Given a real-valued numpy array arr, and a real number\n\r\t\t"
-        "threshold, compute the indices n such that arr[n] > threshold\n\r\t"
-        "Arguments:\n\r\t\t"
-        "arr (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers.\n\r\t\t"
-        "threshold (int or float):\n\r\t\t\t"
-        "The threshold value for comparing arr with."
-        "Outputs:\n\r\t\t"
-        "where_arr (numpy.ndarray):\n\r\t\t\t"
-        "The array of indices such that arr[n] > threshold.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(-5, 5, 0.01)\n\r\t\t"
-        ">>> y = special_functions.where_greater(x, 1.0)"
-    },
-    {
-        "where_lesser",
-        where_lesser,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.where_lesser\n\r\t"
-        "Purpose\n\r\t\t"
-        "Given a real-valued numpy array arr, and a real number\n\r\t\t"
-        "threshold, compute the indices n such that arr[n] < threshold\n\r\t"
-        "Arguments:\n\r\t\t"
-        "arr (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers.\n\r\t\t"
-        "threshold (int or float):\n\r\t\t\t"
-        "The threshold value for comparing arr with."
-        "Outputs:\n\r\t\t"
-        "where_arr (numpy.ndarray):\n\r\t\t\t"
-        "The array of indices such that arr[n] < threshold.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> x = numpy.arange(-5, 5, 0.01)\n\r\t\t"
-        ">>> y = special_functions.where_lesser(x, 1.0)"
-    },
-    {
-        "window_norm",
-        window_norm,
-        METH_VARARGS,
-        "\r\t"
-        "Function:\n\r\t\t"
-        "special_functions.window_norm\n\r\t"
-        "Purpose\n\r\t\t"
-        "Compute the window normalization scheme.\n\r\t"
-        "Arguments:\n\r\t\t"
-        "ker (numpy.ndarray):\n\r\t\t\t"
-        "A numpy array of real numbers, the input function.\n\r\t\t"
-        "dx (int or float):\n\r\t\t\t"
-        "The sample spacing of the input function.\n\r\t\t"
-        "f_scale (int or float):\n\r\t\t\t"
-        "The Fresnel scale in the same units as dx.\n\r\t\t"
-        "Outputs:\n\r\t\t"
-        "window_norm (float):\n\r\t\t\t"
-        "The normalization factor.\n\r\t"
-        "Example:\n\r\t\t"
-        ">>> import numpy\n\r\t\t"
-        ">>> import special_functions\n\r\t\t"
-        ">>> dx = 0.1"
-        ">>> x = numpy.arange(-10,10,dx)\n\r\t\t"
-        ">>> ker = special_functions.coss(x, 5)"
-        ">>> f_scale = 0.5"
-        ">>> y = special_functions.window_norm(ker, dx, f_scale)"
-    },
-    {NULL, NULL, 0, NULL}
+    {NULL, NULL, NULL, NULL, 0, 0, NULL}
 };
 
+/*  The window functions need W, and alpha for kbal and kbmdal, to be          *
+ *  positive. NumPy caches which loop a ufunc dispatches to, so a type         *
+ *  resolver is not called on every call and cannot check this. Instead the    *
+ *  module exposes each window ufunc through a thin wrapper that raises        *
+ *  ValueError for a bad width, as it did before they were ufuncs, and then    *
+ *  calls the ufunc. NaN passes, as it always has.                            */
+#define N_UFUNCS \
+    (sizeof(special_functions_ufuncs) / sizeof(special_functions_ufuncs[0]))
+
+static PyMethodDef window_methods[N_UFUNCS];
+
+static PyObject *window_call(PyObject *ufunc, PyObject *args, PyObject *kwds)
+{
+    PyObject *zero, *arr, *not_positive, *any;
+    Py_ssize_t n, nin;
+    int any_bad;
+
+    /*  If too few inputs were given, the ufunc itself raises the error.      */
+    nin = ((PyUFuncObject *)ufunc)->nin;
+    if (nin > PyTuple_GET_SIZE(args))
+        nin = PyTuple_GET_SIZE(args);
+
+    zero = PyFloat_FromDouble(0.0);
+    if (zero == NULL)
+        return NULL;
+
+    /*  The first input is x. The rest are W and alpha.                       */
+    for (n = 1; n < nin; ++n)
+    {
+        /*  Convert first so that lists and Python numbers compare as          *
+         *  arrays. 0-d arrays compare to a NumPy bool, others to a bool       *
+         *  array, and both of these have the any method.                     */
+        arr = PyArray_FROM_O(PyTuple_GET_ITEM(args, n));
+        if (arr == NULL)
+        {
+            Py_DECREF(zero);
+            return NULL;
+        }
+
+        not_positive = PyObject_RichCompare(arr, zero, Py_LE);
+        Py_DECREF(arr);
+        if (not_positive == NULL)
+        {
+            Py_DECREF(zero);
+            return NULL;
+        }
+
+        any = PyObject_CallMethod(not_positive, "any", NULL);
+        Py_DECREF(not_positive);
+        if (any == NULL)
+        {
+            Py_DECREF(zero);
+            return NULL;
+        }
+
+        any_bad = PyObject_IsTrue(any);
+        Py_DECREF(any);
+
+        if (any_bad != 0)
+        {
+            Py_DECREF(zero);
+            if (any_bad > 0)
+                PyErr_Format(PyExc_ValueError,
+                             "\n\rError Encountered: rss_ringoccs\n"
+                             "\r\tspecial_functions.%s\n\n"
+                             "\r%s must be a positive number.\n",
+                             ((PyUFuncObject *)ufunc)->name,
+                             (n == 1) ? "W" : "alpha");
+            return NULL;
+        }
+    }
+
+    Py_DECREF(zero);
+    return PyObject_Call(ufunc, args, kwds);
+}
+
 static struct PyModuleDef moduledef = {
     PyModuleDef_HEAD_INIT,
     "special_functions",
@@ -1687,10 +1531,54 @@ static struct PyModuleDef moduledef = {
 
 PyMODINIT_FUNC PyInit_special_functions(void)
 {
+    PyObject *ufunc, *wrapper, *module_name;
+    PyMethodDef *method;
+    special_functions_ufunc *def;
     PyObject *m = PyModule_Create(&moduledef);
     if (!m) return NULL;
 
+    module_name = PyModule_GetNameObject(m);
+    if (!module_name)
+    {
+        Py_DECREF(m);
+        return NULL;
+    }
+
     import_array();
+    import_umath();
+
+    for (def = special_functions_ufuncs; def->name != NULL; ++def)
+    {
+        ufunc = PyUFunc_FromFuncAndData(def->funcs, def->data, def->types,
+                                        def->ntypes, def->nin, 1,
+                                        PyUFunc_None, def->name, def->doc, 0);
+
+        /*  Every ufunc with more than one input is a window function, and     *
+         *  is added to the module wrapped by window_call. The wrapper holds   *
+         *  the reference to the ufunc.                                       */
+        if ((ufunc != NULL) && (def->nin > 1))
+        {
+            method = &window_methods[def - special_functions_ufuncs];
+            method->ml_name  = def->name;
+            method->ml_meth  = (PyCFunction)(void (*)(void))window_call;
+            method->ml_flags = METH_VARARGS | METH_KEYWORDS;
+            method->ml_doc   = def->doc;
+
+            wrapper = PyCFunction_NewEx(method, ufunc, module_name);
+            Py_DECREF(ufunc);
+            ufunc = wrapper;
+        }
+
+        /*  PyModule_AddObject steals the reference to ufunc on success.      */
+        if ((ufunc == NULL) || (PyModule_AddObject(m, def->name, ufunc) < 0))
+        {
+            Py_XDECREF(ufunc);
+            Py_DECREF(module_name);
+            Py_DECREF(m);
+            return NULL;
+        }
+    }
 
+    Py_DECREF(module_name);
     return m;
 }
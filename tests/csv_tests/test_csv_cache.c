@@ -0,0 +1,651 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tests the binary caches of the .TAB files. The GEO, CAL, DLP, and TAU *
+ *      files in Test_Data are copied to the working directory and read,      *
+ *      cached, and read again, which must use the cache and give exactly     *
+ *      the same values. A cache older than its .TAB file, and caches that    *
+ *      are truncated or have a bad header, must not be used. With every file *
+ *      cached, rssringoccs_Extract_CSV_Data must give exactly what it gives  *
+ *      from the .TAB files alone.                                            *
+ ******************************************************************************/
+
+/*  utime is POSIX, not C89, and is hidden by -ansi.                          */
+#if defined(__unix__) || defined(__APPLE__)
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#include <sys/types.h>
+#include <utime.h>
+#else
+#include <sys/utime.h>
+#define utime _utime
+#define utimbuf _utimbuf
+#endif
+
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define GEO_COLUMNS 19
+#define CAL_COLUMNS 4
+#define DLP_COLUMNS 13
+#define TAU_COLUMNS 13
+#define CSV_MEMBERS 23
+
+/*  The copies the tests work on, and their caches.                           */
+#define GEO_COPY "test_csv_cache_GEO.TAB"
+#define CAL_COPY "test_csv_cache_CAL.TAB"
+#define DLP_COPY "test_csv_cache_DLP.TAB"
+#define TAU_COPY "test_csv_cache_TAU.TAB"
+#define GEO_CACHE GEO_COPY RSSRINGOCCS_CSV_CACHE_SUFFIX
+#define CAL_CACHE CAL_COPY RSSRINGOCCS_CSV_CACHE_SUFFIX
+#define DLP_CACHE DLP_COPY RSSRINGOCCS_CSV_CACHE_SUFFIX
+#define TAU_CACHE TAU_COPY RSSRINGOCCS_CSV_CACHE_SUFFIX
+
+static rssringoccs_Bool copy_file(const char *from, const char *to)
+{
+    FILE *in, *out;
+    char buffer[4096];
+    size_t n;
+    rssringoccs_Bool success = rssringoccs_True;
+
+    in  = fopen(from, "rb");
+    out = fopen(to, "wb");
+
+    if ((in == NULL) || (out == NULL))
+        success = rssringoccs_False;
+    else
+    {
+        while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0)
+        {
+            if (fwrite(buffer, 1, n, out) != n)
+                success = rssringoccs_False;
+        }
+    }
+
+    if (in != NULL)
+        fclose(in);
+
+    if (out != NULL)
+        fclose(out);
+
+    return success;
+}
+
+/*  Keeps the first size bytes of a file, or flips the byte at size if        *
+ *  flip is set.                                                              */
+static rssringoccs_Bool
+damage_file(const char *filename, unsigned long size, rssringoccs_Bool flip)
+{
+    FILE *fp;
+    char *data;
+    long length;
+    rssringoccs_Bool success = rssringoccs_False;
+
+    fp = fopen(filename, "rb");
+    if (fp == NULL)
+        return rssringoccs_False;
+
+    fseek(fp, 0, SEEK_END);
+    length = ftell(fp);
+    rewind(fp);
+
+    data = malloc((size_t)length);
+    if ((data != NULL) && (length > 0) && ((unsigned long)length > size) &&
+        (fread(data, 1, (size_t)length, fp) == (size_t)length))
+        success = rssringoccs_True;
+
+    fclose(fp);
+
+    if (success)
+    {
+        if (flip)
+            data[size] = (char)~data[size];
+        else
+            length = (long)size;
+
+        fp = fopen(filename, "wb");
+        success = (fp != NULL) &&
+                  (fwrite(data, 1, (size_t)length, fp) == (size_t)length);
+
+        if (fp != NULL)
+            fclose(fp);
+    }
+
+    free(data);
+    return success;
+}
+
+/*  Sets the modification time of a file to an hour before now.               */
+static rssringoccs_Bool make_old(const char *filename)
+{
+    struct utimbuf times;
+    times.actime  = time(NULL) - 3600;
+    times.modtime = times.actime;
+    return utime(filename, &times) == 0;
+}
+
+static void geo_columns(const rssringoccs_GeoCSV *geo, double **c)
+{
+    c[0]  = geo->t_oet_spm_vals;
+    c[1]  = geo->t_ret_spm_vals;
+    c[2]  = geo->t_set_spm_vals;
+    c[3]  = geo->rho_km_vals;
+    c[4]  = geo->phi_rl_deg_vals;
+    c[5]  = geo->phi_ora_deg_vals;
+    c[6]  = geo->B_deg_vals;
+    c[7]  = geo->D_km_vals;
+    c[8]  = geo->rho_dot_kms_vals;
+    c[9]  = geo->phi_rl_dot_kms_vals;
+    c[10] = geo->F_km_vals;
+    c[11] = geo->R_imp_km_vals;
+    c[12] = geo->rx_km_vals;
+    c[13] = geo->ry_km_vals;
+    c[14] = geo->rz_km_vals;
+    c[15] = geo->vx_kms_vals;
+    c[16] = geo->vy_kms_vals;
+    c[17] = geo->vz_kms_vals;
+    c[18] = geo->obs_spacecract_lat_deg_vals;
+}
+
+static void cal_columns(const rssringoccs_CalCSV *cal, double **c)
+{
+    c[0] = cal->t_oet_spm_vals;
+    c[1] = cal->f_sky_pred_vals;
+    c[2] = cal->f_sky_resid_fit_vals;
+    c[3] = cal->p_free_vals;
+}
+
+static void dlp_columns(const rssringoccs_DLPCSV *dlp, double **c)
+{
+    c[0]  = dlp->rho_km_vals;
+    c[1]  = dlp->rho_corr_pole_km_vals;
+    c[2]  = dlp->rho_corr_timing_km_vals;
+    c[3]  = dlp->phi_rl_deg_vals;
+    c[4]  = dlp->phi_ora_deg_vals;
+    c[5]  = dlp->p_norm_vals;
+    c[6]  = dlp->raw_tau_vals;
+    c[7]  = dlp->phase_deg_vals;
+    c[8]  = dlp->raw_tau_threshold_vals;
+    c[9]  = dlp->t_oet_spm_vals;
+    c[10] = dlp->t_ret_spm_vals;
+    c[11] = dlp->t_set_spm_vals;
+    c[12] = dlp->B_deg_vals;
+}
+
+static void tau_columns(const rssringoccs_TauCSV *tau, double **c)
+{
+    c[0]  = tau->rho_km_vals;
+    c[1]  = tau->rho_corr_pole_km_vals;
+    c[2]  = tau->rho_corr_timing_km_vals;
+    c[3]  = tau->phi_rl_deg_vals;
+    c[4]  = tau->phi_ora_deg_vals;
+    c[5]  = tau->power_vals;
+    c[6]  = tau->tau_vals;
+    c[7]  = tau->phase_deg_vals;
+    c[8]  = tau->tau_threshold_vals;
+    c[9]  = tau->t_oet_spm_vals;
+    c[10] = tau->t_ret_spm_vals;
+    c[11] = tau->t_set_spm_vals;
+    c[12] = tau->B_deg_vals;
+}
+
+/*  The members of the output of rssringoccs_Extract_CSV_Data. The last four  *
+ *  are on the tau_rho grid.                                                  */
+static void csv_members(const rssringoccs_CSVData *csv, double **c)
+{
+    c[0]  = csv->rho_km_vals;
+    c[1]  = csv->B_rad_vals;
+    c[2]  = csv->D_km_vals;
+    c[3]  = csv->f_sky_hz_vals;
+    c[4]  = csv->p_norm_vals;
+    c[5]  = csv->raw_tau_vals;
+    c[6]  = csv->phase_rad_vals;
+    c[7]  = csv->phi_rad_vals;
+    c[8]  = csv->phi_rl_rad_vals;
+    c[9]  = csv->raw_tau_threshold_vals;
+    c[10] = csv->rho_corr_pole_km_vals;
+    c[11] = csv->rho_corr_timing_km_vals;
+    c[12] = csv->rho_dot_kms_vals;
+    c[13] = csv->rx_km_vals;
+    c[14] = csv->ry_km_vals;
+    c[15] = csv->rz_km_vals;
+    c[16] = csv->t_oet_spm_vals;
+    c[17] = csv->t_ret_spm_vals;
+    c[18] = csv->t_set_spm_vals;
+    c[19] = csv->tau_rho;
+    c[20] = csv->tau_vals;
+    c[21] = csv->phase_vals;
+    c[22] = csv->power_vals;
+}
+
+/*  Compares two reads of a file, printing the first difference.              */
+static rssringoccs_Bool
+same_columns(const char *what, double **x, double **y,
+             unsigned long n_columns, unsigned long n_rows)
+{
+    unsigned long m, n;
+
+    for (m = 0; m < n_columns; ++m)
+    {
+        if ((x[m] == NULL) || (y[m] == NULL))
+        {
+            printf("%s: column %lu is NULL.\n", what, m);
+            return rssringoccs_False;
+        }
+
+        for (n = 0; n < n_rows; ++n)
+        {
+            if (x[m][n] != y[m][n])
+            {
+                printf("%s: column %lu, row %lu is %.17e, expected %.17e.\n",
+                       what, m, n, x[m][n], y[m][n]);
+                return rssringoccs_False;
+            }
+        }
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Caches a copy of a .TAB file and reads it back, for each type of file.    *
+ *  The second read must come from the cache, and match the first exactly.    */
+static rssringoccs_Bool check_geo_cache(void)
+{
+    rssringoccs_GeoCSV *plain, *cached;
+    double *x[GEO_COLUMNS], *y[GEO_COLUMNS];
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    if (!copy_file("../Test_Data/Rev007E_X43_Maxwell_GEO.TAB", GEO_COPY))
+        return rssringoccs_False;
+
+    remove(GEO_CACHE);
+    plain = rssringoccs_Get_Geo(GEO_COPY, rssringoccs_False);
+
+    if (plain && !plain->error_occurred && !plain->cache &&
+        rssringoccs_Write_GeoCSV_Cache(plain, GEO_CACHE))
+    {
+        cached = rssringoccs_Get_Geo(GEO_COPY, rssringoccs_False);
+        if (cached && !cached->error_occurred && cached->cache &&
+            (cached->n_elements == plain->n_elements))
+        {
+            geo_columns(plain, x);
+            geo_columns(cached, y);
+            pass = same_columns("GEO cache", y, x, GEO_COLUMNS,
+                                plain->n_elements);
+        }
+        else
+            puts("GEO: the cache was not used.");
+
+        rssringoccs_Destroy_GeoCSV(&cached);
+    }
+    else
+        puts("GEO: could not read the file or write the cache.");
+
+    rssringoccs_Destroy_GeoCSV(&plain);
+    remove(GEO_CACHE);
+    remove(GEO_COPY);
+    return pass;
+}
+
+static rssringoccs_Bool check_cal_cache(void)
+{
+    rssringoccs_CalCSV *plain, *cached;
+    double *x[CAL_COLUMNS], *y[CAL_COLUMNS];
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    if (!copy_file("../Test_Data/Rev007E_X43_Maxwell_CAL.TAB", CAL_COPY))
+        return rssringoccs_False;
+
+    remove(CAL_CACHE);
+    plain = rssringoccs_Get_Cal(CAL_COPY);
+
+    if (plain && !plain->error_occurred && !plain->cache &&
+        rssringoccs_Write_CalCSV_Cache(plain, CAL_CACHE))
+    {
+        cached = rssringoccs_Get_Cal(CAL_COPY);
+        if (cached && !cached->error_occurred && cached->cache &&
+            (cached->n_elements == plain->n_elements))
+        {
+            cal_columns(plain, x);
+            cal_columns(cached, y);
+            pass = same_columns("CAL cache", y, x, CAL_COLUMNS,
+                                plain->n_elements);
+        }
+        else
+            puts("CAL: the cache was not used.");
+
+        rssringoccs_Destroy_CalCSV(&cached);
+    }
+    else
+        puts("CAL: could not read the file or write the cache.");
+
+    rssringoccs_Destroy_CalCSV(&plain);
+    remove(CAL_CACHE);
+    remove(CAL_COPY);
+    return pass;
+}
+
+static rssringoccs_Bool check_tau_cache(void)
+{
+    rssringoccs_TauCSV *plain, *cached;
+    double *x[TAU_COLUMNS], *y[TAU_COLUMNS];
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    if (!copy_file("../Test_Data/Rev007E_X43_Maxwell_TAU_1000M.TAB",
+                   TAU_COPY))
+        return rssringoccs_False;
+
+    remove(TAU_CACHE);
+    plain = rssringoccs_Get_Tau(TAU_COPY, rssringoccs_False);
+
+    if (plain && !plain->error_occurred && !plain->cache &&
+        rssringoccs_Write_TauCSV_Cache(plain, TAU_CACHE))
+    {
+        cached = rssringoccs_Get_Tau(TAU_COPY, rssringoccs_False);
+        if (cached && !cached->error_occurred && cached->cache &&
+            (cached->n_elements == plain->n_elements))
+        {
+            tau_columns(plain, x);
+            tau_columns(cached, y);
+            pass = same_columns("TAU cache", y, x, TAU_COLUMNS,
+                                plain->n_elements);
+        }
+        else
+            puts("TAU: the cache was not used.");
+
+        rssringoccs_Destroy_TauCSV(&cached);
+    }
+    else
+        puts("TAU: could not read the file or write the cache.");
+
+    rssringoccs_Destroy_TauCSV(&plain);
+    remove(TAU_CACHE);
+    remove(TAU_COPY);
+    return pass;
+}
+
+/*  Reads the DLP copy, which must come from the .TAB file and not the cache, *
+ *  and compares it with plain.                                               */
+static rssringoccs_Bool
+check_dlp_rejected(const char *what, const rssringoccs_DLPCSV *plain)
+{
+    rssringoccs_DLPCSV *dlp;
+    double *x[DLP_COLUMNS], *y[DLP_COLUMNS];
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    dlp = rssringoccs_Get_DLP(DLP_COPY, rssringoccs_False);
+    if (dlp && !dlp->error_occurred && !dlp->cache &&
+        (dlp->n_elements == plain->n_elements))
+    {
+        dlp_columns(plain, x);
+        dlp_columns(dlp, y);
+        pass = same_columns(what, y, x, DLP_COLUMNS, plain->n_elements);
+    }
+    else
+        printf("%s: the cache was used, or the file could not be read.\n",
+               what);
+
+    rssringoccs_Destroy_DLPCSV(&dlp);
+    return pass;
+}
+
+/*  As above for the DLP file, and then checks that a stale cache, and        *
+ *  corrupt caches, are rejected both by rssringoccs_Get_DLP_Cache and by     *
+ *  rssringoccs_Get_DLP, which must parse the .TAB file instead.              */
+static rssringoccs_Bool check_dlp_cache(void)
+{
+    rssringoccs_DLPCSV *plain, *cached;
+    double *x[DLP_COLUMNS], *y[DLP_COLUMNS];
+    double first_rho;
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    if (!copy_file("../Test_Data/Rev007E_X43_Maxwell_DLP_500M.TAB",
+                   DLP_COPY))
+        return rssringoccs_False;
+
+    remove(DLP_CACHE);
+    plain = rssringoccs_Get_DLP(DLP_COPY, rssringoccs_False);
+
+    if (!plain || plain->error_occurred || plain->cache ||
+        !rssringoccs_Write_DLPCSV_Cache(plain, DLP_CACHE))
+    {
+        puts("DLP: could not read the file or write the cache.");
+        rssringoccs_Destroy_DLPCSV(&plain);
+        remove(DLP_COPY);
+        return rssringoccs_False;
+    }
+
+    cached = rssringoccs_Get_DLP(DLP_COPY, rssringoccs_False);
+    if (cached && !cached->error_occurred && cached->cache &&
+        (cached->n_elements == plain->n_elements))
+    {
+        dlp_columns(plain, x);
+        dlp_columns(cached, y);
+        pass = same_columns("DLP cache", y, x, DLP_COLUMNS,
+                            plain->n_elements);
+    }
+    else
+        puts("DLP: the cache was not used.");
+
+    rssringoccs_Destroy_DLPCSV(&cached);
+
+    /*  A stale cache, with a different first radius so that using it would   *
+     *  be seen, and a modification time before that of the .TAB file.       */
+    first_rho = plain->rho_km_vals[0];
+    plain->rho_km_vals[0] = first_rho + 1.0;
+    pass = pass && rssringoccs_Write_DLPCSV_Cache(plain, DLP_CACHE);
+    plain->rho_km_vals[0] = first_rho;
+
+    if (pass && !make_old(DLP_CACHE))
+    {
+        puts("DLP: could not change the time of the cache.");
+        pass = rssringoccs_False;
+    }
+
+    pass = pass && check_dlp_rejected("DLP stale cache", plain);
+
+    /*  A cache with a bad magic string.                                      */
+    pass = pass && rssringoccs_Write_DLPCSV_Cache(plain, DLP_CACHE) &&
+           damage_file(DLP_CACHE, 0UL, rssringoccs_True) &&
+           check_dlp_rejected("DLP bad magic", plain);
+
+    /*  A cache cut off in the middle of its columns.                         */
+    pass = pass && rssringoccs_Write_DLPCSV_Cache(plain, DLP_CACHE) &&
+           damage_file(DLP_CACHE, 4096UL, rssringoccs_False) &&
+           check_dlp_rejected("DLP truncated cache", plain);
+
+    /*  A cache cut off in its header.                                        */
+    pass = pass && rssringoccs_Write_DLPCSV_Cache(plain, DLP_CACHE) &&
+           damage_file(DLP_CACHE, 20UL, rssringoccs_False) &&
+           check_dlp_rejected("DLP truncated header", plain);
+
+    /*  rssringoccs_Get_DLP_Cache must set an error for the corrupt cache,   *
+     *  and rssringoccs_Get_Geo_Cache for a cache of the wrong kind.          */
+    cached = rssringoccs_Get_DLP_Cache(DLP_CACHE, rssringoccs_False);
+    if (pass && (cached != NULL) && !cached->error_occurred)
+    {
+        puts("DLP: rssringoccs_Get_DLP_Cache read a truncated cache.");
+        pass = rssringoccs_False;
+    }
+
+    rssringoccs_Destroy_DLPCSV(&cached);
+
+    if (pass)
+    {
+        rssringoccs_GeoCSV *geo;
+
+        pass = rssringoccs_Write_DLPCSV_Cache(plain, DLP_CACHE);
+        geo = rssringoccs_Get_Geo_Cache(DLP_CACHE, rssringoccs_False);
+        if (pass && (geo != NULL) && !geo->error_occurred)
+        {
+            puts("DLP: rssringoccs_Get_Geo_Cache read a DLP cache.");
+            pass = rssringoccs_False;
+        }
+
+        rssringoccs_Destroy_GeoCSV(&geo);
+    }
+
+    rssringoccs_Destroy_DLPCSV(&plain);
+    remove(DLP_CACHE);
+    remove(DLP_COPY);
+    return pass;
+}
+
+/*  Writes the cache of each copy, as read from the .TAB file.                */
+static rssringoccs_Bool write_caches(void)
+{
+    rssringoccs_GeoCSV *geo;
+    rssringoccs_CalCSV *cal;
+    rssringoccs_DLPCSV *dlp;
+    rssringoccs_TauCSV *tau;
+    rssringoccs_Bool success;
+
+    geo = rssringoccs_Get_Geo(GEO_COPY, rssringoccs_False);
+    cal = rssringoccs_Get_Cal(CAL_COPY);
+    dlp = rssringoccs_Get_DLP(DLP_COPY, rssringoccs_False);
+    tau = rssringoccs_Get_Tau(TAU_COPY, rssringoccs_False);
+
+    success = geo && !geo->error_occurred &&
+              rssringoccs_Write_GeoCSV_Cache(geo, GEO_CACHE) &&
+              cal && !cal->error_occurred &&
+              rssringoccs_Write_CalCSV_Cache(cal, CAL_CACHE) &&
+              dlp && !dlp->error_occurred &&
+              rssringoccs_Write_DLPCSV_Cache(dlp, DLP_CACHE) &&
+              tau && !tau->error_occurred &&
+              rssringoccs_Write_TauCSV_Cache(tau, TAU_CACHE);
+
+    rssringoccs_Destroy_GeoCSV(&geo);
+    rssringoccs_Destroy_CalCSV(&cal);
+    rssringoccs_Destroy_DLPCSV(&dlp);
+    rssringoccs_Destroy_TauCSV(&tau);
+    return success;
+}
+
+/*  Extracts the data from the .TAB files, then again with every file cached. *
+ *  Both must be the same.                                                    */
+static rssringoccs_Bool check_extract_cache(void)
+{
+    rssringoccs_CSVData *plain, *cached;
+    double *x[CSV_MEMBERS], *y[CSV_MEMBERS];
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    if (!copy_file("../Test_Data/Rev007E_X43_Maxwell_GEO.TAB", GEO_COPY) ||
+        !copy_file("../Test_Data/Rev007E_X43_Maxwell_CAL.TAB", CAL_COPY) ||
+        !copy_file("../Test_Data/Rev007E_X43_Maxwell_DLP_500M.TAB",
+                   DLP_COPY) ||
+        !copy_file("../Test_Data/Rev007E_X43_Maxwell_TAU_1000M.TAB",
+                   TAU_COPY))
+        return rssringoccs_False;
+
+    remove(GEO_CACHE);
+    remove(CAL_CACHE);
+    remove(DLP_CACHE);
+    remove(TAU_CACHE);
+
+    plain = rssringoccs_Extract_CSV_Data(GEO_COPY, CAL_COPY, DLP_COPY,
+                                         TAU_COPY, rssringoccs_False);
+    cached = NULL;
+
+    if (plain && !plain->error_occurred && write_caches())
+    {
+        cached = rssringoccs_Extract_CSV_Data(GEO_COPY, CAL_COPY, DLP_COPY,
+                                              TAU_COPY, rssringoccs_False);
+
+        if (cached && !cached->error_occurred &&
+            (cached->n_elements == plain->n_elements) &&
+            (cached->n_tau_elements == plain->n_tau_elements))
+        {
+            csv_members(plain, x);
+            csv_members(cached, y);
+            pass = same_columns("Extract cached", y, x, CSV_MEMBERS - 4,
+                                plain->n_elements) &&
+                   same_columns("Extract cached TAU", y + CSV_MEMBERS - 4,
+                                x + CSV_MEMBERS - 4, 4,
+                                plain->n_tau_elements);
+        }
+        else
+            puts("Extract: the cached data could not be extracted.");
+    }
+    else
+        puts("Extract: could not extract the data or write the caches.");
+
+    rssringoccs_Destroy_CSV_Members(plain);
+    rssringoccs_Destroy_CSV_Members(cached);
+    free(plain);
+    free(cached);
+
+    remove(GEO_CACHE);
+    remove(CAL_CACHE);
+    remove(DLP_CACHE);
+    remove(TAU_CACHE);
+    remove(GEO_COPY);
+    remove(CAL_COPY);
+    remove(DLP_COPY);
+    remove(TAU_COPY);
+    return pass;
+}
+
+int main(void)
+{
+    rssringoccs_Bool pass = rssringoccs_True;
+
+    if (!check_geo_cache())
+    {
+        puts("GEO cache test failed.");
+        pass = rssringoccs_False;
+    }
+
+    if (!check_cal_cache())
+    {
+        puts("CAL cache test failed.");
+        pass = rssringoccs_False;
+    }
+
+    if (!check_dlp_cache())
+    {
+        puts("DLP cache test failed.");
+        pass = rssringoccs_False;
+    }
+
+    if (!check_tau_cache())
+    {
+        puts("TAU cache test failed.");
+        pass = rssringoccs_False;
+    }
+
+    if (!check_extract_cache())
+    {
+        puts("Extract cache test failed.");
+        pass = rssringoccs_False;
+    }
+
+    if (!pass)
+    {
+        puts("FAIL");
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
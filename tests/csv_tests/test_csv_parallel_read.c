@@ -0,0 +1,367 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tests that the DLP and TAU files in Test_Data, which are large        *
+ *      enough to be split into chunks and parsed in parallel, are read       *
+ *      exactly as a plain serial read with fgets and strtod reads them.      *
+ *      rssringoccs_Read_CSV_Columns, rssringoccs_Read_CSV_Rows over a chunk  *
+ *      boundary, and rssringoccs_Get_DLP and rssringoccs_Get_Tau are all     *
+ *      checked. A copy of the DLP file with a short row in its last chunk    *
+ *      must give the same error as the serial parse.                         *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  Both the DLP and TAU files have 13 columns.                               */
+#define N_COLUMNS 13
+
+static const char *dlp_file = "../Test_Data/Rev007E_X43_Maxwell_DLP_500M.TAB";
+static const char *tau_file = "../Test_Data/Rev007E_X43_Maxwell_TAU_1000M.TAB";
+
+/*  The copy of the DLP file whose last row is cut short.                     */
+#define SHORT_COPY "test_csv_parallel_read_DLP.TAB"
+
+/*  Reads every column of a file with fgets and strtod. Returns the number    *
+ *  of rows, or zero on failure.                                              */
+static unsigned long
+plain_read(const char *filename, double **columns)
+{
+    FILE *fp;
+    char line[1024];
+    char *str, *end;
+    unsigned long n_rows = 0, n, m;
+
+    fp = fopen(filename, "r");
+    if (fp == NULL)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+        n_rows++;
+
+    for (m = 0; m < N_COLUMNS; ++m)
+        columns[m] = malloc(sizeof(*columns[m]) * n_rows);
+
+    rewind(fp);
+    for (n = 0; n < n_rows; ++n)
+    {
+        if (fgets(line, sizeof(line), fp) == NULL)
+            break;
+
+        str = line;
+        for (m = 0; m < N_COLUMNS; ++m)
+        {
+            columns[m][n] = strtod(str, &end);
+            str = strchr(end, ',');
+            if (str == NULL)
+                break;
+
+            str++;
+        }
+    }
+
+    fclose(fp);
+    return n_rows;
+}
+
+/*  Compares n values of x with y, printing the first difference.             */
+static rssringoccs_Bool
+same_values(const char *what, unsigned long column,
+            const double *x, const double *y, unsigned long n)
+{
+    unsigned long k;
+
+    if ((x == NULL) || (y == NULL))
+    {
+        printf("%s: column %lu is NULL.\n", what, column);
+        return rssringoccs_False;
+    }
+
+    for (k = 0; k < n; ++k)
+    {
+        if (x[k] != y[k])
+        {
+            printf("%s: column %lu, row %lu is %.17e, expected %.17e.\n",
+                   what, column, k, x[k], y[k]);
+            return rssringoccs_False;
+        }
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Runs every check on one file. tab_columns are the columns of the struct  *
+ *  read by rssringoccs_Get_DLP or rssringoccs_Get_Tau, in the file's order.  */
+static rssringoccs_Bool
+check_file(const char *filename, double **tab_columns, unsigned long tab_rows)
+{
+    rssringoccs_CSVFile *csv;
+    double *plain[N_COLUMNS], *parsed[N_COLUMNS], *window[N_COLUMNS];
+    unsigned long n_rows, m, first_row, n_window;
+    rssringoccs_Bool pass = rssringoccs_True;
+
+    n_rows = plain_read(filename, plain);
+    csv = rssringoccs_Open_CSV(filename);
+
+    if ((n_rows == 0) || (csv == NULL) || csv->error_occurred)
+    {
+        printf("%s: could not be read.\n", filename);
+        rssringoccs_Destroy_CSVFile(&csv);
+        return rssringoccs_False;
+    }
+
+    /*  The file must be big enough for the chunks to be read in parallel.    */
+    if ((csv->n_chunks < 2) || (csv->n_rows != n_rows) ||
+        (tab_rows != n_rows) || (csv->n_columns != N_COLUMNS))
+    {
+        printf("%s: %lu chunks, %lu and %lu rows, %lu columns.\n",
+               filename, csv->n_chunks, csv->n_rows, tab_rows,
+               csv->n_columns);
+        rssringoccs_Destroy_CSVFile(&csv);
+        return rssringoccs_False;
+    }
+
+    /*  20 rows around the end of the first chunk.                            */
+    first_row = csv->chunk_rows[0] - 10;
+    n_window  = 20;
+
+    for (m = 0; m < N_COLUMNS; ++m)
+    {
+        parsed[m] = malloc(sizeof(*parsed[m]) * n_rows);
+        window[m] = malloc(sizeof(*window[m]) * n_window);
+    }
+
+    rssringoccs_Read_CSV_Columns(csv, parsed);
+    rssringoccs_Read_CSV_Rows(csv, window, first_row, n_window);
+
+    if (csv->error_occurred)
+    {
+        printf("%s: rssringoccs_Read_CSV_Columns failed.\n", filename);
+        pass = rssringoccs_False;
+    }
+
+    for (m = 0; (m < N_COLUMNS) && pass; ++m)
+    {
+        pass = same_values("Read_CSV_Columns", m, parsed[m], plain[m], n_rows)
+            && same_values("Read_CSV_Rows", m, window[m],
+                           plain[m] + first_row, n_window)
+            && same_values("Get", m, tab_columns[m], plain[m], n_rows);
+    }
+
+    for (m = 0; m < N_COLUMNS; ++m)
+    {
+        free(plain[m]);
+        free(parsed[m]);
+        free(window[m]);
+    }
+
+    rssringoccs_Destroy_CSVFile(&csv);
+    return pass;
+}
+
+/*  Copies filename to SHORT_COPY, keeping only the first five columns of its *
+ *  last row.                                                                 */
+static rssringoccs_Bool write_short_copy(const char *filename)
+{
+    FILE *in, *out;
+    char *data;
+    long length, last, n;
+    int commas;
+    rssringoccs_Bool success = rssringoccs_False;
+
+    in = fopen(filename, "rb");
+    if (in == NULL)
+        return rssringoccs_False;
+
+    fseek(in, 0, SEEK_END);
+    length = ftell(in);
+    rewind(in);
+
+    data = malloc((size_t)length);
+    if ((data != NULL) && (length > 1) &&
+        (fread(data, 1, (size_t)length, in) == (size_t)length))
+        success = rssringoccs_True;
+
+    fclose(in);
+
+    if (success)
+    {
+        /*  The start of the last row, skipping the final newline.            */
+        last = length - 2;
+        while ((last > 0) && (data[last - 1] != '\n'))
+            --last;
+
+        commas = 0;
+        for (n = last; (n < length) && (commas < 5); ++n)
+        {
+            if (data[n] == ',')
+                ++commas;
+        }
+
+        out = fopen(SHORT_COPY, "wb");
+        success = (out != NULL) && (commas == 5) &&
+                  (fwrite(data, 1, (size_t)(n - 1), out) == (size_t)(n - 1)) &&
+                  (fputc('\n', out) != EOF);
+
+        if (out != NULL)
+            fclose(out);
+    }
+
+    free(data);
+    return success;
+}
+
+/*  Reads SHORT_COPY in parallel chunks, or serially if serial is set.        *
+ *  Returns the error message, or NULL if there was none.                     */
+static char *read_short_copy(rssringoccs_Bool serial, unsigned long *n_chunks)
+{
+    rssringoccs_CSVFile *csv;
+    double *columns[N_COLUMNS];
+    char *error_message = NULL;
+    unsigned long m;
+
+    csv = rssringoccs_Open_CSV(SHORT_COPY);
+    *n_chunks = 0;
+
+    if ((csv == NULL) || csv->error_occurred)
+    {
+        rssringoccs_Destroy_CSVFile(&csv);
+        return NULL;
+    }
+
+    /*  Without chunks, rssringoccs_Read_CSV_Columns parses the whole file.   */
+    *n_chunks = csv->n_chunks;
+    if (serial)
+        csv->n_chunks = 0;
+
+    for (m = 0; m < N_COLUMNS; ++m)
+        columns[m] = malloc(sizeof(*columns[m]) * csv->n_rows);
+
+    rssringoccs_Read_CSV_Columns(csv, columns);
+
+    if (csv->error_occurred)
+    {
+        error_message = csv->error_message;
+        csv->error_message = NULL;
+    }
+
+    for (m = 0; m < N_COLUMNS; ++m)
+        free(columns[m]);
+
+    rssringoccs_Destroy_CSVFile(&csv);
+    return error_message;
+}
+
+/*  Checks that a short row in the last chunk is reported as it is by the     *
+ *  serial parse.                                                             */
+static rssringoccs_Bool check_short_row(void)
+{
+    char *parallel, *serial;
+    unsigned long n_chunks, n_serial;
+    rssringoccs_Bool pass;
+
+    if (!write_short_copy(dlp_file))
+    {
+        puts("Short row: could not write the copy.");
+        return rssringoccs_False;
+    }
+
+    parallel = read_short_copy(rssringoccs_False, &n_chunks);
+    serial   = read_short_copy(rssringoccs_True, &n_serial);
+    remove(SHORT_COPY);
+
+    pass = (n_chunks >= 2) && (parallel != NULL) && (serial != NULL) &&
+           (strcmp(parallel, serial) == 0);
+
+    if (!pass)
+        printf("Short row: %lu chunks, errors:\n%s\n%s\n", n_chunks,
+               parallel ? parallel : "(none)", serial ? serial : "(none)");
+
+    free(parallel);
+    free(serial);
+    return pass;
+}
+
+int main(void)
+{
+    rssringoccs_DLPCSV *dlp;
+    rssringoccs_TauCSV *tau;
+    double *columns[N_COLUMNS];
+    rssringoccs_Bool pass;
+
+    dlp = rssringoccs_Get_DLP(dlp_file, rssringoccs_False);
+    tau = rssringoccs_Get_Tau(tau_file, rssringoccs_False);
+
+    if ((dlp == NULL) || (tau == NULL) ||
+        dlp->error_occurred || tau->error_occurred)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\ttest_csv_parallel_read\n\n"
+             "Could not read the DLP and TAU files.\n");
+        rssringoccs_Destroy_DLPCSV(&dlp);
+        rssringoccs_Destroy_TauCSV(&tau);
+        return -1;
+    }
+
+    columns[0]  = dlp->rho_km_vals;
+    columns[1]  = dlp->rho_corr_pole_km_vals;
+    columns[2]  = dlp->rho_corr_timing_km_vals;
+    columns[3]  = dlp->phi_rl_deg_vals;
+    columns[4]  = dlp->phi_ora_deg_vals;
+    columns[5]  = dlp->p_norm_vals;
+    columns[6]  = dlp->raw_tau_vals;
+    columns[7]  = dlp->phase_deg_vals;
+    columns[8]  = dlp->raw_tau_threshold_vals;
+    columns[9]  = dlp->t_oet_spm_vals;
+    columns[10] = dlp->t_ret_spm_vals;
+    columns[11] = dlp->t_set_spm_vals;
+    columns[12] = dlp->B_deg_vals;
+    pass = check_file(dlp_file, columns, dlp->n_elements);
+
+    columns[0]  = tau->rho_km_vals;
+    columns[1]  = tau->rho_corr_pole_km_vals;
+    columns[2]  = tau->rho_corr_timing_km_vals;
+    columns[3]  = tau->phi_rl_deg_vals;
+    columns[4]  = tau->phi_ora_deg_vals;
+    columns[5]  = tau->power_vals;
+    columns[6]  = tau->tau_vals;
+    columns[7]  = tau->phase_deg_vals;
+    columns[8]  = tau->tau_threshold_vals;
+    columns[9]  = tau->t_oet_spm_vals;
+    columns[10] = tau->t_ret_spm_vals;
+    columns[11] = tau->t_set_spm_vals;
+    columns[12] = tau->B_deg_vals;
+    pass = check_file(tau_file, columns, tau->n_elements) && pass;
+    pass = check_short_row() && pass;
+
+    rssringoccs_Destroy_DLPCSV(&dlp);
+    rssringoccs_Destroy_TauCSV(&tau);
+
+    if (!pass)
+    {
+        puts("FAIL");
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
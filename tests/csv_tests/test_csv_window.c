@@ -0,0 +1,264 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tests that rssringoccs_Extract_CSV_Data_Window gives exactly the      *
+ *      values of rssringoccs_Extract_CSV_Data on the files in Test_Data:     *
+ *      everything with no window, and the matching slice of every member     *
+ *      for windows of radius and of time. A window that selects only some    *
+ *      columns must give the same slice of those, and NULL for the rest.     *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define N_MEMBERS 19
+#define N_TAU_MEMBERS 4
+
+/*  A selection of columns, for the reconstruction of the phase.              */
+#define SOME_COLUMNS                                                           \
+    (RSSRINGOCCS_CSV_DATA_D_KM | RSSRINGOCCS_CSV_DATA_F_SKY_HZ |               \
+     RSSRINGOCCS_CSV_DATA_PHASE_RAD | RSSRINGOCCS_CSV_DATA_PHI_RAD |           \
+     RSSRINGOCCS_CSV_DATA_T_OET_SPM)
+
+static const char *geo_file = "../Test_Data/Rev007E_X43_Maxwell_GEO.TAB";
+static const char *cal_file = "../Test_Data/Rev007E_X43_Maxwell_CAL.TAB";
+static const char *dlp_file = "../Test_Data/Rev007E_X43_Maxwell_DLP_500M.TAB";
+static const char *tau_file = "../Test_Data/Rev007E_X43_Maxwell_TAU_1000M.TAB";
+
+/*  The members on the rho_km_vals grid. Member m > 0 is selected by the flag *
+ *  1UL << (m-1), rho_km_vals is always extracted.                            */
+static void members(const rssringoccs_CSVData *csv, double **c)
+{
+    c[0]  = csv->rho_km_vals;
+    c[1]  = csv->B_rad_vals;
+    c[2]  = csv->D_km_vals;
+    c[3]  = csv->f_sky_hz_vals;
+    c[4]  = csv->p_norm_vals;
+    c[5]  = csv->raw_tau_vals;
+    c[6]  = csv->phase_rad_vals;
+    c[7]  = csv->phi_rad_vals;
+    c[8]  = csv->phi_rl_rad_vals;
+    c[9]  = csv->raw_tau_threshold_vals;
+    c[10] = csv->rho_corr_pole_km_vals;
+    c[11] = csv->rho_corr_timing_km_vals;
+    c[12] = csv->rho_dot_kms_vals;
+    c[13] = csv->rx_km_vals;
+    c[14] = csv->ry_km_vals;
+    c[15] = csv->rz_km_vals;
+    c[16] = csv->t_oet_spm_vals;
+    c[17] = csv->t_ret_spm_vals;
+    c[18] = csv->t_set_spm_vals;
+}
+
+/*  The members on the tau_rho grid.                                          */
+static void tau_members(const rssringoccs_CSVData *csv, double **c)
+{
+    c[0] = csv->tau_rho;
+    c[1] = csv->tau_vals;
+    c[2] = csv->phase_vals;
+    c[3] = csv->power_vals;
+}
+
+/*  The index of x in arr, or n if it is not there.                           */
+static unsigned long find(const double *arr, unsigned long n, double x)
+{
+    unsigned long k;
+
+    for (k = 0; k < n; ++k)
+    {
+        if (arr[k] == x)
+            break;
+    }
+
+    return k;
+}
+
+/*  Compares n values of column m of win with those of full starting at       *
+ *  offset, printing the first difference.                                    */
+static rssringoccs_Bool
+same_slice(const char *what, unsigned long m, const double *win,
+           const double *full, unsigned long offset, unsigned long n)
+{
+    unsigned long k;
+
+    if ((win == NULL) || (full == NULL))
+    {
+        printf("%s: member %lu is NULL.\n", what, m);
+        return rssringoccs_False;
+    }
+
+    for (k = 0; k < n; ++k)
+    {
+        if (win[k] != full[offset + k])
+        {
+            printf("%s: member %lu, point %lu is %.17e, expected %.17e.\n",
+                   what, m, k, win[k], full[offset + k]);
+            return rssringoccs_False;
+        }
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Checks that a member that was not requested was not extracted.            */
+static rssringoccs_Bool
+not_read(const char *what, unsigned long m, const double *win)
+{
+    if (win != NULL)
+    {
+        printf("%s: member %lu was not requested, but is not NULL.\n",
+               what, m);
+        return rssringoccs_False;
+    }
+
+    return rssringoccs_True;
+}
+
+/*  Extracts the members selected by columns in a window, and checks them     *
+ *  against full.                                                             */
+static rssringoccs_Bool
+check_window(const char *what, const rssringoccs_CSVData *full,
+             unsigned long columns, rssringoccs_CSV_Window_Type window,
+             double start, double end)
+{
+    rssringoccs_CSVData *win;
+    double *x[N_MEMBERS], *y[N_MEMBERS];
+    unsigned long m, offset, tau_offset;
+    rssringoccs_Bool pass = rssringoccs_True;
+    rssringoccs_Bool use_tau = (columns & RSSRINGOCCS_CSV_DATA_TAU) != 0;
+
+    win = rssringoccs_Extract_CSV_Data_Window(geo_file, cal_file, dlp_file,
+                                              tau_file, rssringoccs_False,
+                                              columns, window, start, end);
+
+    if ((win == NULL) || win->error_occurred || (win->n_elements == 0))
+    {
+        printf("%s: the window could not be extracted.\n", what);
+        rssringoccs_Destroy_CSV_Members(win);
+        free(win);
+        return rssringoccs_False;
+    }
+
+    offset = find(full->rho_km_vals, full->n_elements, win->rho_km_vals[0]);
+    tau_offset = 0;
+    if (use_tau && (win->tau_rho != NULL))
+        tau_offset = find(full->tau_rho, full->n_tau_elements,
+                          win->tau_rho[0]);
+
+    if ((offset + win->n_elements > full->n_elements) ||
+        (use_tau && (tau_offset + win->n_tau_elements > full->n_tau_elements)))
+    {
+        printf("%s: the window is not a slice of the full data.\n", what);
+        pass = rssringoccs_False;
+    }
+
+    members(win, x);
+    members(full, y);
+    for (m = 0; (m < N_MEMBERS) && pass; ++m)
+    {
+        if ((m == 0) || (columns & (1UL << (m-1))))
+            pass = same_slice(what, m, x[m], y[m], offset, win->n_elements);
+        else
+            pass = not_read(what, m, x[m]);
+    }
+
+    tau_members(win, x);
+    tau_members(full, y);
+    for (m = 0; (m < N_TAU_MEMBERS) && pass; ++m)
+    {
+        if (use_tau)
+            pass = same_slice(what, N_MEMBERS + m, x[m], y[m],
+                              tau_offset, win->n_tau_elements);
+        else
+            pass = not_read(what, N_MEMBERS + m, x[m]);
+    }
+
+    if (pass)
+        printf("%s: %lu of %lu points.\n", what, win->n_elements,
+               full->n_elements);
+
+    rssringoccs_Destroy_CSV_Members(win);
+    free(win);
+    return pass;
+}
+
+int main(void)
+{
+    rssringoccs_CSVData *full;
+    double t_start, t_end;
+    unsigned long n;
+    rssringoccs_Bool pass;
+
+    full = rssringoccs_Extract_CSV_Data(geo_file, cal_file, dlp_file,
+                                        tau_file, rssringoccs_False);
+
+    if ((full == NULL) || full->error_occurred)
+    {
+        puts("Error Encountered: rss_ringoccs\n"
+             "\ttest_csv_window\n\n"
+             "rssringoccs_Extract_CSV_Data failed.\n");
+        rssringoccs_Destroy_CSV_Members(full);
+        free(full);
+        return -1;
+    }
+
+    /*  A time window over the middle third of the occultation.               */
+    n = full->n_elements;
+    t_start = full->t_oet_spm_vals[n/3];
+    t_end   = full->t_oet_spm_vals[2*n/3];
+    if (t_start > t_end)
+    {
+        t_start = full->t_oet_spm_vals[2*n/3];
+        t_end   = full->t_oet_spm_vals[n/3];
+    }
+
+    pass = check_window("No window", full, RSSRINGOCCS_CSV_DATA_ALL,
+                        rssringoccs_CSV_No_Window, 0.0, 0.0);
+
+    pass = check_window("Radius window", full, RSSRINGOCCS_CSV_DATA_ALL,
+                        rssringoccs_CSV_Radius_Window,
+                        87400.0, 87600.0) && pass;
+
+    pass = check_window("SPM window", full, RSSRINGOCCS_CSV_DATA_ALL,
+                        rssringoccs_CSV_SPM_Window, t_start, t_end) && pass;
+
+    /*  Some of the GEO, DLP, and CAL columns, with and without the TAU file. */
+    pass = check_window("Some columns", full, SOME_COLUMNS,
+                        rssringoccs_CSV_Radius_Window,
+                        87400.0, 87600.0) && pass;
+
+    pass = check_window("Some columns and TAU", full,
+                        SOME_COLUMNS | RSSRINGOCCS_CSV_DATA_TAU,
+                        rssringoccs_CSV_Radius_Window,
+                        87400.0, 87600.0) && pass;
+
+    rssringoccs_Destroy_CSV_Members(full);
+    free(full);
+
+    if (!pass)
+    {
+        puts("FAIL");
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
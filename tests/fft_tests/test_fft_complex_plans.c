@@ -0,0 +1,233 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tests every complex FFT plan against a naive O(N^2) DFT. The sizes    *
+ *      cover powers of two (radix-2, radix-4, and split-radix), products of  *
+ *      2, 3, and 5 (mixed-radix), and odd primes and other sizes             *
+ *      (Bluestein). Each plan is run forward, inverse, and in place, and the *
+ *      inverse of the forward transform must give back the input.            *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*  Largest error allowed, relative to the largest output of the naive DFT.   */
+#define TOLERANCE 1.0e-12
+
+typedef struct {
+    unsigned long N;
+    unsigned int flags;
+    rssringoccs_FFT_Algorithm algorithm;
+} fft_case;
+
+static const fft_case cases[] = {
+    /*  Powers of two, with each of the three algorithms.                     */
+    {1UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Radix_4},
+    {2UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Radix_4},
+    {8UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Radix_4},
+    {64UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Radix_4},
+    {512UL,  RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Radix_4},
+    {1024UL, RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Radix_4},
+    {2UL,    RSSRINGOCCS_FFT_RADIX_2,     rssringoccs_FFT_Radix_2},
+    {16UL,   RSSRINGOCCS_FFT_RADIX_2,     rssringoccs_FFT_Radix_2},
+    {1024UL, RSSRINGOCCS_FFT_RADIX_2,     rssringoccs_FFT_Radix_2},
+    {2UL,    RSSRINGOCCS_FFT_SPLIT_RADIX, rssringoccs_FFT_Split_Radix},
+    {4UL,    RSSRINGOCCS_FFT_SPLIT_RADIX, rssringoccs_FFT_Split_Radix},
+    {32UL,   RSSRINGOCCS_FFT_SPLIT_RADIX, rssringoccs_FFT_Split_Radix},
+    {2048UL, RSSRINGOCCS_FFT_SPLIT_RADIX, rssringoccs_FFT_Split_Radix},
+
+    /*  Products of 2, 3, and 5.                                              */
+    {3UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {5UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {6UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {12UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {45UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {100UL,  RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {360UL,  RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+    {1000UL, RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Mixed_Radix},
+
+    /*  Odd primes and sizes with a prime factor larger than 5.               */
+    {7UL,    RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein},
+    {11UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein},
+    {97UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein},
+    {1009UL, RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein},
+    {14UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein},
+    {77UL,   RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein},
+    {1018UL, RSSRINGOCCS_FFT_DEFAULT,     rssringoccs_FFT_Bluestein}
+};
+
+/*  Computes the DFT of x directly. The exponent k n is reduced mod N first   *
+ *  so the twiddle factors are accurate for every size.                       */
+static void
+naive_dft(const rssringoccs_ComplexDouble *x, rssringoccs_ComplexDouble *X,
+          unsigned long N, rssringoccs_Bool inverse)
+{
+    unsigned long k, n;
+    double sign = inverse ? 1.0 : -1.0;
+    double theta, c, s, re, im, x_re, x_im;
+    const double two_pi = 6.283185307179586476925286766559;
+
+    for (k = 0; k < N; ++k)
+    {
+        re = 0.0;
+        im = 0.0;
+        for (n = 0; n < N; ++n)
+        {
+            theta = sign * two_pi * (double)((k * n) % N) / (double)N;
+            c = cos(theta);
+            s = sin(theta);
+            x_re = rssringoccs_CDouble_Real_Part(x[n]);
+            x_im = rssringoccs_CDouble_Imag_Part(x[n]);
+            re += x_re*c - x_im*s;
+            im += x_re*s + x_im*c;
+        }
+
+        /*  The inverse plans are normalized by 1/N by default.               */
+        if (inverse)
+        {
+            re /= (double)N;
+            im /= (double)N;
+        }
+
+        X[k] = rssringoccs_CDouble_Rect(re, im);
+    }
+}
+
+/*  The largest |y[n] - y_ref[n]| relative to the largest |y_ref[n]|.         */
+static double
+rel_error(const rssringoccs_ComplexDouble *y,
+          const rssringoccs_ComplexDouble *y_ref, unsigned long N)
+{
+    unsigned long n;
+    double err = 0.0, scale = 0.0, tmp;
+
+    for (n = 0; n < N; ++n)
+    {
+        tmp = rssringoccs_CDouble_Abs(rssringoccs_CDouble_Subtract(y[n],
+                                                                   y_ref[n]));
+        if (err < tmp)
+            err = tmp;
+
+        tmp = rssringoccs_CDouble_Abs(y_ref[n]);
+        if (scale < tmp)
+            scale = tmp;
+    }
+
+    /*  err != err catches a NaN in the plan's output.                        */
+    if (err != err)
+        return 1.0;
+
+    return (scale == 0.0) ? err : err / scale;
+}
+
+/*  Runs one case, returning rssringoccs_False and printing why on failure.   */
+static rssringoccs_Bool run_case(const fft_case *test)
+{
+    rssringoccs_FFT_Plan *forward, *inverse;
+    rssringoccs_ComplexDouble *x, *X, *X_ref, *y;
+    double err_forward, err_inverse, err_in_place, err_round_trip;
+    unsigned long n, N = test->N;
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    forward = rssringoccs_FFT_Plan_Create(N, rssringoccs_False, test->flags);
+    inverse = rssringoccs_FFT_Plan_Create(N, rssringoccs_True, test->flags);
+    x     = malloc(sizeof(*x) * N);
+    X     = malloc(sizeof(*X) * N);
+    X_ref = malloc(sizeof(*X_ref) * N);
+    y     = malloc(sizeof(*y) * N);
+
+    if (!forward || !inverse || !x || !X || !X_ref || !y)
+        printf("N = %lu: plan creation or malloc failed.\n", N);
+
+    else if ((forward->algorithm != test->algorithm) ||
+             (inverse->algorithm != test->algorithm))
+        printf("N = %lu: expected algorithm %d, plan has %d.\n",
+               N, (int)test->algorithm, (int)forward->algorithm);
+
+    else
+    {
+        for (n = 0; n < N; ++n)
+            x[n] = rssringoccs_CDouble_Rect((double)rand() / RAND_MAX - 0.5,
+                                            (double)rand() / RAND_MAX - 0.5);
+
+        /*  Forward transform.                                                */
+        naive_dft(x, X_ref, N, rssringoccs_False);
+        rssringoccs_FFT_Plan_Execute(forward, x, X);
+        err_forward = rel_error(X, X_ref, N);
+
+        /*  Inverse of the forward transform, which should give back x.       */
+        rssringoccs_FFT_Plan_Execute(inverse, X, y);
+        err_round_trip = rel_error(y, x, N);
+
+        /*  Inverse transform of x itself.                                    */
+        naive_dft(x, X_ref, N, rssringoccs_True);
+        rssringoccs_FFT_Plan_Execute(inverse, x, y);
+        err_inverse = rel_error(y, X_ref, N);
+
+        /*  Forward transform done in place.                                  */
+        for (n = 0; n < N; ++n)
+            y[n] = x[n];
+
+        rssringoccs_FFT_Plan_Execute(forward, y, y);
+        err_in_place = rel_error(y, X, N);
+
+        printf("N = %4lu, algorithm %d: forward %.3e, inverse %.3e, "
+               "in place %.3e, round trip %.3e\n", N, (int)test->algorithm,
+               err_forward, err_inverse, err_in_place, err_round_trip);
+
+        pass = (err_forward <= TOLERANCE) && (err_inverse <= TOLERANCE) &&
+               (err_in_place <= TOLERANCE) && (err_round_trip <= TOLERANCE);
+    }
+
+    rssringoccs_FFT_Plan_Destroy(forward);
+    rssringoccs_FFT_Plan_Destroy(inverse);
+    free(x);
+    free(X);
+    free(X_ref);
+    free(y);
+    return pass;
+}
+
+int main(void)
+{
+    unsigned long n;
+    unsigned long n_cases = sizeof(cases) / sizeof(cases[0]);
+    unsigned long n_failed = 0;
+
+    srand(1);
+
+    for (n = 0; n < n_cases; ++n)
+    {
+        if (!run_case(&cases[n]))
+            ++n_failed;
+    }
+
+    if (n_failed > 0)
+    {
+        printf("FAIL: %lu of %lu cases.\n", n_failed, n_cases);
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
@@ -0,0 +1,206 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tests the real FFT plans, made with RSSRINGOCCS_FFT_REAL_INPUT,       *
+ *      against a naive O(N^2) DFT. Even sizes use a complex plan of size     *
+ *      N/2, which is radix-4, mixed-radix, or Bluestein, and odd sizes a     *
+ *      complex plan of size N. The forward and inverse transforms are        *
+ *      checked, and the inverse complex transform of the full spectrum,      *
+ *      rebuilt from X_{N-k} = conj(X_k), must give back the input.           *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_fft.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*  Largest error allowed, relative to the largest output of the naive DFT.   */
+#define TOLERANCE 1.0e-12
+
+/*  Powers of two, products of 2, 3, and 5, odd primes, and other sizes.      */
+static const unsigned long sizes[] = {
+    1UL, 2UL, 4UL, 8UL, 64UL, 1024UL, 2048UL,
+    6UL, 12UL, 30UL, 100UL, 360UL, 1000UL,
+    3UL, 5UL, 7UL, 13UL, 97UL, 1009UL,
+    14UL, 22UL, 77UL, 1018UL, 1022UL
+};
+
+/*  Computes the first n_out values of the DFT of the real array x directly.  *
+ *  The exponent k n is reduced mod N first so the twiddle factors are        *
+ *  accurate for every size.                                                  */
+static void
+naive_dft(const double *x, rssringoccs_ComplexDouble *X, unsigned long N,
+          unsigned long n_out, rssringoccs_Bool inverse)
+{
+    unsigned long k, n;
+    double sign = inverse ? 1.0 : -1.0;
+    double theta, re, im;
+    const double two_pi = 6.283185307179586476925286766559;
+
+    for (k = 0; k < n_out; ++k)
+    {
+        re = 0.0;
+        im = 0.0;
+        for (n = 0; n < N; ++n)
+        {
+            theta = sign * two_pi * (double)((k * n) % N) / (double)N;
+            re += x[n] * cos(theta);
+            im += x[n] * sin(theta);
+        }
+
+        /*  The inverse plans are normalized by 1/N by default.               */
+        if (inverse)
+        {
+            re /= (double)N;
+            im /= (double)N;
+        }
+
+        X[k] = rssringoccs_CDouble_Rect(re, im);
+    }
+}
+
+/*  The largest |y[n] - y_ref[n]| relative to the largest |y_ref[n]|.         */
+static double
+rel_error(const rssringoccs_ComplexDouble *y,
+          const rssringoccs_ComplexDouble *y_ref, unsigned long N)
+{
+    unsigned long n;
+    double err = 0.0, scale = 0.0, tmp;
+
+    for (n = 0; n < N; ++n)
+    {
+        tmp = rssringoccs_CDouble_Abs(rssringoccs_CDouble_Subtract(y[n],
+                                                                   y_ref[n]));
+        if (err < tmp)
+            err = tmp;
+
+        tmp = rssringoccs_CDouble_Abs(y_ref[n]);
+        if (scale < tmp)
+            scale = tmp;
+    }
+
+    /*  err != err catches a NaN in the plan's output.                        */
+    if (err != err)
+        return 1.0;
+
+    return (scale == 0.0) ? err : err / scale;
+}
+
+/*  Runs one size, returning rssringoccs_False and printing why on failure.   */
+static rssringoccs_Bool run_size(unsigned long N)
+{
+    rssringoccs_FFT_Plan *forward, *inverse, *complex_inverse;
+    rssringoccs_ComplexDouble *X, *X_ref, *full, *z;
+    double *x;
+    double err_forward, err_inverse, err_round_trip;
+    unsigned long n, n_out = N/2 + 1;
+    rssringoccs_Bool pass = rssringoccs_False;
+    const unsigned int flags = RSSRINGOCCS_FFT_REAL_INPUT;
+
+    forward = rssringoccs_FFT_Plan_Create(N, rssringoccs_False, flags);
+    inverse = rssringoccs_FFT_Plan_Create(N, rssringoccs_True, flags);
+    complex_inverse = rssringoccs_FFT_Plan_Create(N, rssringoccs_True,
+                                                  RSSRINGOCCS_FFT_DEFAULT);
+    x     = malloc(sizeof(*x) * N);
+    X     = malloc(sizeof(*X) * n_out);
+    X_ref = malloc(sizeof(*X_ref) * n_out);
+    full  = malloc(sizeof(*full) * N);
+    z     = malloc(sizeof(*z) * N);
+
+    if (!forward || !inverse || !complex_inverse ||
+        !x || !X || !X_ref || !full || !z)
+        printf("N = %lu: plan creation or malloc failed.\n", N);
+
+    else if ((forward->algorithm != rssringoccs_FFT_Real) ||
+             (inverse->algorithm != rssringoccs_FFT_Real))
+        printf("N = %lu: expected a real plan, plan has algorithm %d.\n",
+               N, (int)forward->algorithm);
+
+    else
+    {
+        for (n = 0; n < N; ++n)
+            x[n] = (double)rand() / RAND_MAX - 0.5;
+
+        /*  Forward transform.                                                */
+        naive_dft(x, X_ref, N, n_out, rssringoccs_False);
+        rssringoccs_FFT_Plan_Execute_Real(forward, x, X);
+        err_forward = rel_error(X, X_ref, n_out);
+
+        /*  Rebuild the full spectrum and transform it back to x.             */
+        for (n = 0; n < n_out; ++n)
+            full[n] = X[n];
+
+        for (n = n_out; n < N; ++n)
+            full[n] = rssringoccs_CDouble_Conjugate(X[N - n]);
+
+        rssringoccs_FFT_Plan_Execute(complex_inverse, full, z);
+
+        for (n = 0; n < N; ++n)
+            full[n] = rssringoccs_CDouble_Rect(x[n], 0.0);
+
+        err_round_trip = rel_error(z, full, N);
+
+        /*  Inverse transform of x itself.                                    */
+        naive_dft(x, X_ref, N, n_out, rssringoccs_True);
+        rssringoccs_FFT_Plan_Execute_Real(inverse, x, X);
+        err_inverse = rel_error(X, X_ref, n_out);
+
+        printf("N = %4lu: forward %.3e, inverse %.3e, round trip %.3e\n",
+               N, err_forward, err_inverse, err_round_trip);
+
+        pass = (err_forward <= TOLERANCE) && (err_inverse <= TOLERANCE) &&
+               (err_round_trip <= TOLERANCE);
+    }
+
+    rssringoccs_FFT_Plan_Destroy(forward);
+    rssringoccs_FFT_Plan_Destroy(inverse);
+    rssringoccs_FFT_Plan_Destroy(complex_inverse);
+    free(x);
+    free(X);
+    free(X_ref);
+    free(full);
+    free(z);
+    return pass;
+}
+
+int main(void)
+{
+    unsigned long n;
+    unsigned long n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+    unsigned long n_failed = 0;
+
+    srand(1);
+
+    for (n = 0; n < n_sizes; ++n)
+    {
+        if (!run_size(sizes[n]))
+            ++n_failed;
+    }
+
+    if (n_failed > 0)
+    {
+        printf("FAIL: %lu of %lu sizes.\n", n_failed, n_sizes);
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
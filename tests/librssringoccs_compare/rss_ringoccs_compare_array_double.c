@@ -0,0 +1,261 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provide functions for comparing the array functions of rss_ringoccs,  *
+ *      which compute f(x[n]) for a whole array at once, with the scalar      *
+ *      functions of other libraries called in a loop.                        *
+ *  NOTE:                                                                     *
+ *      Unlike the other compare functions, these return the maximum error    *
+ *      so that the tests may fail when it is too large. The error is the     *
+ *      relative error |y0 - y1| / |y0|, or the absolute error if y0 = 0.     *
+ ******************************************************************************/
+
+/*  Library for timing computations.                                          */
+#include <time.h>
+
+/*  Needed for printing the outputs.                                          */
+#include <stdio.h>
+
+/*  Needed for malloc.                                                        */
+#include <stdlib.h>
+
+/*  Needed for fabs, DBL_MIN, and DBL_MAX.                                    */
+#include <math.h>
+#include <float.h>
+
+/*  Prototypes for these functions found here.                                */
+#include "rss_ringoccs_compare_funcs.h"
+
+/*  Inputs every array function is checked at, besides the sampled region.     *
+ *  The last four are a subnormal, infinity, negative infinity, and NaN.      */
+#define __N_SPECIAL 11U
+
+static void __fill_special(double *x)
+{
+    double zero = 0.0;
+
+    x[0]  = 0.0;
+    x[1]  = -0.0;
+    x[2]  = 1.0;
+    x[3]  = -1.0;
+    x[4]  = DBL_MIN;
+    x[5]  = DBL_MAX;
+    x[6]  = -DBL_MAX;
+    x[7]  = DBL_MIN * 0.25;
+    x[8]  = 1.0 / zero;
+    x[9]  = -1.0 / zero;
+    x[10] = zero / zero;
+}
+
+/*  The error of y1 as an approximation of y0. Infinities must match exactly,  *
+ *  and a NaN in one but not the other counts as an infinite error.           */
+static double __error(double y0, double y1)
+{
+    double zero = 0.0;
+
+    if (y0 != y0)
+        return (y1 != y1) ? 0.0 : 1.0 / zero;
+    else if (y1 != y1)
+        return 1.0 / zero;
+    else if (y0 == y1)
+        return 0.0;
+    else if (y0 == 0.0)
+        return fabs(y1);
+    else
+        return fabs((y0 - y1) / y0);
+}
+
+/*  Checks f1 at the special values, printing any more than an ulp from f0.   */
+static double
+__check_special(double (*f0)(double),
+                void (*f1)(const double *, double *, unsigned long))
+{
+    double x[__N_SPECIAL], y[__N_SPECIAL];
+    double max_err = 0.0;
+    double err;
+    unsigned int n;
+
+    __fill_special(x);
+    f1(x, y, __N_SPECIAL);
+
+    for (n = 0U; n < __N_SPECIAL; ++n)
+    {
+        err = __error(f0(x[n]), y[n]);
+
+        if (err > DBL_EPSILON)
+            printf("Special Value: f(%e) = %e, expected %e\n",
+                   x[n], y[n], f0(x[n]));
+
+        if (max_err < err)
+            max_err = err;
+    }
+
+    return max_err;
+}
+
+/*  Routine for comparing a scalar function with an array function.           */
+RSS_RINGOCCS_COMPARE_EXPORT double
+rssringoccs_Compare_Double_Array_Funcs(
+    const char *f0_name,
+    double (*f0)(double),
+    const char *f1_name,
+    void (*f1)(const double *, double *, unsigned long),
+    const double start,
+    const double end,
+    const unsigned long N)
+{
+    double dx, temp, special_err;
+    double max_err = 0.0;
+    double *x, *y0, *y1;
+    unsigned long n;
+    clock_t t1, t2;
+
+    if ((start >= end) || (N == 0))
+    {
+        puts("\nError Encountered: rss_ringoccs\n"
+             "\r\trssringoccs_Compare_Double_Array_Funcs\n\n"
+             "Invalid sample region. Aborting computation.\n");
+        return 1.0;
+    }
+
+    dx = (end - start) / N;
+    x  = (double *)malloc(sizeof(*x) * N);
+    y0 = (double *)malloc(sizeof(*y0) * N);
+    y1 = (double *)malloc(sizeof(*y1) * N);
+
+    if ((x == NULL) || (y0 == NULL) || (y1 == NULL))
+    {
+        puts("\nError Encountered: rss_ringoccs\n"
+             "\r\trssringoccs_Compare_Double_Array_Funcs\n\n"
+             "Malloc failed. Aborting computation.\n");
+        free(x);
+        free(y0);
+        free(y1);
+        return 1.0;
+    }
+
+    for (n = 0; n < N; ++n)
+        x[n] = start + (double)n * dx;
+
+    t1 = clock();
+    for (n = 0; n < N; ++n)
+        y0[n] = f0(x[n]);
+    t2 = clock();
+    printf("%s: %f\n", f0_name, (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    t1 = clock();
+    f1(x, y1, N);
+    t2 = clock();
+    printf("%s: %f\n", f1_name, (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    for (n = 0; n < N; ++n)
+    {
+        temp = __error(y0[n], y1[n]);
+        if (max_err < temp)
+            max_err = temp;
+    }
+
+    printf("Max Rel Error: %.16e\n", max_err);
+
+    special_err = __check_special(f0, f1);
+    if (max_err < special_err)
+        max_err = special_err;
+
+    free(x);
+    free(y0);
+    free(y1);
+    return max_err;
+}
+/*  End of rssringoccs_Compare_Double_Array_Funcs.                            */
+
+/*  Routine for comparing a scalar function with a strided array function.     *
+ *  x is read with a step of 2 and y is written backwards, with a step of -1. */
+RSS_RINGOCCS_COMPARE_EXPORT double
+rssringoccs_Compare_Double_Strided_Funcs(
+    const char *f0_name,
+    double (*f0)(double),
+    const char *f1_name,
+    void (*f1)(const double *, long, double *, long, unsigned long),
+    const double start,
+    const double end,
+    const unsigned long N)
+{
+    double dx, temp;
+    double max_err = 0.0;
+    double *x, *y0, *y1;
+    unsigned long n;
+    clock_t t1, t2;
+
+    if ((start >= end) || (N == 0))
+    {
+        puts("\nError Encountered: rss_ringoccs\n"
+             "\r\trssringoccs_Compare_Double_Strided_Funcs\n\n"
+             "Invalid sample region. Aborting computation.\n");
+        return 1.0;
+    }
+
+    dx = (end - start) / N;
+    x  = (double *)malloc(sizeof(*x) * 2 * N);
+    y0 = (double *)malloc(sizeof(*y0) * N);
+    y1 = (double *)malloc(sizeof(*y1) * N);
+
+    if ((x == NULL) || (y0 == NULL) || (y1 == NULL))
+    {
+        puts("\nError Encountered: rss_ringoccs\n"
+             "\r\trssringoccs_Compare_Double_Strided_Funcs\n\n"
+             "Malloc failed. Aborting computation.\n");
+        free(x);
+        free(y0);
+        free(y1);
+        return 1.0;
+    }
+
+    /*  The odd elements of x are poison that must not be read.               */
+    for (n = 0; n < N; ++n)
+    {
+        x[2*n]   = start + (double)n * dx;
+        x[2*n+1] = -1.0;
+    }
+
+    t1 = clock();
+    for (n = 0; n < N; ++n)
+        y0[n] = f0(x[2*n]);
+    t2 = clock();
+    printf("%s: %f\n", f0_name, (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    t1 = clock();
+    f1(x, 2L, y1 + (N - 1), -1L, N);
+    t2 = clock();
+    printf("%s: %f\n", f1_name, (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    for (n = 0; n < N; ++n)
+    {
+        temp = __error(y0[n], y1[N - 1 - n]);
+        if (max_err < temp)
+            max_err = temp;
+    }
+
+    printf("Max Rel Error: %.16e\n", max_err);
+
+    free(x);
+    free(y0);
+    free(y1);
+    return max_err;
+}
+/*  End of rssringoccs_Compare_Double_Strided_Funcs.                          */
@@ -69,6 +69,26 @@ rssringoccs_Compare_LDouble_Funcs(
     const long double end,
     const unsigned long N);
 
+RSS_RINGOCCS_COMPARE_EXPORT extern double
+rssringoccs_Compare_Double_Array_Funcs(
+    const char *f0_name,
+    double (*f0)(double),
+    const char *f1_name,
+    void (*f1)(const double *, double *, unsigned long),
+    const double start,
+    const double end,
+    const unsigned long N);
+
+RSS_RINGOCCS_COMPARE_EXPORT extern double
+rssringoccs_Compare_Double_Strided_Funcs(
+    const char *f0_name,
+    double (*f0)(double),
+    const char *f1_name,
+    void (*f1)(const double *, long, double *, long, unsigned long),
+    const double start,
+    const double end,
+    const unsigned long N);
+
 RSS_RINGOCCS_COMPARE_EXPORT extern void
 rssringoccs_Compare_CFloat_Funcs(
     const char *f0_name,
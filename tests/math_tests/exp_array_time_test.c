@@ -0,0 +1,68 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provide tests for the accuracy and efficiency of                      *
+ *      rssringoccs_Double_Exp_Array and its _Strided version                 *
+ *      compared to the exp function provided by math.h.                      *
+ *      The test fails if the relative error is more than 1.0e-15,            *
+ *      or if a special value (zero, infinity, NaN, ...) disagrees.           *
+ ******************************************************************************/
+
+/*  The exponential functions are found here.                                 */
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <math.h>
+#include <stdio.h>
+
+/*  The comparison functions are found here.                                  */
+#include <rss_ringoccs/tests/librssringoccs_compare/rss_ringoccs_compare_funcs.h>
+
+/*  Routine for comparing exp with rssringoccs_Double_Exp_Array.              */
+int main(void)
+{
+    /*  Set the start and end for the values we're testing.                   */
+    double start = -700.0;
+    double end   = 700.0;
+
+    /*  We'll test on 10 million points between start and end.                */
+    unsigned long N = 1e7;
+
+    /*  Largest relative error allowed for either array function.             */
+    double tol = 1.0e-15;
+    double err, err_strided;
+
+    err = rssringoccs_Compare_Double_Array_Funcs(
+        "C99", exp, "rss_ringoccs", rssringoccs_Double_Exp_Array,
+        start, end, N
+    );
+
+    err_strided = rssringoccs_Compare_Double_Strided_Funcs(
+        "C99", exp, "rss_ringoccs", rssringoccs_Double_Exp_Array_Strided,
+        start, end, N
+    );
+
+    if ((err > tol) || (err_strided > tol))
+    {
+        puts("FAIL");
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
+/*  End of main.                                                              */
@@ -0,0 +1,173 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provide tests for the accuracy and efficiency of                      *
+ *      rssringoccs_Double_SinCos_Array and its _Strided version compared     *
+ *      to calling sin and cos from math.h. The test fails if the relative    *
+ *      error is more than 1.0e-15, or if a special value (zero, infinity,    *
+ *      NaN, ...) disagrees.                                                  *
+ ******************************************************************************/
+
+/*  The sine and cosine functions are found here.                             */
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <math.h>
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*  The relative error of y1 as an approximation of y0, or the absolute error *
+ *  if y0 = 0. A NaN in one but not the other counts as an infinite error.    */
+static double rel_err(double y0, double y1)
+{
+    if (y0 != y0)
+        return (y1 != y1) ? 0.0 : DBL_MAX;
+    else if (y1 != y1)
+        return DBL_MAX;
+    else if (y0 == y1)
+        return 0.0;
+    else if (y0 == 0.0)
+        return fabs(y1);
+    else
+        return fabs((y0 - y1) / y0);
+}
+
+static double max_rel_err(double y0, double y1, double max_err)
+{
+    double err = rel_err(y0, y1);
+    return (err > max_err) ? err : max_err;
+}
+
+/*  Routine for comparing sin and cos with rssringoccs_Double_SinCos_Array.   */
+int main(void)
+{
+    /*  Set the start and end for the values we're testing.                   */
+    double start = -100.0;
+    double end   =  100.0;
+
+    /*  We'll test on 10 million points between start and end.                */
+    unsigned long N = 1e7;
+
+    /*  Largest relative error allowed for either array function.             */
+    double tol = 1.0e-15;
+
+    /*  Special values, checked besides the sampled region.                   */
+    double zero = 0.0;
+    double special[9];
+    double special_sin[9], special_cos[9];
+
+    double *x, *s0, *c0, *s1, *c1;
+    double dx, err = 0.0, err_strided = 0.0;
+    unsigned long n;
+    clock_t t1, t2;
+
+    special[0] = 0.0;
+    special[1] = -0.0;
+    special[2] = 1.0;
+    special[3] = DBL_MIN;
+    special[4] = DBL_MAX;
+    special[5] = DBL_MIN * 0.25;
+    special[6] = 1.0 / zero;
+    special[7] = -1.0 / zero;
+    special[8] = zero / zero;
+
+    /*  x holds 2N points so the strided test can read every other one.       */
+    x  = malloc(sizeof(*x) * 2 * N);
+    s0 = malloc(sizeof(*s0) * N);
+    c0 = malloc(sizeof(*c0) * N);
+    s1 = malloc(sizeof(*s1) * N);
+    c1 = malloc(sizeof(*c1) * 2 * N);
+
+    if (!x || !s0 || !c0 || !s1 || !c1)
+    {
+        puts("Malloc failed.");
+        return -1;
+    }
+
+    dx = (end - start) / N;
+    for (n = 0; n < N; ++n)
+        x[n] = start + (double)n * dx;
+
+    t1 = clock();
+    for (n = 0; n < N; ++n)
+    {
+        s0[n] = sin(x[n]);
+        c0[n] = cos(x[n]);
+    }
+    t2 = clock();
+    printf("C99:          %f\n", (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    t1 = clock();
+    rssringoccs_Double_SinCos_Array(x, s1, c1, N);
+    t2 = clock();
+    printf("rss_ringoccs: %f\n", (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    for (n = 0; n < N; ++n)
+    {
+        err = max_rel_err(s0[n], s1[n], err);
+        err = max_rel_err(c0[n], c1[n], err);
+    }
+
+    rssringoccs_Double_SinCos_Array(special, special_sin, special_cos, 9UL);
+    for (n = 0; n < 9; ++n)
+    {
+        err = max_rel_err(sin(special[n]), special_sin[n], err);
+        err = max_rel_err(cos(special[n]), special_cos[n], err);
+    }
+
+    printf("Max Rel Error: %.16e\n", err);
+
+    /*  Strided: x read with a step of 2, sin written backwards, and cos      *
+     *  written with a step of 2. The odd elements of x must not be read.     */
+    for (n = N; n > 0; --n)
+    {
+        x[2*n-2] = x[n-1];
+        x[2*n-1] = -1.0;
+    }
+
+    t1 = clock();
+    rssringoccs_Double_SinCos_Array_Strided(x, 2L, s1 + (N - 1), -1L,
+                                            c1, 2L, N);
+    t2 = clock();
+    printf("rss_ringoccs Strided: %f\n", (double)(t2-t1)/CLOCKS_PER_SEC);
+
+    for (n = 0; n < N; ++n)
+    {
+        err_strided = max_rel_err(s0[n], s1[N - 1 - n], err_strided);
+        err_strided = max_rel_err(c0[n], c1[2*n], err_strided);
+    }
+
+    printf("Max Rel Error Strided: %.16e\n", err_strided);
+
+    free(x);
+    free(s0);
+    free(c0);
+    free(s1);
+    free(c1);
+
+    if ((err > tol) || (err_strided > tol))
+    {
+        puts("FAIL");
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
+/*  End of main.                                                              */
@@ -0,0 +1,133 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provide tests for the accuracy and efficiency of                      *
+ *      rssringoccs_Double_SinCos compared to the sin and cos functions       *
+ *      provided by math.h. The test fails if the relative error is more      *
+ *      than 1.0e-15, or if a special value (zero, infinity, NaN, ...)        *
+ *      disagrees.                                                            *
+ ******************************************************************************/
+
+/*  The sine and cosine functions are found here.                             */
+#include <rss_ringoccs/include/rss_ringoccs_math.h>
+#include <math.h>
+#include <float.h>
+#include <stdio.h>
+
+/*  The comparison functions are found here.                                  */
+#include <rss_ringoccs/tests/librssringoccs_compare/rss_ringoccs_compare_funcs.h>
+
+/*  The two halves of rssringoccs_Double_SinCos, for the compare functions.   */
+static double sincos_sin(double x)
+{
+    double sin_x, cos_x;
+    rssringoccs_Double_SinCos(x, &sin_x, &cos_x);
+    return sin_x;
+}
+
+static double sincos_cos(double x)
+{
+    double sin_x, cos_x;
+    rssringoccs_Double_SinCos(x, &sin_x, &cos_x);
+    return cos_x;
+}
+
+/*  The relative error of y1 as an approximation of y0, or the absolute error *
+ *  if y0 = 0. A NaN in one but not the other counts as an infinite error.    */
+static double rel_err(double y0, double y1)
+{
+    if (y0 != y0)
+        return (y1 != y1) ? 0.0 : DBL_MAX;
+    else if (y1 != y1)
+        return DBL_MAX;
+    else if (y0 == y1)
+        return 0.0;
+    else if (y0 == 0.0)
+        return fabs(y1);
+    else
+        return fabs((y0 - y1) / y0);
+}
+
+/*  Routine for comparing sin and cos with rssringoccs_Double_SinCos.         */
+int main(void)
+{
+    /*  Set the start and end for the values we're testing.                   */
+    double start = -100.0;
+    double end   =  100.0;
+
+    /*  We'll time on 100 million points, and check 1 million of them.       */
+    unsigned long N = 1e8;
+    unsigned long N_check = 1e6;
+
+    /*  Largest relative error allowed.                                       */
+    double tol = 1.0e-15;
+
+    /*  Special values, checked besides the sampled region.                   */
+    double zero = 0.0;
+    double special[9];
+
+    double x, dx, sin_x, cos_x, err;
+    double max_err = 0.0;
+    unsigned long n;
+
+    rssringoccs_Compare_Double_Funcs("C99 sin", sin,
+                                     "rss_ringoccs", sincos_sin,
+                                     start, end, N);
+
+    rssringoccs_Compare_Double_Funcs("C99 cos", cos,
+                                     "rss_ringoccs", sincos_cos,
+                                     start, end, N);
+
+    special[0] = 0.0;
+    special[1] = -0.0;
+    special[2] = 1.0;
+    special[3] = DBL_MIN;
+    special[4] = DBL_MAX;
+    special[5] = DBL_MIN * 0.25;
+    special[6] = 1.0 / zero;
+    special[7] = -1.0 / zero;
+    special[8] = zero / zero;
+
+    dx = (end - start) / N_check;
+    for (n = 0; n < N_check + 9; ++n)
+    {
+        x = (n < N_check) ? start + (double)n * dx : special[n - N_check];
+        rssringoccs_Double_SinCos(x, &sin_x, &cos_x);
+
+        err = rel_err(sin(x), sin_x);
+        if (max_err < err)
+            max_err = err;
+
+        err = rel_err(cos(x), cos_x);
+        if (max_err < err)
+            max_err = err;
+    }
+
+    printf("Max Rel Error: %.16e\n", max_err);
+
+    if (max_err > tol)
+    {
+        puts("FAIL");
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
+/*  End of main.                                                              */
@@ -0,0 +1,228 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Regression test for the warm started Newton-Raphson reconstruction    *
+ *      on data where the window width changes, so that the widest window in  *
+ *      the range reaches past the ends of the data from points near them,    *
+ *      even though every point's own window fits. The warm start buffer      *
+ *      must stay inside the data. phi_rad_vals gets an allocation of         *
+ *      exactly arr_size points, so that AddressSanitizer or valgrind catch   *
+ *      a read past either end, which they would not inside the arena. The    *
+ *      output is also compared with the reconstruction without warm starts.  *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  The number of points of the data that are used.                           */
+#define N_POINTS 400UL
+
+/*  Largest difference allowed from the reconstruction without warm starts,   *
+ *  relative to the largest value of it. Both stop once phi moves less than   *
+ *  tau->EPS = 1.0e-4, from different guesses, so they are not identical.    */
+#define TOLERANCE 1.0e-4
+
+static const char *geo_file = "../Test_Data/Rev007E_X43_Maxwell_GEO.TAB";
+static const char *cal_file = "../Test_Data/Rev007E_X43_Maxwell_CAL.TAB";
+static const char *dlp_file = "../Test_Data/Rev007E_X43_Maxwell_DLP_500M.TAB";
+static const char *tau_file = "../Test_Data/Rev007E_X43_Maxwell_TAU_1000M.TAB";
+
+/*  A window profile, and the range of points that is reconstructed.         */
+typedef struct {
+    const char *name;
+    double w_left, w_right;
+    unsigned long start, n_used;
+} warm_case;
+
+/*  The sample spacing is 0.25 km, so a window of w km has w / 0.5 points on  *
+ *  each side. Wide then narrow reaches past the end of the data, and narrow  *
+ *  then wide reaches before the start.                                       */
+static const warm_case cases[] = {
+    {"wide then narrow", 20.0, 5.0, 40UL, 350UL},
+    {"narrow then wide", 5.0, 20.0, 10UL, 350UL}
+};
+
+/*  Points the members of dlp at the first N_POINTS points of csv.            */
+static void make_dlp(rssringoccs_DLPObj *dlp, const rssringoccs_CSVData *csv)
+{
+    dlp->rho_km_vals = csv->rho_km_vals;
+    dlp->phi_rad_vals = csv->phi_rad_vals;
+    dlp->B_rad_vals = csv->B_rad_vals;
+    dlp->D_km_vals = csv->D_km_vals;
+    dlp->f_sky_hz_vals = csv->f_sky_hz_vals;
+    dlp->rho_dot_kms_vals = csv->rho_dot_kms_vals;
+    dlp->t_oet_spm_vals = csv->t_oet_spm_vals;
+    dlp->t_ret_spm_vals = csv->t_ret_spm_vals;
+    dlp->t_set_spm_vals = csv->t_set_spm_vals;
+    dlp->rho_corr_pole_km_vals = csv->rho_corr_pole_km_vals;
+    dlp->rho_corr_timing_km_vals = csv->rho_corr_timing_km_vals;
+    dlp->phi_rl_rad_vals = csv->phi_rl_rad_vals;
+    dlp->p_norm_vals = csv->p_norm_vals;
+    dlp->phase_rad_vals = csv->phase_rad_vals;
+    dlp->raw_tau_threshold_vals = csv->raw_tau_threshold_vals;
+    dlp->rx_km_vals = csv->rx_km_vals;
+    dlp->ry_km_vals = csv->ry_km_vals;
+    dlp->rz_km_vals = csv->rz_km_vals;
+    dlp->arr_size = N_POINTS;
+    dlp->error_occurred = rssringoccs_False;
+    dlp->error_message = NULL;
+}
+
+/*  Runs the Newton-Raphson reconstruction for one case, returning tau with   *
+ *  T_out set, or NULL on error.                                              */
+static rssringoccs_TAUObj *
+run_newton(rssringoccs_DLPObj *dlp, const warm_case *test,
+           rssringoccs_Bool warm)
+{
+    rssringoccs_TAUObj *tau;
+    double *phi;
+    unsigned long n;
+
+    tau = rssringoccs_Create_TAUObj(dlp, 1.0);
+    if (tau == NULL)
+        return NULL;
+
+    rssringoccs_Tau_Set_Psitype("newton", tau);
+    rssringoccs_Tau_Check_Occ_Type(tau);
+    rssringoccs_Tau_Compute_Vars(tau);
+    tau->use_warm_start = warm;
+    tau->num_threads = 1U;
+
+    tau->w_km_vals = rssringoccs_Tau_Arena_Calloc(tau, tau->arr_size,
+                                                  sizeof(*tau->w_km_vals));
+    tau->T_out = rssringoccs_Tau_Arena_Calloc(tau, tau->arr_size,
+                                              sizeof(*tau->T_out));
+    phi = malloc(sizeof(*phi) * tau->arr_size);
+
+    if (tau->error_occurred || !tau->w_km_vals || !tau->T_out || !phi)
+    {
+        free(phi);
+        rssringoccs_Destroy_Tau(&tau);
+        return NULL;
+    }
+
+    /*  Not in the arena, so rssringoccs_Destroy_Tau frees it.                */
+    memcpy(phi, tau->phi_rad_vals, sizeof(*phi) * tau->arr_size);
+    tau->phi_rad_vals = phi;
+
+    for (n = 0; n < tau->arr_size; ++n)
+        tau->w_km_vals[n] = (n < tau->arr_size / 2) ? test->w_left
+                                                    : test->w_right;
+
+    tau->start  = test->start;
+    tau->n_used = test->n_used;
+    rssringoccs_Diffraction_Correction_Newton(tau);
+    return tau;
+}
+
+/*  Runs one case with and without warm starts, printing why on failure.     */
+static rssringoccs_Bool run_case(rssringoccs_DLPObj *dlp, const warm_case *test)
+{
+    rssringoccs_TAUObj *warm, *cold;
+    rssringoccs_ComplexDouble diff;
+    double err = 0.0, scale = 0.0, tmp;
+    unsigned long n;
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    warm = run_newton(dlp, test, rssringoccs_True);
+    cold = run_newton(dlp, test, rssringoccs_False);
+
+    if ((warm == NULL) || (cold == NULL))
+        printf("%s: could not set up the reconstruction.\n", test->name);
+
+    else if (warm->error_occurred || cold->error_occurred)
+        printf("%s: %s\n", test->name,
+               warm->error_occurred ? warm->error_message
+                                    : cold->error_message);
+
+    else
+    {
+        for (n = test->start; n < test->start + test->n_used; ++n)
+        {
+            diff = rssringoccs_CDouble_Subtract(warm->T_out[n],
+                                                cold->T_out[n]);
+            tmp = rssringoccs_CDouble_Abs(diff);
+            if (!(tmp <= err))
+                err = tmp;
+
+            tmp = rssringoccs_CDouble_Abs(cold->T_out[n]);
+            if (scale < tmp)
+                scale = tmp;
+        }
+
+        err = (scale == 0.0) ? err : err / scale;
+        printf("%s: max relative difference %.3e\n", test->name, err);
+        pass = (err <= TOLERANCE);
+    }
+
+    rssringoccs_Destroy_Tau(&warm);
+    rssringoccs_Destroy_Tau(&cold);
+    return pass;
+}
+
+int main(void)
+{
+    rssringoccs_CSVData *csv;
+    rssringoccs_DLPObj dlp;
+    unsigned long n;
+    unsigned long n_cases = sizeof(cases) / sizeof(cases[0]);
+    unsigned long n_failed = 0;
+
+    csv = rssringoccs_Extract_CSV_Data(geo_file, cal_file, dlp_file, tau_file,
+                                       rssringoccs_False);
+
+    if (csv == NULL)
+    {
+        puts("FAIL: rssringoccs_Extract_CSV_Data returned NULL.");
+        return -1;
+    }
+
+    if (csv->error_occurred || (csv->n_elements < N_POINTS))
+    {
+        puts("FAIL: could not read the test data.");
+        rssringoccs_Destroy_CSV_Members(csv);
+        free(csv);
+        return -1;
+    }
+
+    make_dlp(&dlp, csv);
+
+    for (n = 0; n < n_cases; ++n)
+    {
+        if (!run_case(&dlp, &cases[n]))
+            ++n_failed;
+    }
+
+    rssringoccs_Destroy_CSV_Members(csv);
+    free(csv);
+
+    if (n_failed > 0)
+    {
+        printf("FAIL: %lu of %lu cases.\n", n_failed, n_cases);
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
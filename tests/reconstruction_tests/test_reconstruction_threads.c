@@ -0,0 +1,200 @@
+/******************************************************************************
+ *                                 LICENSE                                    *
+ ******************************************************************************
+ *  This file is part of rss_ringoccs.                                        *
+ *                                                                            *
+ *  rss_ringoccs is free software: you can redistribute it and/or modify it   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  rss_ringoccs is distributed in the hope that it will be useful,           *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with rss_ringoccs.  If not, see <https://www.gnu.org/licenses/>.    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tests that the output of rssringoccs_Reconstruction does not depend   *
+ *      on tau->num_threads. The Maxwell ringlet of the Rev007 test data is   *
+ *      reconstructed on one thread and on several, and T_out must be the     *
+ *      same bit for bit. This includes the modes that carry state between    *
+ *      points, warm started Newton-Raphson and interpolated Legendre         *
+ *      coefficients, which are reset where rssringoccs_Tau_Run_Range may     *
+ *      split the points.                                                     *
+ ******************************************************************************/
+
+#include <rss_ringoccs/include/rss_ringoccs_reconstruction.h>
+#include <rss_ringoccs/include/rss_ringoccs_csv_tools.h>
+#include <rss_ringoccs/include/rss_ringoccs_complex.h>
+#include <rss_ringoccs/include/rss_ringoccs_bool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*  The number of threads compared with a single thread.                      */
+#define N_THREADS 4U
+
+static const char *geo_file = "../Test_Data/Rev007E_X43_Maxwell_GEO.TAB";
+static const char *cal_file = "../Test_Data/Rev007E_X43_Maxwell_CAL.TAB";
+static const char *dlp_file = "../Test_Data/Rev007E_X43_Maxwell_DLP_500M.TAB";
+static const char *tau_file = "../Test_Data/Rev007E_X43_Maxwell_TAU_1000M.TAB";
+
+/*  A reconstruction method, with the options that carry state between       *
+ *  points turned on or off.                                                  */
+typedef struct {
+    const char *name;
+    const char *psitype;
+    rssringoccs_Bool use_warm_start;
+    double legendre_tol;
+} thread_case;
+
+static const thread_case cases[] = {
+    {"fresnel", "fresnel", rssringoccs_False, 0.0},
+    {"fresnel4", "fresnel4", rssringoccs_False, 0.0},
+    {"fresnel4, interpolated", "fresnel4", rssringoccs_False, 1.0e-6},
+    {"newton", "newton", rssringoccs_False, 0.0},
+    {"newton, warm started", "newton", rssringoccs_True, 0.0}
+};
+
+/*  Points the members of dlp at the arrays of csv.                           */
+static void make_dlp(rssringoccs_DLPObj *dlp, const rssringoccs_CSVData *csv)
+{
+    dlp->rho_km_vals = csv->rho_km_vals;
+    dlp->phi_rad_vals = csv->phi_rad_vals;
+    dlp->B_rad_vals = csv->B_rad_vals;
+    dlp->D_km_vals = csv->D_km_vals;
+    dlp->f_sky_hz_vals = csv->f_sky_hz_vals;
+    dlp->rho_dot_kms_vals = csv->rho_dot_kms_vals;
+    dlp->t_oet_spm_vals = csv->t_oet_spm_vals;
+    dlp->t_ret_spm_vals = csv->t_ret_spm_vals;
+    dlp->t_set_spm_vals = csv->t_set_spm_vals;
+    dlp->rho_corr_pole_km_vals = csv->rho_corr_pole_km_vals;
+    dlp->rho_corr_timing_km_vals = csv->rho_corr_timing_km_vals;
+    dlp->phi_rl_rad_vals = csv->phi_rl_rad_vals;
+    dlp->p_norm_vals = csv->p_norm_vals;
+    dlp->phase_rad_vals = csv->phase_rad_vals;
+    dlp->raw_tau_threshold_vals = csv->raw_tau_threshold_vals;
+    dlp->rx_km_vals = csv->rx_km_vals;
+    dlp->ry_km_vals = csv->ry_km_vals;
+    dlp->rz_km_vals = csv->rz_km_vals;
+    dlp->arr_size = csv->n_elements;
+    dlp->error_occurred = rssringoccs_False;
+    dlp->error_message = NULL;
+}
+
+/*  Reconstructs the Maxwell ringlet at 1 km on num_threads threads.          */
+static rssringoccs_TAUObj *
+run(rssringoccs_DLPObj *dlp, const thread_case *test, unsigned int num_threads)
+{
+    rssringoccs_TAUObj *tau = rssringoccs_Create_TAUObj(dlp, 1.0);
+
+    if (tau == NULL)
+        return NULL;
+
+    tau->rng_list[0] = 87400.0;
+    tau->rng_list[1] = 87600.0;
+    tau->num_threads = num_threads;
+    tau->use_warm_start = test->use_warm_start;
+    tau->legendre_tol = test->legendre_tol;
+
+    rssringoccs_Tau_Set_Psitype(test->psitype, tau);
+    rssringoccs_Reconstruction(tau);
+    return tau;
+}
+
+/*  Runs one case on one thread and on N_THREADS, printing why on failure.    */
+static rssringoccs_Bool
+run_case(rssringoccs_DLPObj *dlp, const thread_case *test)
+{
+    rssringoccs_TAUObj *one, *many;
+    rssringoccs_ComplexDouble a, b;
+    unsigned long n;
+    rssringoccs_Bool pass = rssringoccs_False;
+
+    one  = run(dlp, test, 1U);
+    many = run(dlp, test, N_THREADS);
+
+    if ((one == NULL) || (many == NULL))
+        printf("%s: could not create the tau object.\n", test->name);
+
+    else if (one->error_occurred || many->error_occurred)
+        printf("%s: %s\n", test->name,
+               one->error_occurred ? one->error_message
+                                   : many->error_message);
+
+    else if ((one->arr_size != many->arr_size) || (one->arr_size == 0))
+        printf("%s: %lu and %lu points.\n", test->name,
+               one->arr_size, many->arr_size);
+
+    else
+    {
+        pass = rssringoccs_True;
+        for (n = 0; (n < one->arr_size) && pass; ++n)
+        {
+            a = one->T_out[n];
+            b = many->T_out[n];
+            if ((rssringoccs_CDouble_Real_Part(a) !=
+                 rssringoccs_CDouble_Real_Part(b)) ||
+                (rssringoccs_CDouble_Imag_Part(a) !=
+                 rssringoccs_CDouble_Imag_Part(b)))
+            {
+                printf("%s: point %lu is %.17e + i%.17e on %u threads,\n"
+                       "%.17e + i%.17e on one.\n", test->name, n,
+                       rssringoccs_CDouble_Real_Part(b),
+                       rssringoccs_CDouble_Imag_Part(b), N_THREADS,
+                       rssringoccs_CDouble_Real_Part(a),
+                       rssringoccs_CDouble_Imag_Part(a));
+                pass = rssringoccs_False;
+            }
+        }
+
+        if (pass)
+            printf("%s: %lu points.\n", test->name, one->arr_size);
+    }
+
+    rssringoccs_Destroy_Tau(&one);
+    rssringoccs_Destroy_Tau(&many);
+    return pass;
+}
+
+int main(void)
+{
+    rssringoccs_CSVData *csv;
+    rssringoccs_DLPObj dlp;
+    unsigned long n;
+    unsigned long n_cases = sizeof(cases) / sizeof(cases[0]);
+    unsigned long n_failed = 0;
+
+    csv = rssringoccs_Extract_CSV_Data(geo_file, cal_file, dlp_file, tau_file,
+                                       rssringoccs_False);
+
+    if ((csv == NULL) || csv->error_occurred)
+    {
+        puts("FAIL: could not read the test data.");
+        rssringoccs_Destroy_CSV_Members(csv);
+        free(csv);
+        return -1;
+    }
+
+    make_dlp(&dlp, csv);
+
+    for (n = 0; n < n_cases; ++n)
+    {
+        if (!run_case(&dlp, &cases[n]))
+            ++n_failed;
+    }
+
+    rssringoccs_Destroy_CSV_Members(csv);
+    free(csv);
+
+    if (n_failed > 0)
+    {
+        printf("FAIL: %lu of %lu cases.\n", n_failed, n_cases);
+        return -1;
+    }
+
+    puts("PASS");
+    return 0;
+}
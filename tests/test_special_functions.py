@@ -1,21 +1,16 @@
 import numpy
 import scipy
-from ..rss_ringoccs.diffrec import special_functions
+# The C extension built by setup.py, installed as a top-level module.
+import special_functions
 
 # Declare constants for multiples of pi.
 HALF_PI = 1.570796326794896619231322
 
 def p_bessel_J0(x):
-    try:
-        return scipy.special.jv(0, x)
-    except:
-        return scipy.special.jv(0, x.astype(numpy.float))
+    return scipy.special.jv(0, numpy.asarray(x, dtype=numpy.float64))
 
 def p_bessel_I0(x):
-    try:
-        return scipy.special.iv(0, x)
-    except:
-        return scipy.special.iv(0, x.astype(numpy.float))
+    return scipy.special.iv(0, numpy.asarray(x, dtype=numpy.float64))
 
 """
     The following are old routines kept for the sake of preserve a pure Python
@@ -484,3 +479,60 @@ def fresnel_legendre_transform(T_in, rho_km_vals, F_km_vals, phi_rad_vals,
         if norm:
             T_out[center] *= window_functions.window_norm(dx_km, ker, F)
     return T_out
+
+# The special functions are NumPy ufuncs, so lists give back an ndarray
+# (not a list) and scalars give back a scalar.
+def test_return_types():
+    x = [-1.0, -0.5, 0.0, 0.5, 1.0]
+
+    y = special_functions.besselJ0(x)
+    assert isinstance(y, numpy.ndarray)
+    assert numpy.allclose(y, p_bessel_J0(x), rtol=1.0e-12, atol=0.0)
+
+    y = special_functions.besselI0(x)
+    assert isinstance(y, numpy.ndarray)
+    assert numpy.allclose(y, p_bessel_I0(x), rtol=1.0e-12, atol=0.0)
+
+    y = special_functions.kbmd20(x, 5.0)
+    assert isinstance(y, numpy.ndarray)
+    assert y.shape == (5,)
+
+    y = special_functions.kbmd20(0.5, 5.0)
+    assert numpy.isscalar(y)
+
+    y = special_functions.rect(numpy.array(x, dtype=numpy.float32), 5.0)
+    assert y.dtype == numpy.float32
+
+# The window functions need W, and alpha for kbal and kbmdal, to be positive.
+def test_window_width_must_be_positive():
+    x = numpy.linspace(-1.0, 1.0, 11)
+    windows = [
+        special_functions.rect, special_functions.coss,
+        special_functions.kb20, special_functions.kb25,
+        special_functions.kb35, special_functions.kbmd20,
+        special_functions.kbmd25, special_functions.kbmd35
+    ]
+
+    for func in windows:
+        for W in [-1.0, 0.0, numpy.array([5.0, -5.0])[:, numpy.newaxis]]:
+            try:
+                func(x, W)
+            except ValueError:
+                pass
+            else:
+                raise AssertionError("%s accepted W <= 0" % func.__name__)
+
+        # A valid width still works after a bad one was rejected.
+        assert numpy.all(numpy.isfinite(func(x, 5.0)))
+
+    for func in [special_functions.kbal, special_functions.kbmdal]:
+        for W, alpha in [(-1.0, 1.0), (5.0, 0.0), (5.0, -1.0)]:
+            try:
+                func(x, W, alpha)
+            except ValueError:
+                pass
+            else:
+                raise AssertionError("%s accepted W, alpha = %f, %f"
+                                     % (func.__name__, W, alpha))
+
+        assert numpy.all(numpy.isfinite(func(x, 5.0, 1.0)))